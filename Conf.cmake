@@ -26,6 +26,9 @@ option(OPS_Use_Dev_Directories
 option(FMK
   "Special FMK Code"                                       OFF)
 
+option(OPS_Use_OpenMP
+  "Compile with OpenMP for the threaded domain passes"      OFF)
+
 set(OPS_Use_Graphics_Option
   None
   # Base
@@ -0,0 +1,124 @@
+# AMG Preconditioned Iterative Solution of a Plane Stress Wall
+
+# Checks the AMG system, which solves with CG, BiCGStab or GMRES
+# preconditioned by smoothed aggregation AMG, against the direct
+# BandGeneral solution. A cantilever wall of quad elements is loaded
+# laterally and vertically in several increments, so that the AMG
+# hierarchy built for the first solve is also reused in later ones.
+
+puts "AMGSolver.tcl: Verification of the AMG preconditioned iterative system"
+puts "  - static analysis of a quad mesh, AMG vs direct solution"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+set tol 1.0e-6
+
+set nx 16
+set ny 48
+set width 120.0
+set height 360.0
+
+# procedure to build the wall and load it, returning the displacements of
+# all the nodes
+
+proc loadWall {systemCommand} {
+
+    global nx ny width height
+
+    wipe
+    model Basic -ndm 2 -ndf 2
+
+    nDMaterial ElasticIsotropic 1 3600.0 0.2
+
+    # nodes, a row at a time, fixed at the base
+    for {set j 0} {$j <= $ny} {incr j 1} {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    set nodeTag [expr $j*($nx+1) + $i + 1]
+	    node $nodeTag [expr $i*$width/$nx] [expr $j*$height/$ny]
+	    if {$j == 0} {
+		fix $nodeTag 1 1
+	    }
+	}
+    }
+
+    set eleTag 1
+    for {set j 0} {$j < $ny} {incr j 1} {
+	for {set i 0} {$i < $nx} {incr i 1} {
+	    set n1 [expr $j*($nx+1) + $i + 1]
+	    set n2 [expr $n1 + 1]
+	    set n3 [expr $n2 + $nx + 1]
+	    set n4 [expr $n1 + $nx + 1]
+	    element quad $eleTag $n1 $n2 $n3 $n4 12.0 PlaneStress 1
+	    incr eleTag 1
+	}
+    }
+
+    # lateral and vertical loads along the top of the wall
+    pattern Plain 1 Linear {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    load [expr $ny*($nx+1) + $i + 1] 10.0 -5.0
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    eval $systemCommand
+    test NormDispIncr 1.0e-10 10
+    algorithm Newton
+    integrator LoadControl 0.2
+    analysis Static
+    analyze 5
+
+    set disps {}
+    foreach nodeTag [getNodeTags] {
+	lappend disps [nodeDisp $nodeTag 1] [nodeDisp $nodeTag 2]
+    }
+    return $disps
+}
+
+set direct [loadWall "system BandGeneral"]
+
+set maxU 0.0
+foreach u $direct {
+    if {abs($u) > $maxU} {
+	set maxU [expr abs($u)]
+    }
+}
+
+set formatString {%40s%15.5e}
+puts [format $formatString "direct max displacement:" $maxU]
+
+foreach systemCommand {
+    "system AMG -solver CG -tol 1.0e-12"
+    "system AMG -solver BiCGStab -tol 1.0e-12"
+    "system AMG -solver GMRES -smoother ilu0 -tol 1.0e-12"
+} {
+    set amg [loadWall $systemCommand]
+
+    set maxDiff 0.0
+    foreach u1 $direct u2 $amg {
+	if {$u2 == ""} {
+	    set maxDiff 1.0e30
+	    break
+	}
+	if {abs($u1-$u2) > $maxDiff} {
+	    set maxDiff [expr abs($u1-$u2)]
+	}
+    }
+
+    puts [format $formatString "$systemCommand, max difference:" $maxDiff]
+
+    if {$maxDiff > [expr $tol*$maxU] || $maxU == 0.0} {
+	set testOK -1;
+	puts "failed  $systemCommand> $maxDiff > [expr $tol*$maxU]"
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test AMGSolver.tcl \n\n"
+    puts $results "PASSED : AMGSolver.tcl"
+} else {
+    puts "\nFAILED Verification Test AMGSolver.tcl \n\n"
+    puts $results "FAILED : AMGSolver.tcl"
+}
+close $results
@@ -0,0 +1,117 @@
+# Checkpoint and Restart of a Two Story Shear Building
+
+# Checks the Checkpoint database, which saves the state of the domain to
+# a single binary file. A yielding shear building is run through part of
+# the El Centro record, saved, and run on through the rest. The checkpoint
+# is then restored: the time and displacements must be those saved, and
+# repeating the rest of the record from them, through the restored
+# material history, must give the same response as the first time.
+
+puts "Checkpoint.tcl: Verification of the Checkpoint database"
+puts "  - save, restore and restart of a yielding shear building"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+set tol 1.0e-12
+set g 386.4
+
+# read earthquake record, setting dt and nPts variables with data in the file elCentro.at2
+source ReadRecord.tcl
+ReadRecord elCentro.at2 elCentro.dat dt nPts
+
+set fileName checkpoint.bin
+file delete $fileName
+
+wipe
+model Basic -ndm 1 -ndf 1
+
+node 1 0.0
+node 2 0.0 -mass 0.5
+node 3 0.0 -mass 0.4
+fix 1 1
+
+uniaxialMaterial Steel01 1 30.0 100.0 0.05
+uniaxialMaterial Elastic 2 80.0
+element zeroLength 1 1 2 -mat 1 -dir 1
+element zeroLength 2 2 3 -mat 2 -dir 1
+
+timeSeries Path 1 -filePath elCentro.dat -dt $dt -factor $g
+pattern UniformExcitation 1 1 -accel 1
+
+constraints Plain
+numberer Plain
+system BandGeneral
+test NormDispIncr 1.0e-12 20
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+database Checkpoint $fileName
+
+# run the first part of the record and save
+set numSave [expr $nPts/2]
+analyze $numSave $dt
+save 1
+set tSave [getTime]
+set uSave [list [nodeDisp 2 1] [nodeDisp 3 1]]
+
+# run the rest of the record
+set numRest [expr $nPts - $numSave]
+set uRest {}
+for {set i 0} {$i < $numRest} {incr i 1} {
+    analyze 1 $dt
+    lappend uRest [nodeDisp 3 1]
+}
+
+# restore and check the state
+restore 1
+set tRestore [getTime]
+set uRestore [list [nodeDisp 2 1] [nodeDisp 3 1]]
+
+set formatString {%20s%15.5f%20s%15.5f}
+puts [format $formatString "time saved:" $tSave "restored:" $tRestore]
+
+if {abs($tRestore-$tSave) > [expr $tol*$tSave]} {
+    set testOK -1;
+    puts "failed  restored time> $tRestore != $tSave"
+}
+foreach u1 $uSave u2 $uRestore {
+    if {abs($u1-$u2) > [expr $tol*abs($u1)]} {
+	set testOK -1;
+	puts "failed  restored displacement> $u2 != $u1"
+    }
+}
+
+# run the rest of the record again from the checkpoint
+set maxU 0.0
+set maxDiff 0.0
+foreach u1 $uRest {
+    analyze 1 $dt
+    set u2 [nodeDisp 3 1]
+    if {abs($u1) > $maxU} {
+	set maxU [expr abs($u1)]
+    }
+    if {abs($u1-$u2) > $maxDiff} {
+	set maxDiff [expr abs($u1-$u2)]
+    }
+}
+
+set formatString {%20s%15.5e%20s%15.5e}
+puts [format $formatString "max displacement:" $maxU "max difference:" $maxDiff]
+
+if {$maxDiff > [expr $tol*$maxU] || $maxU == 0.0} {
+    set testOK -1;
+    puts "failed  restart> $maxDiff > [expr $tol*$maxU]"
+}
+
+wipe
+file delete $fileName
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test Checkpoint.tcl \n\n"
+    puts $results "PASSED : Checkpoint.tcl"
+} else {
+    puts "\nFAILED Verification Test Checkpoint.tcl \n\n"
+    puts $results "FAILED : Checkpoint.tcl"
+}
+close $results
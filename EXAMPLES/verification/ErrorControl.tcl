@@ -0,0 +1,158 @@
+# Error Controlled Time Stepping of an Elastic SDOF System
+
+#REFERENCES:
+# 1) Chopra, A.K. "Dynamics of Structures: Theory and Applications"
+# Prentice Hall, 1995.
+#   - Section 3.1
+
+# Checks the error controlled VariableTransient analysis on the harmonic
+# vibration of an undamped SDOF system. The accepted steps are recorded,
+# and the step sequence must advance monotonically and end exactly at the
+# requested time. The response at every accepted step is compared with
+# the exact solution, and a tighter tolerance must take more steps for a
+# smaller error. The linear acceleration method (beta = 1/6) has no error
+# estimate and must be refused.
+
+puts "ErrorControl.tcl: Verification of error controlled time stepping"
+puts "  - undamped SDOF system under harmonic excitation (Chopra 3.1)"
+
+set PI [expr 2.0*asin(1.0)]
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+set tol 1.0e-2
+
+# harmonic force properties
+set P 2.0
+set periodForce 5.0
+set tFinal [expr 2.251*$periodForce]
+
+# model properties
+set periodStruct 0.8
+set K 2.0
+
+# derived quantities
+set w [expr 2.0 * $PI / $periodForce]
+set wn [expr 2.0 * $PI / $periodStruct]
+set m [expr $K/($wn * $wn)]
+
+# procedure to build the model and the error controlled analysis
+
+proc buildModel {beta absTol relTol} {
+
+    global P K m periodForce
+
+    wipe
+    model basic -ndm 1 -ndf 1
+
+    node  1  0.
+    node  2  0. -mass $m
+
+    uniaxialMaterial Elastic 1 $K
+    element zeroLength 1 1 2 -mat 1 -dir 1
+
+    fix 1 1
+
+    timeSeries Trig 1 0.0 [expr 100.0*$periodForce] $periodForce -factor $P
+    pattern Plain 1 1 {
+	load 2 1.0
+    }
+
+    constraints Plain
+    numberer Plain
+    algorithm Linear
+    integrator Newmark 0.5 $beta
+    system ProfileSPD
+    analysis VariableTransient -errorControl $absTol $relTol
+}
+
+# procedure to run the error controlled analysis, returning the number of
+# accepted steps and the largest error against the exact solution
+
+proc runErrorControl {absTol relTol} {
+
+    global P K w wn tFinal testOK
+
+    buildModel 0.25 $absTol $relTol
+    recorder Node -file errorControl.out -precision 16 -time -node 2 -dof 1 disp
+
+    set ok [analyze 1 $tFinal 1.0e-6 0.1 0]
+    set tEnd [getTime]
+    remove recorders
+
+    if {$ok != 0} {
+	set testOK -1;
+	puts "failed  absTol $absTol> analyze returned $ok"
+    }
+    if {abs($tEnd-$tFinal) > [expr 1.0e-12*$tFinal]} {
+	set testOK -1;
+	puts "failed  absTol $absTol> end time $tEnd != $tFinal"
+    }
+
+    # check the accepted steps
+    set numSteps 0
+    set maxError 0.0
+    set tLast 0.0
+    set theFile [open errorControl.out r]
+    while {[gets $theFile line] >= 0} {
+	if {[llength $line] != 2} {
+	    continue
+	}
+	set t [lindex $line 0]
+	set uOpenSees [lindex $line 1]
+	if {$t <= $tLast} {
+	    set testOK -1;
+	    puts "failed  absTol $absTol> step to $t does not advance from $tLast"
+	}
+	set uExact [expr $P/$K * 1.0/(1 - ($w*$w)/($wn*$wn)) * (sin($w*$t) - ($w/$wn)*sin($wn*$t))]
+	if {abs($uExact-$uOpenSees) > $maxError} {
+	    set maxError [expr abs($uExact-$uOpenSees)]
+	}
+	set tLast $t
+	incr numSteps 1
+    }
+    close $theFile
+    file delete errorControl.out
+
+    if {abs($tLast-$tFinal) > [expr 1.0e-12*$tFinal]} {
+	set testOK -1;
+	puts "failed  absTol $absTol> last recorded step at $tLast != $tFinal"
+    }
+
+    return [list $numSteps $maxError]
+}
+
+set formatString {%15s%15s%15s}
+puts [format $formatString absTol numSteps maxError]
+set formatString {%15.1e%15d%15.5e}
+
+set loose [runErrorControl 1.0e-4 0.0]
+puts [format $formatString 1.0e-4 [lindex $loose 0] [lindex $loose 1]]
+set tight [runErrorControl 1.0e-6 0.0]
+puts [format $formatString 1.0e-6 [lindex $tight 0] [lindex $tight 1]]
+
+if {[lindex $tight 1] > $tol} {
+    set testOK -1;
+    puts "failed  tight tolerance> [lindex $tight 1] > $tol"
+}
+if {[lindex $tight 0] <= [lindex $loose 0] || [lindex $tight 1] >= [lindex $loose 1]} {
+    set testOK -1;
+    puts "failed  a tighter tolerance should take more steps for a smaller error"
+}
+
+# the linear acceleration method has no error estimate
+puts "\n  - linear acceleration method, beta = 1/6, must be refused"
+buildModel [expr 1.0/6.0] 1.0e-5 0.0
+set ok [analyze 1 $tFinal 1.0e-6 0.1 0]
+if {$ok == 0 || [getTime] != 0.0} {
+    set testOK -1;
+    puts "failed  beta = 1/6> analyze returned $ok at time [getTime]"
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ErrorControl.tcl \n\n"
+    puts $results "PASSED : ErrorControl.tcl"
+} else {
+    puts "\nFAILED Verification Test ErrorControl.tcl \n\n"
+    puts $results "FAILED : ErrorControl.tcl"
+}
+close $results
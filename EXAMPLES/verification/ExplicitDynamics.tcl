@@ -0,0 +1,109 @@
+# Threaded Explicit Dynamics of a Plane Stress Wall
+
+# Checks the explicitDynamicsAnalysis command run with 1 and 4 threads
+# (setDomainThreads). Within a color the elements touch disjoint nodes
+# and the colors are processed in turn, so every nodal force receives its
+# element contributions in the same order and the response must be bit
+# identical. Each run follows a wipe, so the second one also checks that
+# the engine is rebuilt for the new domain rather than reusing the arrays
+# of the wiped one.
+
+puts "ExplicitDynamics.tcl: Verification of the threaded explicit dynamics engine"
+puts "  - central difference analysis of a quad mesh, serial and threaded"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+
+set nx 8
+set ny 24
+set width 120.0
+set height 360.0
+
+# procedure to build the wall and integrate it explicitly, returning
+# the displacements of all the nodes
+
+proc shakeWall {numThreads} {
+
+    global nx ny width height
+
+    wipe
+    setDomainThreads $numThreads
+
+    model Basic -ndm 2 -ndf 2
+
+    nDMaterial ElasticIsotropic 1 3600.0 0.2 2.25e-7
+
+    # nodes, a row at a time, fixed at the base
+    for {set j 0} {$j <= $ny} {incr j 1} {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    set nodeTag [expr $j*($nx+1) + $i + 1]
+	    node $nodeTag [expr $i*$width/$nx] [expr $j*$height/$ny]
+	    if {$j == 0} {
+		fix $nodeTag 1 1
+	    }
+	}
+    }
+
+    set eleTag 1
+    for {set j 0} {$j < $ny} {incr j 1} {
+	for {set i 0} {$i < $nx} {incr i 1} {
+	    set n1 [expr $j*($nx+1) + $i + 1]
+	    set n2 [expr $n1 + 1]
+	    set n3 [expr $n2 + $nx + 1]
+	    set n4 [expr $n1 + $nx + 1]
+	    element quad $eleTag $n1 $n2 $n3 $n4 12.0 PlaneStress 1
+	    incr eleTag 1
+	}
+    }
+
+    # a lateral pulse along the top of the wall
+    timeSeries Trig 1 0.0 0.5 0.25 -factor 10.0
+    pattern Plain 1 1 {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    load [expr $ny*($nx+1) + $i + 1] 1.0 0.0
+	}
+    }
+
+    # the stable time step is used
+    explicitDynamicsAnalysis 2000
+
+    set disps {}
+    foreach nodeTag [getNodeTags] {
+	lappend disps [nodeDisp $nodeTag 1] [nodeDisp $nodeTag 2]
+    }
+    lappend disps [getTime]
+
+    setDomainThreads 1
+    return $disps
+}
+
+set serial [shakeWall 1]
+set threaded [shakeWall 4]
+
+set maxU 0.0
+set maxDiff 0.0
+foreach u1 $serial u2 $threaded {
+    if {abs($u1) > $maxU} {
+	set maxU [expr abs($u1)]
+    }
+    if {abs($u1-$u2) > $maxDiff} {
+	set maxDiff [expr abs($u1-$u2)]
+    }
+}
+
+set formatString {%20s%15.5e%20s%15.5e}
+puts [format $formatString "max displacement:" $maxU "max difference:" $maxDiff]
+
+if {$maxDiff != 0.0 || $maxU == 0.0} {
+    set testOK -1;
+    puts "failed  threaded explicit dynamics> $maxDiff != 0"
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ExplicitDynamics.tcl \n\n"
+    puts $results "PASSED : ExplicitDynamics.tcl"
+} else {
+    puts "\nFAILED Verification Test ExplicitDynamics.tcl \n\n"
+    puts $results "FAILED : ExplicitDynamics.tcl"
+}
+close $results
@@ -0,0 +1,134 @@
+# Multiple Record Analysis of a Two Story Shear Building
+
+# Checks the multiRecordAnalysis command, which snapshots the model and the
+# analysis objects into a MemoryChannel and rebuilds an independent copy
+# from it for every record. The El Centro record is listed twice, so the
+# same snapshot is received more than once, and the two runs must agree
+# exactly. The roof displacement of every record is also compared with
+# that of an ordinary transient analysis of the original model.
+
+puts "MultiRecord.tcl: Verification of the multiple record analysis"
+puts "  - records run on MemoryChannel copies of a yielding shear building"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+set tol 1.0e-9;   # the response files are written with 10 significant digits
+set g 386.4
+
+# read earthquake record, setting dt and nPts variables with data in the file elCentro.at2
+source ReadRecord.tcl
+ReadRecord elCentro.at2 elCentro.dat dt nPts
+
+# procedure to build the model and the analysis objects
+
+proc buildModel {} {
+
+    wipe
+    model Basic -ndm 1 -ndf 1
+
+    node 1 0.0
+    node 2 0.0 -mass 0.5
+    node 3 0.0 -mass 0.4
+    fix 1 1
+
+    uniaxialMaterial Steel01 1 30.0 100.0 0.05
+    uniaxialMaterial Elastic 2 80.0
+    element zeroLength 1 1 2 -mat 1 -dir 1
+    element zeroLength 2 2 3 -mat 2 -dir 1
+
+    constraints Plain
+    numberer Plain
+    system BandGeneral
+    test NormDispIncr 1.0e-12 20
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+# the records, defined in every model that is built
+
+proc addRecords {} {
+
+    global dt g
+
+    timeSeries Path 1 -filePath elCentro.dat -dt $dt -factor $g
+    timeSeries Trig 2 0.0 10.0 1.0 -factor [expr 0.3*$g]
+}
+
+# the records run by multiRecordAnalysis, the El Centro record twice
+buildModel
+addRecords
+multiRecordAnalysis 1 $dt $nPts -records 1 2 1 -numThreads 2 -node 3 -dof 1 -file multiRecord
+
+# procedure to read the roof displacements written for a record
+
+proc readResponse {fileName} {
+    set disps {}
+    set theFile [open $fileName r]
+    while {[gets $theFile line] >= 0} {
+	if {[llength $line] == 2} {
+	    lappend disps [lindex $line 1]
+	}
+    }
+    close $theFile
+    return $disps
+}
+
+set response1 [readResponse multiRecord.1.out]
+set response2 [readResponse multiRecord.2.out]
+set response3 [readResponse multiRecord.3.out]
+file delete multiRecord.1.out multiRecord.2.out multiRecord.3.out
+
+# the same record run twice from the snapshot
+if {$response1 != $response3} {
+    set testOK -1;
+    puts "failed  repeated record> the two El Centro runs differ"
+}
+
+# each record run directly on the original model
+set formatString {%15s%15.5e%20s%15.5e}
+foreach tsTag {1 2} response [list $response1 $response2] {
+
+    buildModel
+    addRecords
+    pattern UniformExcitation 3 1 -accel $tsTag
+
+    set disps {}
+    for {set i 0} {$i < $nPts} {incr i 1} {
+	if {[analyze 1 $dt] != 0} {
+	    break
+	}
+	lappend disps [nodeDisp 3 1]
+    }
+
+    set maxU 0.0
+    set maxDiff 0.0
+    foreach u1 $disps u2 $response {
+	if {$u1 == "" || $u2 == ""} {
+	    set maxDiff 1.0e30
+	    break
+	}
+	if {abs($u1) > $maxU} {
+	    set maxU [expr abs($u1)]
+	}
+	if {abs($u1-$u2) > $maxDiff} {
+	    set maxDiff [expr abs($u1-$u2)]
+	}
+    }
+
+    puts [format $formatString "record $tsTag max:" $maxU "max difference:" $maxDiff]
+
+    if {$maxDiff > [expr $tol*$maxU] || $maxU == 0.0} {
+	set testOK -1;
+	puts "failed  record $tsTag> $maxDiff > [expr $tol*$maxU]"
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test MultiRecord.tcl \n\n"
+    puts $results "PASSED : MultiRecord.tcl"
+} else {
+    puts "\nFAILED Verification Test MultiRecord.tcl \n\n"
+    puts $results "FAILED : MultiRecord.tcl"
+}
+close $results
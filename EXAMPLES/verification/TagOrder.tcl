@@ -0,0 +1,100 @@
+# Iteration Order of the Domain Nodes and Elements
+
+# Checks that the nodes and elements of the domain are iterated in
+# ascending tag order whatever the order they were added and removed in.
+# A chain of truss bars is built with its node and element tags shuffled,
+# a spare node and element are added and removed again, and the tags
+# returned by getNodeTags and getEleTags are compared with the sorted
+# tags. The chain is then loaded axially and its elongation is compared
+# with the exact value P*L/EA.
+
+puts "TagOrder.tcl: Verification of the domain iteration order"
+puts "  - nodes and elements added out of tag order"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+set tol 1.0e-10
+
+set E 29000.0
+set A 2.0
+set L 10.0
+set P 50.0
+
+# tags of the nodes and bars along the chain, in the order they are added
+set nodeTags {40 7 1000 3 25 12 999 1 58 30}
+set eleTags  {9 2 77 5 31 1 64 18 40}
+
+wipe
+model Basic -ndm 1 -ndf 1
+
+uniaxialMaterial Elastic 1 $E
+
+set x 0.0
+foreach nodeTag $nodeTags {
+    node $nodeTag $x
+    set x [expr $x + $L]
+}
+
+set i 0
+foreach eleTag $eleTags {
+    element truss $eleTag [lindex $nodeTags $i] [lindex $nodeTags [expr $i+1]] $A 1
+    incr i 1
+}
+
+# a spare node and bar, added and removed again
+node 500 [expr -$L]
+element truss 100 500 [lindex $nodeTags 0] $A 1
+remove element 100
+remove node 500
+
+set nodeTagsOpenSees [lrange [getNodeTags] 0 end]
+set eleTagsOpenSees [lrange [getEleTags] 0 end]
+
+puts "  node tags: $nodeTagsOpenSees"
+puts "  element tags: $eleTagsOpenSees"
+
+if {$nodeTagsOpenSees != [lsort -integer $nodeTags]} {
+    set testOK -1;
+    puts "failed  node order> $nodeTagsOpenSees != [lsort -integer $nodeTags]"
+}
+if {$eleTagsOpenSees != [lsort -integer $eleTags]} {
+    set testOK -1;
+    puts "failed  element order> $eleTagsOpenSees != [lsort -integer $eleTags]"
+}
+
+# load the chain axially
+set firstNode [lindex $nodeTags 0]
+set lastNode [lindex $nodeTags end]
+fix $firstNode 1
+pattern Plain 1 Linear {
+    load $lastNode $P
+}
+
+constraints Plain
+numberer Plain
+system BandSPD
+test NormDispIncr 1.0e-12 6
+algorithm Linear
+integrator LoadControl 1.0
+analysis Static
+analyze 1
+
+set uOpenSees [nodeDisp $lastNode 1]
+set uExact [expr $P*[llength $eleTags]*$L/($E*$A)]
+
+set formatString {%20s%15.5e%10s%15.5e}
+puts [format $formatString OpenSees: $uOpenSees Exact: $uExact]
+
+if {abs($uOpenSees-$uExact) > [expr $tol*$uExact]} {
+    set testOK -1;
+    puts "failed  elongation> [expr abs($uOpenSees-$uExact)] > [expr $tol*$uExact]"
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test TagOrder.tcl \n\n"
+    puts $results "PASSED : TagOrder.tcl"
+} else {
+    puts "\nFAILED Verification Test TagOrder.tcl \n\n"
+    puts $results "FAILED : TagOrder.tcl"
+}
+close $results
@@ -0,0 +1,119 @@
+# Threaded Assembly of a Plane Stress Wall
+
+# Checks that the colored, threaded FE_Element assembly of the
+# IncrementalIntegrator (setDomainThreads) assembles the same system as
+# the serial loop. Elements of one color touch disjoint equations and
+# every entry receives its contributions in the serial order, so the
+# response must be bit identical. A cantilever wall of quad elements is
+# run through a transient analysis with Newton iterations, with 1 and 4
+# threads, for each of the systems that accept threaded assembly.
+
+puts "ThreadedAssembly.tcl: Verification of the threaded element assembly"
+puts "  - transient analysis of a quad mesh, serial and threaded"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+
+set nx 8
+set ny 24
+set width 120.0
+set height 360.0
+
+# procedure to build the wall and run the transient analysis, returning
+# the displacements of all the nodes
+
+proc shakeWall {numThreads systemType} {
+
+    global nx ny width height
+
+    wipe
+    setDomainThreads $numThreads
+
+    model Basic -ndm 2 -ndf 2
+
+    nDMaterial ElasticIsotropic 1 3600.0 0.2 2.25e-7
+
+    # nodes, a row at a time, fixed at the base
+    for {set j 0} {$j <= $ny} {incr j 1} {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    set nodeTag [expr $j*($nx+1) + $i + 1]
+	    node $nodeTag [expr $i*$width/$nx] [expr $j*$height/$ny]
+	    if {$j == 0} {
+		fix $nodeTag 1 1
+	    }
+	}
+    }
+
+    set eleTag 1
+    for {set j 0} {$j < $ny} {incr j 1} {
+	for {set i 0} {$i < $nx} {incr i 1} {
+	    set n1 [expr $j*($nx+1) + $i + 1]
+	    set n2 [expr $n1 + 1]
+	    set n3 [expr $n2 + $nx + 1]
+	    set n4 [expr $n1 + $nx + 1]
+	    element quad $eleTag $n1 $n2 $n3 $n4 12.0 PlaneStress 1
+	    incr eleTag 1
+	}
+    }
+
+    # a lateral pulse along the top of the wall
+    timeSeries Trig 1 0.0 0.5 0.25 -factor 10.0
+    pattern Plain 1 1 {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    load [expr $ny*($nx+1) + $i + 1] 1.0 0.0
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    system $systemType
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    rayleigh 0.0 0.0 0.0 0.002
+    analysis Transient
+    analyze 100 0.01
+
+    set disps {}
+    foreach nodeTag [getNodeTags] {
+	lappend disps [nodeDisp $nodeTag 1] [nodeDisp $nodeTag 2]
+    }
+
+    setDomainThreads 1
+    return $disps
+}
+
+set formatString {%20s%15.5e%20s%15.5e}
+foreach systemType {ProfileSPD BandGeneral SparseGeneral} {
+
+    set serial [shakeWall 1 $systemType]
+    set threaded [shakeWall 4 $systemType]
+
+    set maxU 0.0
+    set maxDiff 0.0
+    foreach u1 $serial u2 $threaded {
+	if {abs($u1) > $maxU} {
+	    set maxU [expr abs($u1)]
+	}
+	if {abs($u1-$u2) > $maxDiff} {
+	    set maxDiff [expr abs($u1-$u2)]
+	}
+    }
+
+    puts "  - system $systemType"
+    puts [format $formatString "max displacement:" $maxU "max difference:" $maxDiff]
+
+    if {$maxDiff != 0.0 || $maxU == 0.0} {
+	set testOK -1;
+	puts "failed  threaded assembly, system $systemType> $maxDiff != 0"
+    }
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ThreadedAssembly.tcl \n\n"
+    puts $results "PASSED : ThreadedAssembly.tcl"
+} else {
+    puts "\nFAILED Verification Test ThreadedAssembly.tcl \n\n"
+    puts $results "FAILED : ThreadedAssembly.tcl"
+}
+close $results
@@ -0,0 +1,145 @@
+# Threaded Element Update of a Nonlinear 2d Frame
+
+# Checks that the threaded element state update of Domain::update
+# (setDomainThreads) gives the same response as the serial update.
+# A steel frame of force based fiber elements is pushed well into the
+# inelastic range, once with 1 thread and once with 4. Every element of
+# the model reports itself thread safe, so the second run goes through
+# the parallel pass. Without OpenMP both runs are serial and trivially agree.
+
+puts "ThreadedFrame.tcl: Verification of the threaded element update"
+puts "  - nonlinear static pushover, serial and threaded"
+
+set testOK 0;    # variable used to keep track of SUCCESS or FAILURE
+set tol 1.0e-10
+
+set numBay 3
+set numFloor 4
+set bayWidth 240.0
+set storyHeight 144.0
+
+# procedure to build the frame and push it to a roof drift of 4%,
+# returning the displacements of all the nodes
+
+proc pushFrame {numThreads} {
+
+    global numBay numFloor bayWidth storyHeight
+
+    wipe
+    setDomainThreads $numThreads
+
+    model Basic -ndm 2 -ndf 3
+
+    # nodes, a floor at a time, fixed at the base
+    set nodeTag 1
+    for {set j 0} {$j <= $numFloor} {incr j 1} {
+	for {set i 0} {$i <= $numBay} {incr i 1} {
+	    node $nodeTag [expr $i*$bayWidth] [expr $j*$storyHeight]
+	    if {$j == 0} {
+		fix $nodeTag 1 1 1
+	    }
+	    incr nodeTag 1
+	}
+    }
+
+    # steel fiber sections
+    uniaxialMaterial Steel01 1 50.0 29000.0 0.01
+    section Fiber 1 {
+	patch rect 1 16 1 -7.0 -7.0 7.0 7.0
+    }
+    section Fiber 2 {
+	patch rect 1 16 1 -10.0 -5.0 10.0 5.0
+    }
+
+    geomTransf PDelta 1
+    geomTransf Linear 2
+
+    # columns, then beams
+    set eleTag 1
+    for {set j 0} {$j < $numFloor} {incr j 1} {
+	for {set i 0} {$i <= $numBay} {incr i 1} {
+	    set iNode [expr $j*($numBay+1) + $i + 1]
+	    set jNode [expr $iNode + $numBay + 1]
+	    element forceBeamColumn $eleTag $iNode $jNode 5 1 1
+	    incr eleTag 1
+	}
+    }
+    for {set j 1} {$j <= $numFloor} {incr j 1} {
+	for {set i 0} {$i < $numBay} {incr i 1} {
+	    set iNode [expr $j*($numBay+1) + $i + 1]
+	    element forceBeamColumn $eleTag $iNode [expr $iNode+1] 5 2 2
+	    incr eleTag 1
+	}
+    }
+
+    # gravity on the columns, then an inverted triangular lateral load
+    pattern Plain 1 Linear {
+	for {set j 1} {$j <= $numFloor} {incr j 1} {
+	    for {set i 0} {$i <= $numBay} {incr i 1} {
+		load [expr $j*($numBay+1) + $i + 1] 0.0 -20.0 0.0
+	    }
+	}
+    }
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-10 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+    analyze 10
+    loadConst -time 0.0
+
+    set roofNode [expr $numFloor*($numBay+1) + 1]
+    pattern Plain 2 Linear {
+	for {set j 1} {$j <= $numFloor} {incr j 1} {
+	    load [expr $j*($numBay+1) + 1] [expr double($j)/$numFloor] 0.0 0.0
+	}
+    }
+    set dU 0.1
+    integrator DisplacementControl $roofNode 1 $dU
+    analyze [expr int(0.04*$numFloor*$storyHeight/$dU)]
+
+    set disps {}
+    foreach nodeTag [getNodeTags] {
+	lappend disps [nodeDisp $nodeTag 1] [nodeDisp $nodeTag 2] [nodeDisp $nodeTag 3]
+    }
+
+    setDomainThreads 1
+    return $disps
+}
+
+set serial [pushFrame 1]
+set threaded [pushFrame 4]
+
+set maxU 0.0
+foreach u $serial {
+    if {abs($u) > $maxU} {
+	set maxU [expr abs($u)]
+    }
+}
+set maxDiff 0.0
+foreach u1 $serial u2 $threaded {
+    set diff [expr abs($u1-$u2)]
+    if {$diff > $maxDiff} {
+	set maxDiff $diff
+    }
+}
+
+set formatString {%20s%15.5e%20s%15.5e}
+puts [format $formatString "max displacement:" $maxU "max difference:" $maxDiff]
+
+if {$maxDiff > [expr $tol*$maxU] || $maxU == 0.0} {
+    set testOK -1;
+    puts "failed  threaded update> $maxDiff > [expr $tol*$maxU]"
+}
+
+set results [open results.out a+]
+if {$testOK == 0} {
+    puts "\nPASSED Verification Test ThreadedFrame.tcl \n\n"
+    puts $results "PASSED : ThreadedFrame.tcl"
+} else {
+    puts "\nFAILED Verification Test ThreadedFrame.tcl \n\n"
+    puts $results "FAILED : ThreadedFrame.tcl"
+}
+close $results
@@ -14,5 +14,13 @@ source EigenFrame.Extra.tcl
 source AISC25.tcl
 source PlanarShearWall.tcl
 source PinchedCylinder.tcl
+source ThreadedFrame.tcl
+source ThreadedAssembly.tcl
+source ExplicitDynamics.tcl
+source TagOrder.tcl
+source MultiRecord.tcl
+source Checkpoint.tcl
+source AMGSolver.tcl
+source ErrorControl.tcl
 
 exit
@@ -0,0 +1,368 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/MemoryChannel.cpp,v $
+
+// Written: 10/26
+// Revision: A
+//
+// Purpose: This file contains the implementation of the methods needed
+// to define the MemoryChannel class interface.
+
+#include "MemoryChannel.h"
+#include <string.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <MovableObject.h>
+
+// every item in the arena starts with this header, the data that follows
+// is padded to a multiple of 8 bytes so the next header stays aligned
+struct MemoryChannelItem {
+    int type;
+    int unused;
+    size_t numBytes;
+};
+
+enum { MSG_ITEM = 1, MATRIX_ITEM = 2, VECTOR_ITEM = 3, ID_ITEM = 4 };
+
+static inline size_t
+paddedSize(size_t numBytes)
+{
+    return (numBytes + 7) & ~((size_t)7);
+}
+
+
+MemoryChannel::MemoryChannel(int size)
+    :blocks(0), blockSizes(0), blockUsed(0), numBlocks(0), sizeBlocks(0),
+     blockSize(size > 0 ? size : 1048576),
+     writeBlock(-1), writePos(0), readBlock(0), readPos(0), numBytes(0)
+{
+
+}
+
+
+MemoryChannel::~MemoryChannel()
+{
+    for (int i=0; i<numBlocks; i++)
+	delete [] blocks[i];
+    if (blocks != 0) {
+	delete [] blocks;
+	delete [] blockSizes;
+	delete [] blockUsed;
+    }
+}
+
+
+char *
+MemoryChannel::addToProgram(void)
+{
+    return 0;
+}
+
+
+int 
+MemoryChannel::setUpConnection(void)
+{
+    return 0;
+}
+
+
+int
+MemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+    return 0;
+}
+
+
+void
+MemoryChannel::rewind(void)
+{
+    readBlock = 0;
+    readPos = 0;
+}
+
+
+void
+MemoryChannel::clear(void)
+{
+    for (int i=0; i<numBlocks; i++)
+	blockUsed[i] = 0;
+    writeBlock = -1;
+    writePos = 0;
+    readBlock = 0;
+    readPos = 0;
+    numBytes = 0;
+}
+
+
+size_t
+MemoryChannel::getNumBytes(void) const
+{
+    return numBytes;
+}
+
+
+// returns the location for the data of a new item, an item never spans
+// two blocks: if it does not fit in the current one the next is used
+char *
+MemoryChannel::putItem(int type, size_t nBytes)
+{
+    size_t itemSize = sizeof(MemoryChannelItem) + paddedSize(nBytes);
+
+    if (writeBlock < 0 || writePos + itemSize > blockSizes[writeBlock]) {
+
+	writeBlock++;
+	writePos = 0;
+	size_t newSize = itemSize > blockSize ? itemSize : blockSize;
+
+	if (writeBlock == numBlocks) {
+	    // add a block, growing the block arrays if needed
+	    if (numBlocks == sizeBlocks) {
+		int newSizeBlocks = 2*sizeBlocks + 4;
+		char **newBlocks = new char *[newSizeBlocks];
+		size_t *newBlockSizes = new size_t[newSizeBlocks];
+		size_t *newBlockUsed = new size_t[newSizeBlocks];
+		for (int i=0; i<numBlocks; i++) {
+		    newBlocks[i] = blocks[i];
+		    newBlockSizes[i] = blockSizes[i];
+		    newBlockUsed[i] = blockUsed[i];
+		}
+		if (blocks != 0) {
+		    delete [] blocks;
+		    delete [] blockSizes;
+		    delete [] blockUsed;
+		}
+		blocks = newBlocks;
+		blockSizes = newBlockSizes;
+		blockUsed = newBlockUsed;
+		sizeBlocks = newSizeBlocks;
+	    }
+	    blocks[numBlocks] = new char[newSize];
+	    blockSizes[numBlocks] = newSize;
+	    numBlocks++;
+
+	} else if (blockSizes[writeBlock] < itemSize) {
+	    // a block kept from before clear() that is too small
+	    delete [] blocks[writeBlock];
+	    blocks[writeBlock] = new char[newSize];
+	    blockSizes[writeBlock] = newSize;
+	}
+
+	blockUsed[writeBlock] = 0;
+    }
+
+    char *theItem = blocks[writeBlock] + writePos;
+    MemoryChannelItem header;
+    header.type = type;
+    header.unused = 0;
+    header.numBytes = nBytes;
+    memcpy(theItem, &header, sizeof(MemoryChannelItem));
+
+    writePos += itemSize;
+    blockUsed[writeBlock] = writePos;
+    numBytes += itemSize;
+
+    return theItem + sizeof(MemoryChannelItem);
+}
+
+
+// returns the data of the next item, checking it is of the type and 
+// size expected
+const char *
+MemoryChannel::getItem(int type, size_t nBytes, const char *method)
+{
+    while (readBlock <= writeBlock && readPos >= blockUsed[readBlock]) {
+	readBlock++;
+	readPos = 0;
+    }
+
+    if (readBlock > writeBlock) {
+	opserr << "MemoryChannel::" << method << "() - no data left to receive\n";
+	return 0;
+    }
+
+    const char *theItem = blocks[readBlock] + readPos;
+    MemoryChannelItem header;
+    memcpy(&header, theItem, sizeof(MemoryChannelItem));
+
+    if (header.type != type) {
+	opserr << "MemoryChannel::" << method << "() - the data sent is of another type\n";
+	return 0;
+    }
+    if (nBytes != (size_t)-1 && header.numBytes != nBytes) {
+	opserr << "MemoryChannel::" << method << "() - " << (int)header.numBytes
+	       << " bytes were sent, " << (int)nBytes << " expected\n";
+	return 0;
+    }
+
+    readPos += sizeof(MemoryChannelItem) + paddedSize(header.numBytes);
+
+    return theItem + sizeof(MemoryChannelItem);
+}
+
+
+int 
+MemoryChannel::sendObj(int commitTag,
+		       MovableObject &theObject, 
+		       ChannelAddress *theAddress)
+{
+    return theObject.sendSelf(commitTag, *this);
+}
+
+
+int 
+MemoryChannel::recvObj(int commitTag,
+		       MovableObject &theObject, 
+		       FEM_ObjectBroker &theBroker, 
+		       ChannelAddress *theAddress)
+{
+    return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int 
+MemoryChannel::sendMsg(int dbTag, int commitTag, 
+		       const Message &msg, 
+		       ChannelAddress *theAddress)
+{
+    char *data = this->putItem(MSG_ITEM, msg.length);
+    if (msg.length > 0)
+	memcpy(data, msg.data, msg.length);
+    return 0;
+}
+
+
+int 
+MemoryChannel::recvMsg(int dbTag, int commitTag, 
+		       Message &msg, 
+		       ChannelAddress *theAddress)
+{
+    const char *data = this->getItem(MSG_ITEM, msg.length, "recvMsg");
+    if (data == 0)
+	return -1;
+    if (msg.length > 0)
+	memcpy(msg.data, data, msg.length);
+    return 0;
+}
+
+
+// the message is set to point to the data in the arena, no copy is made;
+// the data stays valid until the channel is cleared or destroyed
+int 
+MemoryChannel::recvMsgUnknownSize(int dbTag, int commitTag, 
+				  Message &msg, 
+				  ChannelAddress *theAddress)
+{
+    const char *data = this->getItem(MSG_ITEM, (size_t)-1, "recvMsgUnknownSize");
+    if (data == 0)
+	return -1;
+    MemoryChannelItem header;
+    memcpy(&header, data - sizeof(MemoryChannelItem), sizeof(MemoryChannelItem));
+    msg.setData((char *)data, (int)header.numBytes);
+    return 0;
+}
+
+
+int 
+MemoryChannel::sendMatrix(int dbTag, int commitTag, 
+			  const Matrix &theMatrix, 
+			  ChannelAddress *theAddress)
+{
+    size_t nBytes = theMatrix.dataSize * sizeof(double);
+    char *data = this->putItem(MATRIX_ITEM, nBytes);
+    if (nBytes > 0)
+	memcpy(data, theMatrix.data, nBytes);
+    return 0;
+}
+
+
+int 
+MemoryChannel::recvMatrix(int dbTag, int commitTag, 
+			  Matrix &theMatrix, 
+			  ChannelAddress *theAddress)
+{
+    size_t nBytes = theMatrix.dataSize * sizeof(double);
+    const char *data = this->getItem(MATRIX_ITEM, nBytes, "recvMatrix");
+    if (data == 0)
+	return -1;
+    if (nBytes > 0)
+	memcpy(theMatrix.data, data, nBytes);
+    return 0;
+}
+
+
+int 
+MemoryChannel::sendVector(int dbTag, int commitTag, 
+			  const Vector &theVector, 
+			  ChannelAddress *theAddress)
+{
+    size_t nBytes = theVector.sz * sizeof(double);
+    char *data = this->putItem(VECTOR_ITEM, nBytes);
+    if (nBytes > 0)
+	memcpy(data, theVector.theData, nBytes);
+    return 0;
+}
+
+
+int 
+MemoryChannel::recvVector(int dbTag, int commitTag, 
+			  Vector &theVector, 
+			  ChannelAddress *theAddress)
+{
+    size_t nBytes = theVector.sz * sizeof(double);
+    const char *data = this->getItem(VECTOR_ITEM, nBytes, "recvVector");
+    if (data == 0)
+	return -1;
+    if (nBytes > 0)
+	memcpy(theVector.theData, data, nBytes);
+    return 0;
+}
+
+
+int 
+MemoryChannel::sendID(int dbTag, int commitTag, 
+		      const ID &theID, 
+		      ChannelAddress *theAddress)
+{
+    size_t nBytes = theID.sz * sizeof(int);
+    char *data = this->putItem(ID_ITEM, nBytes);
+    if (nBytes > 0)
+	memcpy(data, theID.data, nBytes);
+    return 0;
+}
+
+
+int 
+MemoryChannel::recvID(int dbTag, int commitTag, 
+		      ID &theID, 
+		      ChannelAddress *theAddress)
+{
+    size_t nBytes = theID.sz * sizeof(int);
+    const char *data = this->getItem(ID_ITEM, nBytes, "recvID");
+    if (data == 0)
+	return -1;
+    if (nBytes > 0)
+	memcpy(theID.data, data, nBytes);
+    return 0;
+}
@@ -0,0 +1,121 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/MemoryChannel.h,v $
+
+// Written: 10/26
+// Revision: A
+//
+// Purpose: This file contains the class definition for MemoryChannel.
+// MemoryChannel is a sub-class of channel for communication within a
+// process. Everything sent is appended to an arena of memory blocks and
+// is received in the order it was sent, as for a stream socket; dbTags
+// and commitTags are ignored. The contents of a Matrix, Vector, ID or
+// Message are moved with a single memcpy, and the data can be received
+// any number of times after a rewind(), which makes the channel suitable
+// for copying and checkpointing objects through sendSelf()/recvSelf().
+
+#ifndef MemoryChannel_h
+#define MemoryChannel_h
+
+#include <Channel.h>
+#include <stddef.h>
+
+class MemoryChannel : public Channel
+{
+  public:
+    MemoryChannel(int blockSize = 1048576);
+    ~MemoryChannel();
+
+    char *addToProgram(void);
+    
+    virtual int setUpConnection(void);
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    virtual ChannelAddress *getLastSendersAddress(void){ return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+		
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+
+    // methods to reuse the data and the memory
+    void rewind(void);             // receive again from the start
+    void clear(void);              // discard the data, keep the blocks
+    size_t getNumBytes(void) const;
+    
+  protected:
+    
+  private:
+    char *putItem(int type, size_t numBytes);
+    const char *getItem(int type, size_t numBytes, const char *method);
+    
+    // the arena: blocks are only added, never moved, so data handed
+    // out by recvMsgUnknownSize() stays valid until clear()
+    char **blocks;
+    size_t *blockSizes;            // bytes allocated in each block
+    size_t *blockUsed;             // bytes sent into each block
+    int numBlocks, sizeBlocks;
+    size_t blockSize;
+
+    int writeBlock;                // block and offset of the next send
+    size_t writePos;
+    int readBlock;                 // block and offset of the next recv
+    size_t readPos;
+    size_t numBytes;
+};
+
+#endif 
@@ -52,6 +52,8 @@ class Message
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class MemoryChannel;
+    friend class CheckpointDatastore;
     
   private:
     int length;
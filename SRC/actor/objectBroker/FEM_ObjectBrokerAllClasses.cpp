@@ -691,9 +691,13 @@
 #include "LinearSOE.h"
 #include "DomainSolver.h"
 #include "fullGEN/FullGenLinSOE.h"
+#include "fullGEN/FullGenLinLapackSolver.h"
 #include "bandGEN/BandGenLinSOE.h"
+#include "bandGEN/BandGenLinLapackSolver.h"
 #include "bandSPD/BandSPDLinSOE.h"
+#include "bandSPD/BandSPDLinLapackSolver.h"
 #include "profileSPD/ProfileSPDLinSOE.h"
+#include "profileSPD/ProfileSPDLinDirectSolver.h"
 #include "profileSPD/ProfileSPDLinSubstrSolver.h"
 #include "sparseGEN/SparseGenColLinSOE.h"
 #include "DomainDecompositionAnalysis.h"
@@ -3149,6 +3153,23 @@ FEM_ObjectBrokerAllClasses::getNewLinearSOE(int classTagSOE)
 	  theSOE = new SparseGenColLinSOE();
 	  return theSOE;
 
+	// the sequential systems come with their default solver
+	case LinSOE_TAGS_FullGenLinSOE:  
+	  theSOE = new FullGenLinSOE(*(new FullGenLinLapackSolver()));
+	  return theSOE;
+
+	case LinSOE_TAGS_BandGenLinSOE:  
+	  theSOE = new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+	  return theSOE;
+
+	case LinSOE_TAGS_BandSPDLinSOE:  
+	  theSOE = new BandSPDLinSOE(*(new BandSPDLinLapackSolver()));
+	  return theSOE;
+
+	case LinSOE_TAGS_ProfileSPDLinSOE:  
+	  theSOE = new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+	  return theSOE;
+
 
 #ifdef _PARALLEL_PROCESSING
 
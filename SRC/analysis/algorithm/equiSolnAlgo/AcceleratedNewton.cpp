@@ -138,15 +138,18 @@ AcceleratedNewton::solveCurrentStep(void)
     return -2;
   }
 
-  // Evaluate system Jacobian J = R'(y)|y_0
-  if (theIntegrator->formTangent(tangent) < 0){
-    opserr << "WARNING AcceleratedNewton::solveCurrentStep() -";
-    opserr << "the Integrator failed in formTangent()\n";
-    return -1;
-  }
+  // Evaluate system Jacobian J = R'(y)|y_0, unless the factorization
+  // of a previous step is kept
+  if (this->keepTangent() == false) {
+    if (theIntegrator->formTangent(tangent) < 0){
+      opserr << "WARNING AcceleratedNewton::solveCurrentStep() -";
+      opserr << "the Integrator failed in formTangent()\n";
+      return -1;
+    }
   
-  // Count factorization of the first tangent
-  numFactorizations++;
+    // Count factorization of the first tangent
+    numFactorizations++;
+  }
   
   // set itself as the ConvergenceTest objects EquiSolnAlgo
   theTest->setEquiSolnAlgo(*this);
@@ -237,6 +240,8 @@ AcceleratedNewton::solveCurrentStep(void)
     opserr << "The ConvergenceTest object failed in test()\n";
     return -3;
   }
+
+  this->checkTangentReuse(result);
   
   // note - if positive result we are returning what the convergence
   // test returned which should be the number of iterations
@@ -42,6 +42,8 @@ void* OPS_BFGS()
 {
     int formTangent = CURRENT_TANGENT;
     int count = -1;
+    double reuseRate = 0.0;
+    int reuseSteps = 0;
 
     while (OPS_GetNumRemainingInputArgs() > 0) {
 	const char* flag = OPS_GetString();
@@ -58,13 +60,33 @@ void* OPS_BFGS()
 		opserr << "WARNING Broyden failed to read count\n";
 		return 0;
 	    }
+	} else if (strcmp(flag,"-reuse") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    int numdata = 1;
+	    if (OPS_GetDoubleInput(&numdata, &reuseRate) < 0) {
+		opserr << "WARNING BFGS failed to read reuse rate\n";
+		return 0;
+	    }
+	    if (OPS_GetNumRemainingInputArgs() > 0) {
+		int numRemaining = OPS_GetNumRemainingInputArgs();
+		if (OPS_GetIntInput(&numdata, &reuseSteps) < 0) {
+		    if (OPS_GetNumRemainingInputArgs() < numRemaining)
+			OPS_ResetCurrentInputArg(-1);
+		    reuseSteps = 0;
+		}
+	    }
 	}
     }
 
+    BFGS *theAlgo;
     if (count == -1)
-	return new BFGS(formTangent); 
+	theAlgo = new BFGS(formTangent); 
     else
-	return new BFGS(formTangent, count);
+	theAlgo = new BFGS(formTangent, count);
+
+    if (reuseRate > 0.0)
+	theAlgo->setTangentReuse(reuseRate, reuseSteps);
+
+    return theAlgo;
 }
 
 // Constructor
@@ -252,11 +274,14 @@ BFGS::solveCurrentStep(void)
 
       // opserr << "      BFGS -- Forming New Tangent" << endln;
 
-      //form the initial tangent
-      if (theIntegrator->formTangent(tangent) < 0){
-         opserr << "WARNING BFGS::solveCurrentStep() -";
-         opserr << "the Integrator failed in formTangent()\n";
-         return -1; 
+      //form the initial tangent, that of the first pass may be kept
+      //from a previous step
+      if (count > 0 || this->keepTangent() == false) {
+        if (theIntegrator->formTangent(tangent) < 0){
+           opserr << "WARNING BFGS::solveCurrentStep() -";
+           opserr << "the Integrator failed in formTangent()\n";
+           return -1; 
+        }
       }
 
       //form the initial residual 
@@ -387,6 +412,8 @@ BFGS::solveCurrentStep(void)
       return -3;
     }
 
+    this->checkTangentReuse(result);
+
     // note - if positive result we are returning what the convergence test returned
     // which should be the number of iterations
     return result;
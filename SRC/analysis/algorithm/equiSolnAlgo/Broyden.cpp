@@ -48,6 +48,8 @@ void* OPS_Broyden()
 {
     int formTangent = CURRENT_TANGENT;
     int count = -1;
+    double reuseRate = 0.0;
+    int reuseSteps = 0;
 
     while (OPS_GetNumRemainingInputArgs() > 0) {
 	const char* flag = OPS_GetString();
@@ -64,13 +66,33 @@ void* OPS_Broyden()
 		opserr << "WARNING Broyden failed to read count\n";
 		return 0;
 	    }
+	} else if (strcmp(flag,"-reuse") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    int numdata = 1;
+	    if (OPS_GetDoubleInput(&numdata, &reuseRate) < 0) {
+		opserr << "WARNING Broyden failed to read reuse rate\n";
+		return 0;
+	    }
+	    if (OPS_GetNumRemainingInputArgs() > 0) {
+		int numRemaining = OPS_GetNumRemainingInputArgs();
+		if (OPS_GetIntInput(&numdata, &reuseSteps) < 0) {
+		    if (OPS_GetNumRemainingInputArgs() < numRemaining)
+			OPS_ResetCurrentInputArg(-1);
+		    reuseSteps = 0;
+		}
+	    }
 	}
     }
 
+    Broyden *theAlgo;
     if (count == -1)
-	return new Broyden(formTangent); 
+	theAlgo = new Broyden(formTangent); 
     else
-	return new Broyden(formTangent, count); 
+	theAlgo = new Broyden(formTangent, count);
+
+    if (reuseRate > 0.0)
+	theAlgo->setTangentReuse(reuseRate, reuseSteps);
+
+    return theAlgo;
 }
 
 // Constructor
@@ -231,11 +253,14 @@ Broyden::solveCurrentStep(void)
 
       // opserr << "      Broyden -- Forming New Tangent" << endln ;
 
-      //form the initial tangent
-      if (theIntegrator->formTangent(tangent) < 0){
-         opserr << "WARNING Broyden::solveCurrentStep() -";
-         opserr << "the Integrator failed in formTangent()\n";
-         return -1; 
+      //form the initial tangent, that of the first pass may be kept
+      //from a previous step
+      if (count > 0 || this->keepTangent() == false) {
+        if (theIntegrator->formTangent(tangent) < 0){
+           opserr << "WARNING Broyden::solveCurrentStep() -";
+           opserr << "the Integrator failed in formTangent()\n";
+           return -1; 
+        }
       }
 
       //form the initial residual 
@@ -370,6 +395,8 @@ Broyden::solveCurrentStep(void)
       return -3;
     }
 
+    this->checkTangentReuse(result);
+
 
     // note - if positive result we are returning what the convergence test returned
     // which should be the number of iterations
@@ -44,10 +44,14 @@
 #include <IncrementalIntegrator.h>
 #include <LinearSOE.h>
 #include <ConvergenceTest.h>
+#include <Vector.h>
+#include <math.h>
 
 EquiSolnAlgo::EquiSolnAlgo(int clasTag)
 :SolutionAlgorithm(clasTag),
- theModel(0), theIntegrator(0), theSysOfEqn(0), theTest(0)
+ theModel(0), theIntegrator(0), theSysOfEqn(0), theTest(0),
+ reuseMaxRate(0.0), reuseMaxSteps(0), reuseSteps(0), reuseEqnStamp(-1),
+ reuseRefresh(true), numFactSaved(0)
 {
 
 }
@@ -86,6 +90,75 @@ EquiSolnAlgo::getConvergenceTest(void)
 }
 
 
+int
+EquiSolnAlgo::setTangentReuse(double maxRate, int maxSteps)
+{
+  reuseMaxRate = maxRate;
+  reuseMaxSteps = maxSteps;
+  reuseRefresh = true;
+  return 0;
+}
+
+
+int
+EquiSolnAlgo::getNumFactorizationsSaved(void)
+{
+  return numFactSaved;
+}
+
+
+bool
+EquiSolnAlgo::keepTangent(void)
+{
+  if (reuseMaxRate <= 0.0 || theModel == 0)
+    return false;
+
+  // the factorization must be of the current numbering and the last
+  // step must have converged at an acceptable rate
+  int stamp = theModel->getEqnStamp();
+  bool keep = (reuseRefresh == false && stamp == reuseEqnStamp &&
+	       (reuseMaxSteps <= 0 || reuseSteps < reuseMaxSteps));
+
+  // until checkTangentReuse() is invoked with a converged step, such
+  // as when the step is abandoned on an error, the next step refreshes
+  reuseRefresh = true;
+
+  if (keep == true) {
+    reuseSteps++;
+    numFactSaved++;
+    return true;
+  }
+
+  reuseEqnStamp = stamp;
+  reuseSteps = 0;
+  return false;
+}
+
+
+void
+EquiSolnAlgo::checkTangentReuse(int result)
+{
+  if (reuseMaxRate <= 0.0 || theTest == 0)
+    return;
+
+  reuseRefresh = true;
+  if (result < 0)
+    return;
+
+  // geometric mean of the ratio of successive norms over the step
+  double rate = 0.0;
+  int numTests = theTest->getNumTests();
+  const Vector &norms = theTest->getNorms();
+  if (numTests > norms.Size())
+    numTests = norms.Size();
+  if (numTests > 1 && norms(0) > 0.0)
+    rate = pow(norms(numTests-1)/norms(0), 1.0/(numTests-1));
+
+  if (rate <= reuseMaxRate)
+    reuseRefresh = false;
+}
+
+
 
 
 AnalysisModel *
@@ -75,6 +75,13 @@ class EquiSolnAlgo: public SolutionAlgorithm
     virtual double getSolveTimeReal(void)  {return 0.0;}
     virtual double getAccelTimeCPU(void)   {return 0.0;}
     virtual double getAccelTimeReal(void)  {return 0.0;}
+
+    // tangent reuse across steps: the factorization is kept from one
+    // step to the next while the steps converge at a rate (geometric
+    // mean ratio of successive test norms) no larger than maxRate, and
+    // for at most maxSteps steps if maxSteps > 0; maxRate <= 0 disables
+    virtual int setTangentReuse(double maxRate, int maxSteps = 0);
+    virtual int getNumFactorizationsSaved(void);
  
     // the following are not protected as convergence test
     // may need access to them
@@ -83,12 +90,25 @@ class EquiSolnAlgo: public SolutionAlgorithm
     LinearSOE	            *getLinearSOEptr(void) const;
 
   protected:
+    // invoked by the subclasses supporting tangent reuse, keepTangent()
+    // at the start of a step instead of forming the tangent when it
+    // returns true, checkTangentReuse() with the result of the step
+    bool keepTangent(void);
+    void checkTangentReuse(int result);
+
     ConvergenceTest *theTest;
     
   private:
     AnalysisModel 	  *theModel;
     IncrementalIntegrator *theIntegrator;
     LinearSOE 		  *theSysOfEqn;
+
+    double reuseMaxRate;      // largest acceptable convergence rate
+    int    reuseMaxSteps;     // max steps a factorization is kept, 0 no limit
+    int    reuseSteps;        // steps the current factorization was kept
+    int    reuseEqnStamp;     // equation numbering the tangent was formed for
+    bool   reuseRefresh;      // flag to form the tangent at the next step
+    int    numFactSaved;      // steps that kept the tangent
 };
 
 #endif
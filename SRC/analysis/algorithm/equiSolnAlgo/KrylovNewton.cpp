@@ -158,12 +158,15 @@ KrylovNewton::solveCurrentStep(void)
   }
   
   
-  // Evaluate system Jacobian J = R'(y)|y_0
-  if (theIntegrator->formTangent(tangent) < 0){
-    opserr << "WARNING KrylovNewton::solveCurrentStep() -";
-    opserr << "the Integrator failed in formTangent()\n";
-    return -1;
-  }    
+  // Evaluate system Jacobian J = R'(y)|y_0, unless the factorization
+  // of a previous step is kept
+  if (this->keepTangent() == false) {
+    if (theIntegrator->formTangent(tangent) < 0){
+      opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+      opserr << "the Integrator failed in formTangent()\n";
+      return -1;
+    }
+  }
 
   // Loop counter
   int k = 1;
@@ -226,6 +229,8 @@ KrylovNewton::solveCurrentStep(void)
     opserr << "the ConvergenceTest object failed in test()\n";
     return -3;
   }
+
+  this->checkTangentReuse(result);
   
   // note - if positive result we are returning what the convergence
   // test returned which should be the number of iterations
@@ -55,8 +55,10 @@ void* OPS_ModifiedNewton()
   int factoronce = 0;
   double iFactor = 0;
   double cFactor = 1;
+  double reuseRate = 0.0;
+  int reuseSteps = 0;
 
-  if (OPS_GetNumRemainingInputArgs() > 0) {
+  while (OPS_GetNumRemainingInputArgs() > 0) {
     const char* type = OPS_GetString();
     if (strcmp(type,"-secant") == 0) {
       formTangent = CURRENT_SECANT;
@@ -78,10 +80,28 @@ void* OPS_ModifiedNewton()
         iFactor = data[0];
         cFactor = data[1];
       }
+    } else if (strcmp(type,"-reuse") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+      int numData = 1;
+      if (OPS_GetDoubleInput(&numData, &reuseRate) < 0) {
+        opserr << "WARNING ModifiedNewton failed to read reuse rate\n";
+        return 0;
+      }
+      if (OPS_GetNumRemainingInputArgs() > 0) {
+        int numRemaining = OPS_GetNumRemainingInputArgs();
+        if (OPS_GetIntInput(&numData, &reuseSteps) < 0) {
+          if (OPS_GetNumRemainingInputArgs() < numRemaining)
+            OPS_ResetCurrentInputArg(-1);
+          reuseSteps = 0;
+        }
+      }
     }
   }
   
-  return new ModifiedNewton(formTangent, iFactor, cFactor,factoronce);
+  ModifiedNewton *theAlgo = new ModifiedNewton(formTangent, iFactor, cFactor,factoronce);
+  if (reuseRate > 0.0)
+    theAlgo->setTangentReuse(reuseRate, reuseSteps);
+
+  return theAlgo;
 }
 
 // Constructor
@@ -133,7 +153,7 @@ ModifiedNewton::solveCurrentStep(void)
     }	
 
     SOLUTION_ALGORITHM_tangentFlag = tangent;
-    if (factorOnce!=2) {
+    if (factorOnce!=2 && this->keepTangent() == false) {
       if (theIncIntegratorr->formTangent(tangent, iFactor, cFactor) < 0){
         opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
         opserr << "the Integrator failed in formTangent()\n";
@@ -195,6 +215,8 @@ ModifiedNewton::solveCurrentStep(void)
       }
       return -3;
     }
+
+    this->checkTangentReuse(result);
     return result;
 }
 
@@ -79,6 +79,7 @@ DirectIntegrationAnalysis::DirectIntegrationAnalysis(Domain &the_Domain,
  theIntegrator(&theTransientIntegrator), 
  theTest(theConvergenceTest),
  domainStamp(0),
+ modelStamp(0),
  numSubLevels(num_SubLevels),
  numSubSteps(num_SubSteps)
 {
@@ -395,6 +396,19 @@ DirectIntegrationAnalysis::domainChanged(void)
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
 
+    // if elements have only been removed since the model was built
+    // their FE_Elements are dropped and the numbering and the system
+    // structure are kept, the removed entries simply no longer assembled
+    ID removedEles(0, 8);
+    if (modelStamp != 0 && the_Domain->getRemovedElements(modelStamp, removedEles) == true &&
+	theConstraintHandler->removeElements(removedEles) == 0) {
+	modelStamp = stamp;
+	theIntegrator->domainChanged();
+	theAlgorithm->domainChanged();
+	return 0;
+    }
+    modelStamp = 0;
+
     theAnalysisModel->clearAll();    
     theConstraintHandler->clearAll();
     
@@ -436,6 +450,7 @@ DirectIntegrationAnalysis::domainChanged(void)
     theIntegrator->domainChanged();
     theAlgorithm->domainChanged();
 
+    modelStamp = stamp;
     return 0;
 }    
 
@@ -452,6 +467,7 @@ DirectIntegrationAnalysis::setNumberer(DOF_Numberer &theNewNumberer)
 
     // invoke domainChanged() either indirectly or directly
     domainStamp = 0;
+    modelStamp = 0;
     return 0;
 }
 
@@ -517,6 +533,7 @@ DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
   
   // cause domainChanged to be invoked on next analyze
   domainStamp = 0;
+  modelStamp = 0;
   
   return 0;
 }
@@ -544,6 +561,7 @@ DirectIntegrationAnalysis::setEigenSOE(EigenSOE &theNewSOE)
     }
     */
     domainStamp = 0;
+    modelStamp = 0;
   }
  
   return 0;
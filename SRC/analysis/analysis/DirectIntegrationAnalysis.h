@@ -101,6 +101,7 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     ConvergenceTest     *theTest;
 
     int domainStamp;
+    int modelStamp;     // stamp the AnalysisModel was built for, 0 if none
     int numSubLevels;
     int numSubSteps;
 
@@ -0,0 +1,666 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ExplicitDynamicsAnalysis.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the implementation of ExplicitDynamicsAnalysis.
+
+#include <ExplicitDynamicsAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <EarthquakePattern.h>
+#include <elementAPI.h>
+#include <OPS_Globals.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+namespace {
+
+	// DOF flags; inactive DOFs have neither mass nor stiffness, e.g. the
+	// rotations of a node only connected to truss elements
+	enum DOF_Flag { FreeDOF = 0, FixedDOF = 1, InactiveDOF = 2 };
+
+	// the engine is kept between invocations of the command so that the
+	// element map, the colors and the stable time step are only formed
+	// again when the domain changes; wipe and wipeAnalysis delete it
+	ExplicitDynamicsAnalysis* theExplicitAnalysis = 0;
+
+}
+
+void
+OPS_wipeExplicitDynamicsAnalysis(void)
+{
+	if (theExplicitAnalysis != 0) {
+		delete theExplicitAnalysis;
+		theExplicitAnalysis = 0;
+	}
+}
+
+int
+OPS_ExplicitDynamicsAnalysis(void)
+{
+	// explicitDynamicsAnalysis $numSteps <$dt> <-safety $factor>
+
+	Domain* theDomain = OPS_GetDomain();
+	if (theDomain == nullptr) {
+		opserr << "ExplicitDynamicsAnalysis Error: no Domain available.\n";
+		return -1;
+	}
+
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+		opserr << "ExplicitDynamicsAnalysis $numSteps <$dt> <-safety $factor>\n"
+			"Error: at least 1 argument should be provided.\n";
+		return -1;
+	}
+
+	// num data
+	int numData = 1;
+
+	int numSteps;
+	if (OPS_GetInt(&numData, &numSteps) < 0 || numSteps < 1) {
+		opserr << "ExplicitDynamicsAnalysis Error: Failed to get a positive number of steps.\n";
+		return -1;
+	}
+
+	// optional time step, the stable one is used if it is not given
+	double dt = 0.0;
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+		auto old_num_rem = OPS_GetNumRemainingInputArgs();
+		if (OPS_GetDoubleInput(&numData, &dt) < 0) {
+			auto new_num_rem = OPS_GetNumRemainingInputArgs();
+			if (new_num_rem < old_num_rem)
+				OPS_ResetCurrentInputArg(-1);
+			dt = 0.0;
+		}
+	}
+
+	double safety = 0.9;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+		const char* value = OPS_GetString();
+		if (strcmp(value, "-safety") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDouble(&numData, &safety) < 0 ||
+				safety <= 0.0 || safety > 1.0) {
+				opserr << "ExplicitDynamicsAnalysis Error: Failed to get a safety factor in (0,1].\n";
+				return -1;
+			}
+		}
+		else {
+			opserr << "ExplicitDynamicsAnalysis Error: unknown option " << value << ".\n";
+			return -1;
+		}
+	}
+
+	if (theExplicitAnalysis != 0 && theExplicitAnalysis->getDomainPtr() != theDomain) {
+		delete theExplicitAnalysis;
+		theExplicitAnalysis = 0;
+	}
+	if (theExplicitAnalysis == 0)
+		theExplicitAnalysis = new ExplicitDynamicsAnalysis(theDomain, safety);
+	else
+		theExplicitAnalysis->setSafetyFactor(safety);
+
+	return theExplicitAnalysis->analyze(numSteps, dt);
+}
+
+ExplicitDynamicsAnalysis::ExplicitDynamicsAnalysis(Domain* theDomain, double safety)
+	: m_domain(theDomain)
+	, m_safety(safety)
+	, m_stamp(-1)
+	, m_num_threads(1)
+	, m_num_dof(0)
+	, m_stable_dt(0.0)
+{
+
+}
+
+ExplicitDynamicsAnalysis::~ExplicitDynamicsAnalysis()
+{
+}
+
+void ExplicitDynamicsAnalysis::setSafetyFactor(double safety)
+{
+	m_safety = safety;
+}
+
+double ExplicitDynamicsAnalysis::getStableTimeStep(void)
+{
+	int stamp = m_domain->hasDomainChanged();
+	if (stamp != m_stamp || !isCurrent()) {
+		m_stamp = -1;
+		if (setup() < 0)
+			return 0.0;
+		m_stamp = stamp;
+	}
+	return m_stable_dt;
+}
+
+bool ExplicitDynamicsAnalysis::isCurrent()
+{
+	// the domain stamp starts again from 0 when the domain is cleared, so
+	// a matching stamp alone does not mean the cached nodes, elements and
+	// constraints are still alive; they are compared, by address and tag,
+	// with those of the domain without dereferencing the cached pointers
+	if ((int)m_nodes.size() != m_domain->getNumNodes() ||
+		(int)m_domain_elements.size() != m_domain->getNumElements())
+		return false;
+
+	std::size_t k = 0;
+	Node* node;
+	NodeIter& theNodes = m_domain->getNodes();
+	while ((node = theNodes()) != 0) {
+		if (k == m_nodes.size() || node != m_nodes[k] || node->getTag() != m_node_tags[k])
+			return false;
+		k++;
+	}
+
+	k = 0;
+	Element* ele;
+	ElementIter& theEles = m_domain->getElements();
+	while ((ele = theEles()) != 0) {
+		if (k == m_domain_elements.size() || ele != m_domain_elements[k] || ele->getTag() != m_ele_tags[k])
+			return false;
+		k++;
+	}
+
+	k = 0;
+	SP_Constraint* sp;
+	SP_ConstraintIter& theSPs = m_domain->getDomainAndLoadPatternSPs();
+	while ((sp = theSPs()) != 0) {
+		if (k == m_all_sps.size() || sp != m_all_sps[k] || sp->getTag() != m_sp_tags[k])
+			return false;
+		k++;
+	}
+
+	return k == m_all_sps.size();
+}
+
+Domain* ExplicitDynamicsAnalysis::getDomainPtr(void) const
+{
+	return m_domain;
+}
+
+int ExplicitDynamicsAnalysis::analyze(int numSteps, double dt)
+{
+	m_num_threads = m_domain->getNumThreads();
+
+	// patterns may be added without the domain being marked as changed
+	if (checkLoadPatterns() < 0)
+		return -1;
+
+	// form the arrays again if the model has changed
+	int stamp = m_domain->hasDomainChanged();
+	if (stamp != m_stamp || !isCurrent()) {
+		m_stamp = -1;
+		if (setup() < 0)
+			return -1;
+		m_stamp = stamp;
+	}
+
+	double stable_dt = m_safety * m_stable_dt;
+	if (dt <= 0.0) {
+		if (stable_dt <= 0.0) {
+			opserr << "ExplicitDynamicsAnalysis::analyze() - no stable time step could be estimated, provide one.\n";
+			return -1;
+		}
+		dt = stable_dt;
+	}
+	else if (stable_dt > 0.0 && dt > m_stable_dt) {
+		opserr << "ExplicitDynamicsAnalysis::analyze() - WARNING time step " << dt
+			<< " exceeds the estimated stable time step " << m_stable_dt << "\n";
+	}
+
+	int n = m_num_dof;
+	double* u = m_u.data();
+	double* v = m_v.data();
+	double* a = m_a.data();
+	const char* fixed = m_fixed.data();
+	double halfDt = 0.5 * dt;
+
+	// start from the committed response; the acceleration is formed from
+	// the forces so that loads changed since the last call are accounted for
+	for (std::size_t k = 0; k < m_nodes.size(); ++k) {
+		Node* node = m_nodes[k];
+		const Vector& disp = node->getDisp();
+		const Vector& vel = node->getVel();
+		int start = m_node_start[k];
+		for (int i = 0; i < disp.Size(); ++i) {
+			u[start + i] = disp(i);
+			v[start + i] = vel(i);
+		}
+	}
+
+	double time = m_domain->getCurrentTime();
+	setTrialResponse(u, v, m_zero.data());
+	m_domain->applyLoad(time);
+	if (m_domain->update() != 0) {
+		opserr << "ExplicitDynamicsAnalysis::analyze() - the Domain failed in update at time " << time << "\n";
+		return -1;
+	}
+	formAccel(v, a);
+
+	for (int step = 0; step < numSteps; ++step) {
+
+		// new loads and constraint values
+		time += dt;
+		m_domain->applyLoad(time);
+
+		// v(n+1/2) = v(n) + dt/2 a(n), u(n+1) = u(n) + dt v(n+1/2)
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(static) if (m_num_threads > 1)
+#endif
+		for (int i = 0; i < n; ++i) {
+			if (fixed[i] == FreeDOF) {
+				v[i] += halfDt * a[i];
+				u[i] += dt * v[i];
+			}
+		}
+		imposeConstraints(dt, u, v);
+
+		// element state at u(n+1), v(n+1/2)
+		setTrialResponse(u, v, m_zero.data());
+		if (m_domain->update() != 0) {
+			opserr << "ExplicitDynamicsAnalysis::analyze() - the Domain failed in update at time " << time << "\n";
+			return -1;
+		}
+
+		// a(n+1) = M^-1 (P - F - C v(n+1/2)), v(n+1) = v(n+1/2) + dt/2 a(n+1)
+		formAccel(v, a);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(static) if (m_num_threads > 1)
+#endif
+		for (int i = 0; i < n; ++i) {
+			if (fixed[i] == FreeDOF)
+				v[i] += halfDt * a[i];
+		}
+		setTrialResponse(0, v, a);
+
+		// commit domain, the recorders are invoked here
+		if (m_domain->commit() < 0) {
+			opserr << "ExplicitDynamicsAnalysis::analyze() - the Domain failed in commit at time " << time << "\n";
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int ExplicitDynamicsAnalysis::checkLoadPatterns()
+{
+	// an EarthquakePattern applies the ground motion as inertia loads
+	// formed by the nodes and elements from their own mass matrices,
+	// which elements may or may not provide and which need not match the
+	// lumped mass used here; rather than integrate with missing or
+	// inconsistent ground motion loads such models are rejected
+	LoadPattern* pattern;
+	LoadPatternIter& thePatterns = m_domain->getLoadPatterns();
+	while ((pattern = thePatterns()) != 0) {
+		if (dynamic_cast<EarthquakePattern*>(pattern) != 0) {
+			opserr << "ExplicitDynamicsAnalysis::analyze() - load pattern " << pattern->getTag()
+				<< " is a ground motion excitation, which is not supported; impose the motion"
+				" at the supports or use a transient analysis.\n";
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int ExplicitDynamicsAnalysis::setup()
+{
+	Domain* domain = m_domain;
+
+	if (domain->getNumMPs() > 0) {
+		opserr << "ExplicitDynamicsAnalysis::setup() - MP_Constraints are not supported.\n";
+		return -1;
+	}
+
+	// number the DOFs node by node
+	m_nodes.clear();
+	m_node_tags.clear();
+	m_domain_elements.clear();
+	m_ele_tags.clear();
+	m_all_sps.clear();
+	m_sp_tags.clear();
+	m_node_start.assign(1, 0);
+	std::map<int, int> nodeIndex;
+	Node* node;
+	NodeIter& theNodes = domain->getNodes();
+	while ((node = theNodes()) != 0) {
+		nodeIndex[node->getTag()] = (int)m_nodes.size();
+		m_nodes.push_back(node);
+		m_node_tags.push_back(node->getTag());
+		m_node_start.push_back(m_node_start.back() + node->getNumberDOF());
+	}
+	int n = m_num_dof = m_node_start.back();
+
+	m_mass.assign(n, 0.0);
+	m_damp.assign(n, 0.0);
+	m_fixed.assign(n, FreeDOF);
+	m_u.assign(n, 0.0);
+	m_v.assign(n, 0.0);
+	m_a.assign(n, 0.0);
+	m_force.assign(n, 0.0);
+	m_zero.assign(n, 0.0);
+
+	// lump the nodal mass and damping by rows
+	for (std::size_t k = 0; k < m_nodes.size(); ++k) {
+		const Matrix& mass = m_nodes[k]->getMass();
+		const Matrix& damp = m_nodes[k]->getDamp();
+		int start = m_node_start[k];
+		for (int i = 0; i < mass.noRows(); ++i) {
+			for (int j = 0; j < mass.noCols(); ++j) {
+				m_mass[start + i] += mass(i, j);
+				m_damp[start + i] += damp(i, j);
+			}
+		}
+	}
+
+	// map the element DOFs onto the arrays and lump the element mass
+	std::vector<Element*> elements;
+	std::vector<int> eleStart(1, 0);
+	std::vector<int> eleDOF;
+	Element* ele;
+	ElementIter& theEles = domain->getElements();
+	while ((ele = theEles()) != 0) {
+		const ID& nodes = ele->getExternalNodes();
+		int numDOF = 0;
+		for (int j = 0; j < nodes.Size(); ++j) {
+			std::map<int, int>::iterator it = nodeIndex.find(nodes(j));
+			if (it == nodeIndex.end()) {
+				opserr << "ExplicitDynamicsAnalysis::setup() - node " << nodes(j)
+					<< " of element " << ele->getTag() << " is not in the domain.\n";
+				return -1;
+			}
+			for (int i = m_node_start[it->second]; i < m_node_start[it->second + 1]; ++i, ++numDOF)
+				eleDOF.push_back(i);
+		}
+		if (numDOF != ele->getNumDOF()) {
+			opserr << "ExplicitDynamicsAnalysis::setup() - the DOFs of element " << ele->getTag()
+				<< " do not match those of its nodes.\n";
+			return -1;
+		}
+		const Matrix& mass = ele->getMass();
+		if (mass.noRows() == numDOF) {
+			const int* dof = &eleDOF[eleStart.back()];
+			for (int i = 0; i < numDOF; ++i)
+				for (int j = 0; j < numDOF; ++j)
+					m_mass[dof[i]] += mass(i, j);
+		}
+		elements.push_back(ele);
+		eleStart.push_back((int)eleDOF.size());
+		m_ele_tags.push_back(ele->getTag());
+	}
+
+	// color the elements so those of a color share no node, giving each
+	// the smallest color not yet used at any of its nodes (first fit);
+	// the summation order does not matter here, so unlike the assembly
+	// the colors need not follow the element order. The DOF map is
+	// stored in the color order
+	std::vector<int> eleColor(elements.size());
+	std::vector<std::vector<int> > nodeColors(m_nodes.size());
+	std::vector<int> colorMark;
+	std::vector<int> eleNodes;
+	int numColors = 0;
+	for (std::size_t e = 0; e < elements.size(); ++e) {
+		// the nodes of the element, from the runs of DOFs in its map
+		eleNodes.clear();
+		for (int j = eleStart[e]; j < eleStart[e + 1]; ++j) {
+			int k = (int)(std::upper_bound(m_node_start.begin(), m_node_start.end(), eleDOF[j]) - m_node_start.begin()) - 1;
+			if (eleNodes.empty() || eleNodes.back() != k)
+				eleNodes.push_back(k);
+		}
+
+		// mark the colors in use at the nodes and take the first free one
+		for (std::size_t j = 0; j < eleNodes.size(); ++j) {
+			const std::vector<int>& used = nodeColors[eleNodes[j]];
+			for (std::size_t i = 0; i < used.size(); ++i)
+				colorMark[used[i]] = (int)e;
+		}
+		int color = 0;
+		while (color < numColors && colorMark[color] == (int)e)
+			color++;
+		if (color == numColors) {
+			numColors++;
+			colorMark.push_back(-1);
+		}
+
+		for (std::size_t j = 0; j < eleNodes.size(); ++j)
+			nodeColors[eleNodes[j]].push_back(color);
+		eleColor[e] = color;
+	}
+
+	m_color_start.assign(numColors + 1, 0);
+	for (std::size_t e = 0; e < elements.size(); ++e)
+		m_color_start[eleColor[e] + 1]++;
+	for (int c = 0; c < numColors; ++c)
+		m_color_start[c + 1] += m_color_start[c];
+
+	std::vector<int> nextLoc(m_color_start.begin(), m_color_start.end() - 1);
+	std::vector<int> order(elements.size());
+	for (std::size_t e = 0; e < elements.size(); ++e)
+		order[nextLoc[eleColor[e]]++] = (int)e;
+
+	m_domain_elements = elements;
+	m_elements.resize(elements.size());
+	m_thread_safe.resize(elements.size());
+	m_ele_start.assign(1, 0);
+	m_ele_dof.clear();
+	for (std::size_t loc = 0; loc < order.size(); ++loc) {
+		int e = order[loc];
+		m_elements[loc] = elements[e];
+		m_thread_safe[loc] = elements[e]->isThreadSafe() ? 1 : 0;
+		m_ele_dof.insert(m_ele_dof.end(), eleDOF.begin() + eleStart[e], eleDOF.begin() + eleStart[e + 1]);
+		m_ele_start.push_back((int)m_ele_dof.size());
+	}
+
+	// the constrained DOFs
+	m_sp_dof.clear();
+	m_sps.clear();
+	SP_Constraint* sp;
+	SP_ConstraintIter& theSPs = domain->getDomainAndLoadPatternSPs();
+	while ((sp = theSPs()) != 0) {
+		m_all_sps.push_back(sp);
+		m_sp_tags.push_back(sp->getTag());
+		std::map<int, int>::iterator it = nodeIndex.find(sp->getNodeTag());
+		if (it == nodeIndex.end())
+			continue;
+		int k = it->second;
+		int dof = sp->getDOF_Number();
+		if (dof < 0 || dof >= m_node_start[k + 1] - m_node_start[k])
+			continue;
+		m_fixed[m_node_start[k] + dof] = FixedDOF;
+		m_sp_dof.push_back(m_node_start[k] + dof);
+		m_sps.push_back(sp);
+	}
+
+	return estimateTimeStep();
+}
+
+int ExplicitDynamicsAnalysis::estimateTimeStep()
+{
+	// the largest eigenvalue of M^-1 K is bounded by the largest row sum
+	// of |K_ij| / m_i over the unconstrained DOFs, and |K_ij| by the sum
+	// over the elements of the absolute element terms, giving
+	// 2/sqrt(max_i sum_e sum_j |Ke_ij| / m_i) as a lower bound on the
+	// critical step of the central difference rule
+	int n = m_num_dof;
+	std::vector<double> rowSum(n, 0.0);
+	double* row = rowSum.data();
+	int numColors = (int)m_color_start.size() - 1;
+
+	for (int c = 0; c < numColors; ++c) {
+		int start = m_color_start[c];
+		int end = m_color_start[c + 1];
+		for (int pass = 0; pass < 2; ++pass) {
+			// the thread safe elements of the color first, then the rest
+			bool parallel = (pass == 0 && m_num_threads > 1);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(dynamic) if (parallel)
+#endif
+			for (int e = start; e < end; ++e) {
+				if ((m_thread_safe[e] != 0) != (pass == 0))
+					continue;
+				Element* ele = m_elements[e];
+				ops_TheActiveElement = ele;
+				const Matrix& K = ele->getInitialStiff();
+				const int* dof = &m_ele_dof[m_ele_start[e]];
+				int numDOF = m_ele_start[e + 1] - m_ele_start[e];
+				if (K.noRows() != numDOF)
+					continue;
+				for (int i = 0; i < numDOF; ++i) {
+					double sum = 0.0;
+					for (int j = 0; j < numDOF; ++j)
+						if (m_fixed[dof[j]] != FixedDOF)
+							sum += std::fabs(K(i, j));
+					row[dof[i]] += sum;
+				}
+			}
+		}
+	}
+
+	double maxRatio = 0.0;
+	int numMassless = 0;
+	for (int i = 0; i < n; ++i) {
+		if (m_fixed[i] != FreeDOF)
+			continue;
+		if (m_mass[i] <= 0.0) {
+			if (row[i] == 0.0) {
+				m_fixed[i] = InactiveDOF;
+				continue;
+			}
+			numMassless++;
+			continue;
+		}
+		maxRatio = std::max(maxRatio, row[i] / m_mass[i]);
+	}
+
+	if (numMassless > 0) {
+		opserr << "ExplicitDynamicsAnalysis::setup() - " << numMassless
+			<< " unconstrained DOFs have stiffness but no mass.\n";
+		return -1;
+	}
+
+	m_stable_dt = maxRatio > 0.0 ? 2.0 / std::sqrt(maxRatio) : 0.0;
+
+	return 0;
+}
+
+void ExplicitDynamicsAnalysis::setTrialResponse(const double* u, const double* v, const double* a)
+{
+	int numNodes = (int)m_nodes.size();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(static) if (m_num_threads > 1)
+#endif
+	for (int k = 0; k < numNodes; ++k) {
+		Node* node = m_nodes[k];
+		int start = m_node_start[k];
+		int size = m_node_start[k + 1] - start;
+		if (u != 0)
+			node->setTrialDisp(Vector(const_cast<double*>(u + start), size));
+		node->setTrialVel(Vector(const_cast<double*>(v + start), size));
+		node->setTrialAccel(Vector(const_cast<double*>(a + start), size));
+	}
+}
+
+void ExplicitDynamicsAnalysis::formAccel(const double* v, double* a)
+{
+	int n = m_num_dof;
+	double* force = m_force.data();
+	std::fill(m_force.begin(), m_force.end(), 0.0);
+
+	// the applied loads
+	int numNodes = (int)m_nodes.size();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(static) if (m_num_threads > 1)
+#endif
+	for (int k = 0; k < numNodes; ++k) {
+		const Vector& load = m_nodes[k]->getUnbalancedLoad();
+		int start = m_node_start[k];
+		for (int i = 0; i < load.Size(); ++i)
+			force[start + i] = load(i);
+	}
+
+	// less the element resisting forces; the trial accelerations are zero
+	// so the inertia terms of the elements drop out, their mass is in m_mass
+	int numColors = (int)m_color_start.size() - 1;
+	for (int c = 0; c < numColors; ++c) {
+		int start = m_color_start[c];
+		int end = m_color_start[c + 1];
+		for (int pass = 0; pass < 2; ++pass) {
+			bool parallel = (pass == 0 && m_num_threads > 1);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(dynamic) if (parallel)
+#endif
+			for (int e = start; e < end; ++e) {
+				if ((m_thread_safe[e] != 0) != (pass == 0))
+					continue;
+				Element* ele = m_elements[e];
+				ops_TheActiveElement = ele;
+				const Vector& R = ele->getResistingForceIncInertia();
+				const int* dof = &m_ele_dof[m_ele_start[e]];
+				int numDOF = m_ele_start[e + 1] - m_ele_start[e];
+				for (int i = 0; i < numDOF && i < R.Size(); ++i)
+					force[dof[i]] -= R(i);
+			}
+		}
+	}
+
+	const double* mass = m_mass.data();
+	const double* damp = m_damp.data();
+	const char* fixed = m_fixed.data();
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(m_num_threads) schedule(static) if (m_num_threads > 1)
+#endif
+	for (int i = 0; i < n; ++i) {
+		if (fixed[i] == FreeDOF)
+			a[i] = (force[i] - damp[i] * v[i]) / mass[i];
+		else
+			a[i] = 0.0;
+	}
+}
+
+void ExplicitDynamicsAnalysis::imposeConstraints(double dt, double* u, double* v)
+{
+	// the values are those set by Domain::applyLoad() for the new time;
+	// the velocity is the mean over the step
+	for (std::size_t k = 0; k < m_sps.size(); ++k) {
+		int i = m_sp_dof[k];
+		double value = m_sps[k]->getValue() + m_sps[k]->getInitialValue();
+		v[i] = (value - u[i]) / dt;
+		u[i] = value;
+	}
+}
@@ -0,0 +1,114 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ExplicitDynamicsAnalysis.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the class definition for ExplicitDynamicsAnalysis.
+// ExplicitDynamicsAnalysis integrates the equations of motion with the
+// central difference rule without forming a system of equations. The
+// lumped (row-sum) mass, the nodal damping and the nodal response are
+// kept in flat arrays indexed by DOF; the element resisting forces are
+// formed concurrently for the elements that report isThreadSafe(), one
+// color at a time, where elements of a color share no node, and the
+// kinematic updates are plain loops over the arrays. The stable time step
+// is estimated from the initial element stiffness and the lumped mass.
+// Ground motion excitation through an EarthquakePattern is not supported.
+
+#ifndef ExplicitDynamicsAnalysis_h
+#define ExplicitDynamicsAnalysis_h
+
+#include <vector>
+
+class Domain;
+class Node;
+class Element;
+class SP_Constraint;
+
+class ExplicitDynamicsAnalysis
+{
+public:
+	ExplicitDynamicsAnalysis(Domain* theDomain, double safety = 0.9);
+	~ExplicitDynamicsAnalysis();
+
+public:
+	// a non-positive dt selects the stable time step times the safety factor
+	int analyze(int numSteps, double dt = 0.0);
+
+	void setSafetyFactor(double safety);
+	double getStableTimeStep(void);
+	Domain* getDomainPtr(void) const;
+
+private:
+	int setup();
+	bool isCurrent();
+	int checkLoadPatterns();
+	int formColors();
+	int estimateTimeStep();
+	void setTrialResponse(const double* u, const double* v, const double* a);
+	void formAccel(const double* v, double* a);
+	void imposeConstraints(double dt, double* u, double* v);
+
+private:
+	Domain* m_domain;
+	double m_safety;
+	int m_stamp;
+	int m_num_threads;
+
+	// nodes and the first entry of each in the DOF arrays
+	std::vector<Node*> m_nodes;
+	std::vector<int> m_node_tags;
+	std::vector<int> m_node_start;
+	int m_num_dof;
+
+	// per DOF data
+	std::vector<double> m_mass;
+	std::vector<double> m_damp;
+	std::vector<char> m_fixed;
+	std::vector<double> m_u;
+	std::vector<double> m_v;
+	std::vector<double> m_a;
+	std::vector<double> m_force;
+	std::vector<double> m_zero;
+
+	// elements ordered by color, the DOF map of each and the color offsets
+	std::vector<Element*> m_elements;
+	std::vector<char> m_thread_safe;
+	std::vector<int> m_ele_start;
+	std::vector<int> m_ele_dof;
+	std::vector<int> m_color_start;
+
+	// the elements in the order of the domain, to check the cache against
+	std::vector<Element*> m_domain_elements;
+	std::vector<int> m_ele_tags;
+
+	// constrained DOFs and the constraint imposing each
+	std::vector<int> m_sp_dof;
+	std::vector<SP_Constraint*> m_sps;
+	std::vector<SP_Constraint*> m_all_sps;
+	std::vector<int> m_sp_tags;
+
+	double m_stable_dt;
+};
+
+#endif
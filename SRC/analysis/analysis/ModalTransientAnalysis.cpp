@@ -0,0 +1,543 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ModalTransientAnalysis.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the implementation of ModalTransientAnalysis.
+
+#include <ModalTransientAnalysis.h>
+#include <AnalysisModel.h>
+#include <Domain.h>
+#include <TimeSeries.h>
+#include <elementAPI.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#endif
+
+namespace {
+
+	// products formed by ModalTransientAnalysis::formProduct
+	enum ProductType { MassProduct = 0, StiffnessProduct = 1, DampingProduct = 2 };
+
+	// below this value of omega*dt the closed-form recurrence loses
+	// accuracy to cancellation and the average acceleration rule is used
+	const double small_omega_dt = 1.0e-2;
+
+	// one step of the average acceleration rule for
+	// q'' + 2*zeta*omega*q' + omega^2*q = p
+	void average_acceleration_step(double omega, double zeta, double dt,
+		double u0, double v0, double p0, double p1, double& u1, double& v1)
+	{
+		double c = 2.0 * zeta * omega;
+		double k = omega * omega;
+		double a0 = p0 - c * v0 - k * u0;
+		double khat = k + 2.0 * c / dt + 4.0 / (dt * dt);
+		double phat = p1 + (4.0 / (dt * dt) * u0 + 4.0 / dt * v0 + a0) + c * (2.0 / dt * u0 + v0);
+		u1 = phat / khat;
+		v1 = 2.0 / dt * (u1 - u0) - v0;
+	}
+
+}
+
+int
+OPS_ModalTransientAnalysis(void)
+{
+	// modalTransientAnalysis $tsTag $dir $dt $numSteps <-scale $scale> <-numModes $n>
+	//                        <-damp $zeta1 <$zeta2 ...>> <-record $every>
+
+	// get analysis model
+	AnalysisModel* theAnalysisModel = *OPS_GetAnalysisModel();
+	if (theAnalysisModel == nullptr) {
+		opserr << "ModalTransientAnalysis Error: no AnalysisModel available.\n";
+		return -1;
+	}
+	if (theAnalysisModel->getDomainPtr() == nullptr) {
+		opserr << "ModalTransientAnalysis Error: no Domain available.\n";
+		return -1;
+	}
+
+	// parse
+	if (OPS_GetNumRemainingInputArgs() < 4) {
+		opserr << "ModalTransientAnalysis $tsTag $dir $dt $numSteps <-scale $scale> <-numModes $n> <-damp $zeta ...> <-record $every>\n"
+			"Error: at least 4 arguments should be provided.\n";
+		return -1;
+	}
+
+	// num data
+	int numData = 1;
+
+	// get time series
+	int tstag;
+	if (OPS_GetInt(&numData, &tstag) < 0) {
+		opserr << "ModalTransientAnalysis Error: Failed to get timeSeries tag.\n";
+		return -1;
+	}
+	TimeSeries* ts = OPS_getTimeSeries(tstag);
+	if (ts == nullptr) {
+		opserr << "ModalTransientAnalysis Error: Failed to get timeSeries with tag = " << tstag << ".\n";
+		return -1;
+	}
+
+	// get direction
+	int dir = 1;
+	if (OPS_GetInt(&numData, &dir) < 0) {
+		opserr << "ModalTransientAnalysis Error: Failed to get direction.\n";
+		return -1;
+	}
+	if (dir < 1 || dir > 6) {
+		opserr << "ModalTransientAnalysis Error: provided direction (" << dir << ") should be in the range 1-6.\n";
+		return -1;
+	}
+
+	// get time step and number of steps
+	double dt;
+	if (OPS_GetDouble(&numData, &dt) < 0 || dt <= 0.0) {
+		opserr << "ModalTransientAnalysis Error: Failed to get a positive time step.\n";
+		return -1;
+	}
+	int numSteps;
+	if (OPS_GetInt(&numData, &numSteps) < 0 || numSteps < 1) {
+		opserr << "ModalTransientAnalysis Error: Failed to get a positive number of steps.\n";
+		return -1;
+	}
+
+	// parse optional data
+	double scale = 1.0;
+	int numModes = 0;
+	int recordEvery = 1;
+	std::vector<double> damping;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+		const char* value = OPS_GetString();
+		if (strcmp(value, "-scale") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDouble(&numData, &scale) < 0) {
+				opserr << "ModalTransientAnalysis Error: Failed to get scale factor.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-numModes") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetInt(&numData, &numModes) < 0 || numModes < 1) {
+				opserr << "ModalTransientAnalysis Error: Failed to get a positive number of modes.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-record") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetInt(&numData, &recordEvery) < 0 || recordEvery < 1) {
+				opserr << "ModalTransientAnalysis Error: Failed to get a positive record interval.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-damp") == 0) {
+			// one value for all modes, or one value per mode
+			damping.clear();
+			while (OPS_GetNumRemainingInputArgs() > 0) {
+				double item;
+				auto old_num_rem = OPS_GetNumRemainingInputArgs();
+				if (OPS_GetDoubleInput(&numData, &item) < 0) {
+					auto new_num_rem = OPS_GetNumRemainingInputArgs();
+					if (new_num_rem < old_num_rem)
+						OPS_ResetCurrentInputArg(-1);
+					break;
+				}
+				if (item < 0.0) {
+					opserr << "ModalTransientAnalysis Error: damping ratios must be positive (found " << item << ")\n";
+					return -1;
+				}
+				damping.push_back(item);
+			}
+			if (damping.size() == 0) {
+				opserr << "ModalTransientAnalysis Error: damping ratios requested but not provided.\n";
+				return -1;
+			}
+		}
+		else {
+			opserr << "ModalTransientAnalysis Error: unknown option " << value << ".\n";
+			return -1;
+		}
+	}
+
+	// ok, create the modal transient analysis and run it here... 
+	// no need to store it
+	ModalTransientAnalysis mta(theAnalysisModel, ts, dir, scale, numModes, damping);
+	return mta.analyze(numSteps, dt, recordEvery);
+}
+
+ModalTransientAnalysis::ModalTransientAnalysis(
+	AnalysisModel* theModel,
+	TimeSeries* theFunction,
+	int theDirection,
+	double scale,
+	int numModes,
+	const std::vector<double>& damping
+)
+	: m_model(theModel)
+	, m_function(theFunction)
+	, m_direction(theDirection)
+	, m_scale(scale)
+	, m_num_modes(numModes)
+	, m_damping(damping)
+	, m_num_eqn(0)
+{
+
+}
+
+ModalTransientAnalysis::~ModalTransientAnalysis()
+{
+}
+
+int ModalTransientAnalysis::analyze(int numSteps, double dt, int recordEvery)
+{
+	// check consistency
+	int error_code;
+	error_code = check();
+	if (error_code < 0) return error_code;
+
+	// project the model onto the modes and set up the recurrence
+	error_code = formModalSystem();
+	if (error_code < 0) return error_code;
+	formCoefficients(dt);
+
+	int nm = m_num_modes;
+	double* q = m_q.data();
+	double* qd = m_qd.data();
+	double* qdd = m_qdd.data();
+	const double* A = m_A.data();
+	const double* B = m_B.data();
+	const double* C = m_C.data();
+	const double* D = m_D.data();
+	const double* Av = m_Av.data();
+	const double* Bv = m_Bv.data();
+	const double* Cv = m_Cv.data();
+	const double* Dv = m_Dv.data();
+	const double* gamma = m_gamma.data();
+	const double* omega = m_omega.data();
+	const double* zeta = m_zeta.data();
+
+	// start from rest at the current domain time. the modal load is
+	// p_n(t) = -gamma_n * scale * ag(t); only the ground acceleration
+	// is a scalar per step, so the loops below run over the modes
+	double time = m_model->getCurrentDomainTime();
+	double ag0 = m_scale * m_function->getFactor(time);
+	std::fill(m_q.begin(), m_q.end(), 0.0);
+	std::fill(m_qd.begin(), m_qd.end(), 0.0);
+
+	double last_recorded = time;
+	for (int step = 1; step <= numSteps; ++step) {
+		time += dt;
+		double ag1 = m_scale * m_function->getFactor(time);
+
+		for (int i = 0; i < nm; ++i) {
+			double p0 = -gamma[i] * ag0;
+			double p1 = -gamma[i] * ag1;
+			double u = q[i];
+			double v = qd[i];
+			q[i] = A[i] * u + B[i] * v + C[i] * p0 + D[i] * p1;
+			qd[i] = Av[i] * u + Bv[i] * v + Cv[i] * p0 + Dv[i] * p1;
+		}
+		ag0 = ag1;
+
+		// recover the nodal response only when it is going to be recorded
+		if (step % recordEvery == 0 || step == numSteps) {
+			for (int i = 0; i < nm; ++i)
+				qdd[i] = -gamma[i] * ag1 - 2.0 * zeta[i] * omega[i] * qd[i] - omega[i] * omega[i] * q[i];
+			error_code = recordStep(time, time - last_recorded);
+			if (error_code < 0) return error_code;
+			last_recorded = time;
+		}
+	}
+
+	return 0;
+}
+
+int ModalTransientAnalysis::check()
+{
+	// get the domain
+	Domain* domain = m_model->getDomainPtr();
+
+	// number of eigen-modes
+	int num_eigen = domain->getEigenvalues().Size();
+	if (num_eigen < 1) {
+		opserr << "ModalTransientAnalysis::check() - No Eigenvalue provided.\n"
+			"Make sure to call the 'eigen' command before the 'modalTransientAnalysis' command.\n";
+		return -1;
+	}
+	if (m_num_modes < 1 || m_num_modes > num_eigen) {
+		if (m_num_modes > num_eigen)
+			opserr << "ModalTransientAnalysis::check() - WARNING only " << num_eigen
+				<< " modes are available, using them all\n";
+		m_num_modes = num_eigen;
+	}
+
+	// the equation numbers must be those the eigenvectors were computed with
+	m_num_eqn = m_model->getNumEqn();
+	if (m_num_eqn < 1) {
+		opserr << "ModalTransientAnalysis::check() - the AnalysisModel has no equations.\n";
+		return -1;
+	}
+
+	if (m_damping.size() > 1 && (int)m_damping.size() < m_num_modes) {
+		opserr << "ModalTransientAnalysis::check() - " << (int)m_damping.size()
+			<< " damping ratios provided for " << m_num_modes << " modes.\n";
+		return -1;
+	}
+
+	return 0;
+}
+
+void ModalTransientAnalysis::formProduct(int type, const Vector& x, Vector& y)
+{
+	y.Zero();
+
+	// loop over the FE_Elements
+	FE_Element* elePtr;
+	FE_EleIter& theEles = m_model->getFEs();
+	while ((elePtr = theEles()) != 0) {
+		if (type == MassProduct)
+			y.Assemble(elePtr->getM_Force(x, 1.0), elePtr->getID(), 1.0);
+		else if (type == StiffnessProduct)
+			y.Assemble(elePtr->getK_Force(x, 1.0), elePtr->getID(), 1.0);
+		else
+			y.Assemble(elePtr->getC_Force(x, 1.0), elePtr->getID(), 1.0);
+	}
+
+	// loop over the DOF_Groups (nodal mass and damping only)
+	if (type == StiffnessProduct)
+		return;
+	DOF_Group* dofPtr;
+	DOF_GrpIter& theDofs = m_model->getDOFs();
+	while ((dofPtr = theDofs()) != 0) {
+		if (type == MassProduct)
+			y.Assemble(dofPtr->getM_Force(x, 1.0), dofPtr->getID(), 1.0);
+		else
+			y.Assemble(dofPtr->getC_Force(x, 1.0), dofPtr->getID(), 1.0);
+	}
+}
+
+int ModalTransientAnalysis::formModalSystem()
+{
+	// get the domain
+	Domain* domain = m_model->getDomainPtr();
+
+	int neq = m_num_eqn;
+	int nm = m_num_modes;
+
+	// gather the mode shapes by equation number. go through the nodes
+	// rather than the DOF_Groups, the latter may also hold lagrange
+	// multipliers which have no eigenvectors (their shape is left zero)
+	m_phi.assign((std::size_t)neq * nm, 0.0);
+	Vector r(neq);
+	int exdof = m_direction - 1; // make it 0-based
+	Node* node;
+	NodeIter& theNodes = domain->getNodes();
+	while ((node = theNodes()) != 0) {
+		DOF_Group* dofPtr = node->getDOF_GroupPtr();
+		if (dofPtr == 0)
+			continue;
+		const ID& id = dofPtr->getID();
+		const Matrix& evec = dofPtr->getEigenvectors();
+		if (evec.noCols() < nm || evec.noRows() < id.Size()) {
+			opserr << "ModalTransientAnalysis::formModalSystem() - node " << node->getTag()
+				<< " does not store " << nm << " eigenvectors.\n";
+			return -1;
+		}
+		for (int i = 0; i < id.Size(); ++i) {
+			int eq = id(i);
+			if (eq < 0 || eq >= neq)
+				continue;
+			for (int j = 0; j < nm; ++j)
+				m_phi[eq + (std::size_t)j * neq] = evec(i, j);
+			// influence vector of the ground motion
+			if (i == exdof)
+				r(eq) = 1.0;
+		}
+	}
+
+	// project M, K and C onto each mode. the off-diagonal terms are
+	// dropped, i.e. the damping is assumed to be classical
+	m_mass.resize(nm);
+	m_omega.resize(nm);
+	m_zeta.resize(nm);
+	m_gamma.resize(nm);
+	m_q.assign(nm, 0.0);
+	m_qd.assign(nm, 0.0);
+	m_qdd.assign(nm, 0.0);
+
+	const Vector* modalDamping = m_model->getModalDampingFactors();
+	const Vector& eigenvalues = domain->getEigenvalues();
+
+	Vector Mr(neq);
+	formProduct(MassProduct, r, Mr);
+
+	Vector y(neq);
+	for (int j = 0; j < nm; ++j) {
+		Vector phi(&m_phi[(std::size_t)j * neq], neq);
+
+		formProduct(MassProduct, phi, y);
+		double mj = phi ^ y;
+		if (mj <= 0.0) {
+			opserr << "ModalTransientAnalysis::formModalSystem() - mode " << j + 1
+				<< " has no mass.\n";
+			return -1;
+		}
+
+		formProduct(StiffnessProduct, phi, y);
+		double kj = phi ^ y;
+
+		formProduct(DampingProduct, phi, y);
+		double cj = phi ^ y;
+
+		// use the projected stiffness; for the model the eigenvectors
+		// came from it equals the eigenvalue, fall back to that if the
+		// elements report no stiffness
+		double w2 = kj / mj;
+		if (w2 <= 0.0)
+			w2 = eigenvalues(j);
+		double wj = w2 > 0.0 ? std::sqrt(w2) : 0.0;
+
+		// damping ratio from the projected C plus the modal damping:
+		// the ratios passed to this analysis or, if none, those defined
+		// with the modalDamping command
+		double zj = 0.0;
+		if (m_damping.size() == 1)
+			zj = m_damping[0];
+		else if (m_damping.size() > 1)
+			zj = m_damping[j];
+		else if (modalDamping != 0 && j < modalDamping->Size())
+			zj = (*modalDamping)(j);
+		if (wj > 0.0)
+			zj += cj / (2.0 * mj * wj);
+
+		m_mass[j] = mj;
+		m_omega[j] = wj;
+		m_zeta[j] = zj;
+		m_gamma[j] = (phi ^ Mr) / mj;
+	}
+
+	return 0;
+}
+
+void ModalTransientAnalysis::formCoefficients(double dt)
+{
+	int nm = m_num_modes;
+	m_A.resize(nm); m_B.resize(nm); m_C.resize(nm); m_D.resize(nm);
+	m_Av.resize(nm); m_Bv.resize(nm); m_Cv.resize(nm); m_Dv.resize(nm);
+
+	for (int j = 0; j < nm; ++j) {
+		double w = m_omega[j];
+		double z = m_zeta[j];
+
+		if (z < 1.0 && w * dt >= small_omega_dt) {
+			// exact recurrence for a piecewise-linear excitation
+			// (Nigam and Jennings, 1969) with unit mass
+			double k = w * w;
+			double sq = std::sqrt(1.0 - z * z);
+			double wd = w * sq;
+			double e = std::exp(-z * w * dt);
+			double s = std::sin(wd * dt);
+			double c = std::cos(wd * dt);
+			double zs = z / sq;
+			double zwdt = 2.0 * z / (w * dt);
+
+			m_A[j] = e * (zs * s + c);
+			m_B[j] = e * s / wd;
+			m_C[j] = (zwdt + e * (((1.0 - 2.0 * z * z) / (wd * dt) - zs) * s - (1.0 + zwdt) * c)) / k;
+			m_D[j] = (1.0 - zwdt + e * ((2.0 * z * z - 1.0) / (wd * dt) * s + zwdt * c)) / k;
+			m_Av[j] = -e * w / sq * s;
+			m_Bv[j] = e * (c - zs * s);
+			m_Cv[j] = (-1.0 / dt + e * ((w / sq + z / (dt * sq)) * s + c / dt)) / k;
+			m_Dv[j] = (1.0 - e * (zs * s + c)) / (k * dt);
+		}
+		else {
+			// overdamped, rigid body or very flexible modes: the average
+			// acceleration rule is linear in (q, q', p0, p1) so its
+			// coefficients are its response to unit values of each
+			double u, v;
+			average_acceleration_step(w, z, dt, 1.0, 0.0, 0.0, 0.0, u, v);
+			m_A[j] = u; m_Av[j] = v;
+			average_acceleration_step(w, z, dt, 0.0, 1.0, 0.0, 0.0, u, v);
+			m_B[j] = u; m_Bv[j] = v;
+			average_acceleration_step(w, z, dt, 0.0, 0.0, 1.0, 0.0, u, v);
+			m_C[j] = u; m_Cv[j] = v;
+			average_acceleration_step(w, z, dt, 0.0, 0.0, 0.0, 1.0, u, v);
+			m_D[j] = u; m_Dv[j] = v;
+		}
+	}
+}
+
+int ModalTransientAnalysis::recordStep(double time, double dt)
+{
+	int neq = m_num_eqn;
+	int nm = m_num_modes;
+
+	// new step
+	if (m_model->analysisStep(dt) < 0) {
+		opserr << "ModalTransientAnalysis::analyze() - the AnalysisModel failed"
+			" at time " << time << "\n";
+		return -1;
+	}
+
+	// u = Phi * q (and likewise for the velocities and accelerations),
+	// relative to the ground
+	Matrix phi(m_phi.data(), neq, nm);
+	Vector q(m_q.data(), nm);
+	Vector qd(m_qd.data(), nm);
+	Vector qdd(m_qdd.data(), nm);
+	Vector U(neq), V(neq), A(neq);
+	U.addMatrixVector(0.0, phi, q, 1.0);
+	V.addMatrixVector(0.0, phi, qd, 1.0);
+	A.addMatrixVector(0.0, phi, qdd, 1.0);
+	m_model->setResponse(U, V, A);
+
+	// update domain
+	m_model->setCurrentDomainTime(time);
+	if (m_model->updateDomain() < 0) {
+		opserr << "ModalTransientAnalysis::analyze() - the AnalysisModel failed in updateDomain"
+			" at time " << time << "\n";
+		return -1;
+	}
+
+	// commit domain, the recorders are invoked here
+	if (m_model->commitDomain() < 0) {
+		opserr << "ModalTransientAnalysis::analyze() - the AnalysisModel failed in commitDomain"
+			" at time " << time << "\n";
+		return -1;
+	}
+
+	return 0;
+}
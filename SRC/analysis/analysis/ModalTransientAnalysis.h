@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ModalTransientAnalysis.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the class definition for ModalTransientAnalysis.
+// ModalTransientAnalysis computes the linear time-history response of the
+// model to a uniform base acceleration by modal superposition. M, C and K
+// are projected onto the first N eigenvectors stored at the Nodes, the
+// resulting uncoupled SDOF equations are integrated with the exact
+// recurrence for a piecewise-linear excitation, and the nodal (and hence
+// element) response is recovered only at the steps that are recorded.
+
+#ifndef ModalTransientAnalysis_h
+#define ModalTransientAnalysis_h
+
+#include <vector>
+class AnalysisModel;
+class TimeSeries;
+class Vector;
+
+class ModalTransientAnalysis
+{
+public:
+	ModalTransientAnalysis(
+		AnalysisModel* theModel,
+		TimeSeries* theFunction,
+		int theDirection,
+		double scale,
+		int numModes,
+		const std::vector<double>& damping
+	);
+	~ModalTransientAnalysis();
+
+public:
+	int analyze(int numSteps, double dt, int recordEvery = 1);
+
+private:
+	int check();
+	int formModalSystem();
+	void formCoefficients(double dt);
+	int recordStep(double time, double dt);
+	void formProduct(int type, const Vector& x, Vector& y);
+
+private:
+	// the model
+	AnalysisModel* m_model;
+	// the ground acceleration function
+	TimeSeries* m_function;
+	// the direction 1 to 3 (for 2D models) or 1 to 6 (for 3D models)
+	int m_direction;
+	// the scale factor applied to the ground acceleration
+	double m_scale;
+	// number of modes used (0 = all the available ones)
+	int m_num_modes;
+	// additional modal damping ratios (one for all, or one per mode)
+	std::vector<double> m_damping;
+	// number of equations
+	int m_num_eqn;
+	// mode shapes by equation number, column-major (num_eqn x num_modes)
+	std::vector<double> m_phi;
+	// modal mass, circular frequency, damping ratio and participation factor
+	std::vector<double> m_mass;
+	std::vector<double> m_omega;
+	std::vector<double> m_zeta;
+	std::vector<double> m_gamma;
+	// recurrence coefficients, one array per coefficient so that the
+	// update over all modes is a set of contiguous loops
+	std::vector<double> m_A, m_B, m_C, m_D;
+	std::vector<double> m_Av, m_Bv, m_Cv, m_Dv;
+	// modal displacement, velocity and acceleration
+	std::vector<double> m_q;
+	std::vector<double> m_qd;
+	std::vector<double> m_qdd;
+};
+
+#endif
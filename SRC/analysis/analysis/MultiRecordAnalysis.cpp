@@ -0,0 +1,570 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/MultiRecordAnalysis.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the implementation of MultiRecordAnalysis.
+
+#include <MultiRecordAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <UniformExcitation.h>
+#include <GroundMotion.h>
+#include <TimeSeries.h>
+#include <AnalysisModel.h>
+#include <ConstraintHandler.h>
+#include <DOF_Numberer.h>
+#include <EquiSolnAlgo.h>
+#include <LinearSOE.h>
+#include <LinearSOESolver.h>
+#include <TransientIntegrator.h>
+#include <ConvergenceTest.h>
+#include <DirectIntegrationAnalysis.h>
+#include <FEM_ObjectBroker.h>
+#include <FEM_ObjectBrokerAllClasses.h>
+#include <MemoryChannel.h>
+#include <ID.h>
+#include <elementAPI.h>
+#include <vector>
+#include <thread>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <string.h>
+
+namespace {
+
+	// the objects a record is run with, owned by the DirectIntegrationAnalysis
+	// once it is created
+	struct AnalysisCopy {
+		Domain* domain = 0;
+		ConstraintHandler* handler = 0;
+		DOF_Numberer* numberer = 0;
+		EquiSolnAlgo* algorithm = 0;
+		LinearSOE* soe = 0;
+		TransientIntegrator* integrator = 0;
+		ConvergenceTest* test = 0;
+
+		void clear() {
+			delete handler; delete numberer; delete algorithm;
+			delete soe; delete integrator; delete test;
+			delete domain;
+			handler = 0; numberer = 0; algorithm = 0;
+			soe = 0; integrator = 0; test = 0; domain = 0;
+		}
+	};
+
+}
+
+int
+OPS_MultiRecordAnalysis(void)
+{
+	// multiRecordAnalysis $dir $dt $numSteps -records $tsTag1 <$tsTag2 ...> <-scale $scale>
+	//                     <-numThreads $n> <-node $tag1 ...> <-dof $dof1 ...>
+	//                     <-response disp|vel|accel> <-file $fileBase>
+
+	Domain* theDomain = OPS_GetDomain();
+	if (theDomain == nullptr) {
+		opserr << "MultiRecordAnalysis Error: no Domain available.\n";
+		return -1;
+	}
+	ConstraintHandler* theHandler = *OPS_GetHandler();
+	DOF_Numberer* theNumberer = *OPS_GetNumberer();
+	EquiSolnAlgo* theAlgorithm = *OPS_GetAlgorithm();
+	LinearSOE* theSOE = *OPS_GetSOE();
+	TransientIntegrator* theIntegrator = *OPS_GetTransientIntegrator();
+	ConvergenceTest* theTest = *OPS_GetTest();
+	if (theHandler == nullptr || theNumberer == nullptr || theAlgorithm == nullptr ||
+		theSOE == nullptr || theIntegrator == nullptr) {
+		opserr << "MultiRecordAnalysis Error: the constraints, numberer, algorithm, system and\n"
+			"a transient integrator must be defined before the multiRecordAnalysis command.\n";
+		return -1;
+	}
+
+	if (OPS_GetNumRemainingInputArgs() < 5) {
+		opserr << "MultiRecordAnalysis $dir $dt $numSteps -records $tsTag1 <$tsTag2 ...> <-scale $scale> <-numThreads $n>\n"
+			"    <-node $tag1 ...> <-dof $dof1 ...> <-response disp|vel|accel> <-file $fileBase>\n"
+			"Error: at least 5 arguments should be provided.\n";
+		return -1;
+	}
+
+	int numData = 1;
+	int dir;
+	if (OPS_GetInt(&numData, &dir) < 0 || dir < 1 || dir > 6) {
+		opserr << "MultiRecordAnalysis Error: Failed to get a direction in the range 1-6.\n";
+		return -1;
+	}
+	double dt;
+	if (OPS_GetDouble(&numData, &dt) < 0 || dt <= 0.0) {
+		opserr << "MultiRecordAnalysis Error: Failed to get a positive time step.\n";
+		return -1;
+	}
+	int numSteps;
+	if (OPS_GetInt(&numData, &numSteps) < 0 || numSteps < 1) {
+		opserr << "MultiRecordAnalysis Error: Failed to get a positive number of steps.\n";
+		return -1;
+	}
+
+	// reads a list of integers up to the next option
+	auto get_int_list = [&numData](std::vector<int>& out) {
+		out.clear();
+		while (OPS_GetNumRemainingInputArgs() > 0) {
+			int item;
+			auto old_num_rem = OPS_GetNumRemainingInputArgs();
+			if (OPS_GetIntInput(&numData, &item) < 0) {
+				auto new_num_rem = OPS_GetNumRemainingInputArgs();
+				if (new_num_rem < old_num_rem)
+					OPS_ResetCurrentInputArg(-1);
+				break;
+			}
+			out.push_back(item);
+		}
+	};
+
+	std::vector<int> tsTags, nodeTags, dofs;
+	double scale = 1.0;
+	int numThreads = 1;
+	int responseType = MultiRecordAnalysis::Disp;
+	std::string fileBase;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+		const char* value = OPS_GetString();
+		if (strcmp(value, "-records") == 0) {
+			get_int_list(tsTags);
+		}
+		else if (strcmp(value, "-node") == 0) {
+			get_int_list(nodeTags);
+		}
+		else if (strcmp(value, "-dof") == 0) {
+			get_int_list(dofs);
+		}
+		else if (strcmp(value, "-scale") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDouble(&numData, &scale) < 0) {
+				opserr << "MultiRecordAnalysis Error: Failed to get scale factor.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-numThreads") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetInt(&numData, &numThreads) < 0 || numThreads < 1) {
+				opserr << "MultiRecordAnalysis Error: Failed to get a positive number of threads.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-response") == 0) {
+			const char* type = OPS_GetNumRemainingInputArgs() > 0 ? OPS_GetString() : "";
+			if (strcmp(type, "disp") == 0)
+				responseType = MultiRecordAnalysis::Disp;
+			else if (strcmp(type, "vel") == 0)
+				responseType = MultiRecordAnalysis::Vel;
+			else if (strcmp(type, "accel") == 0)
+				responseType = MultiRecordAnalysis::Accel;
+			else {
+				opserr << "MultiRecordAnalysis Error: unknown response type " << type << ".\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-file") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1) {
+				opserr << "MultiRecordAnalysis Error: file name requested but not provided.\n";
+				return -1;
+			}
+			fileBase = OPS_GetString();
+		}
+		else {
+			opserr << "MultiRecordAnalysis Error: unknown option " << value << ".\n";
+			return -1;
+		}
+	}
+
+	if (tsTags.size() == 0) {
+		opserr << "MultiRecordAnalysis Error: no records provided.\n";
+		return -1;
+	}
+	if (nodeTags.size() != 0 && dofs.size() == 0) {
+		opserr << "MultiRecordAnalysis Error: -node given without -dof.\n";
+		return -1;
+	}
+
+	FEM_ObjectBrokerAllClasses theBroker;
+	MultiRecordAnalysis theAnalysis(theDomain, theHandler, theNumberer, theAlgorithm,
+		theSOE, theIntegrator, theTest, &theBroker);
+
+	for (int tag : tsTags) {
+		TimeSeries* ts = OPS_getTimeSeries(tag);
+		if (ts == nullptr) {
+			opserr << "MultiRecordAnalysis Error: Failed to get timeSeries with tag = " << tag << ".\n";
+			return -1;
+		}
+		theAnalysis.addRecord(ts, dir, scale);
+	}
+	for (int node : nodeTags)
+		for (int dof : dofs)
+			if (theAnalysis.addNodeResponse(node, dof, responseType) < 0)
+				return -1;
+
+	if (theAnalysis.analyze(numSteps, dt, numThreads) < 0)
+		return -1;
+
+	if (fileBase.size() != 0 && theAnalysis.writeResponse(fileBase.c_str()) < 0)
+		return -1;
+
+	// return the number of steps completed for each record
+	std::vector<int> done(theAnalysis.getNumRecords());
+	for (int i = 0; i < theAnalysis.getNumRecords(); ++i)
+		done[i] = theAnalysis.getNumStepsDone(i);
+	int size = (int)done.size();
+	if (OPS_SetIntOutput(&size, done.data(), false) < 0) {
+		opserr << "MultiRecordAnalysis Error: failed to set the output.\n";
+		return -1;
+	}
+
+	return 0;
+}
+
+MultiRecordAnalysis::MultiRecordAnalysis(
+	Domain* theDomain,
+	ConstraintHandler* theHandler,
+	DOF_Numberer* theNumberer,
+	EquiSolnAlgo* theAlgorithm,
+	LinearSOE* theSOE,
+	TransientIntegrator* theIntegrator,
+	ConvergenceTest* theTest,
+	FEM_ObjectBroker* theBroker
+)
+	: m_domain(theDomain)
+	, m_handler(theHandler)
+	, m_numberer(theNumberer)
+	, m_algorithm(theAlgorithm)
+	, m_soe(theSOE)
+	, m_integrator(theIntegrator)
+	, m_test(theTest)
+	, m_broker(theBroker)
+	, m_channel(0)
+	, m_pattern_tag(0)
+	, m_next_record(0)
+{
+
+}
+
+MultiRecordAnalysis::~MultiRecordAnalysis()
+{
+	if (m_channel != 0)
+		delete m_channel;
+}
+
+int MultiRecordAnalysis::addRecord(TimeSeries* theSeries, int theDirection, double scale)
+{
+	Record record;
+	record.series = theSeries;
+	record.direction = theDirection;
+	record.scale = scale;
+	record.numStepsDone = 0;
+	m_records.push_back(record);
+	return 0;
+}
+
+int MultiRecordAnalysis::addNodeResponse(int nodeTag, int dof, int type)
+{
+	Node* theNode = m_domain->getNode(nodeTag);
+	if (theNode == 0) {
+		opserr << "MultiRecordAnalysis::addNodeResponse() - node " << nodeTag << " does not exist\n";
+		return -1;
+	}
+	if (dof < 1 || dof > theNode->getNumberDOF()) {
+		opserr << "MultiRecordAnalysis::addNodeResponse() - dof " << dof
+			<< " out of range at node " << nodeTag << "\n";
+		return -1;
+	}
+	NodeResponse output;
+	output.node = nodeTag;
+	output.dof = dof - 1;
+	output.type = type;
+	m_outputs.push_back(output);
+	return 0;
+}
+
+int MultiRecordAnalysis::getNumRecords(void) const
+{
+	return (int)m_records.size();
+}
+
+int MultiRecordAnalysis::getNumStepsDone(int record) const
+{
+	return m_records[record].numStepsDone;
+}
+
+const std::vector<double>& MultiRecordAnalysis::getResponse(int record) const
+{
+	return m_records[record].response;
+}
+
+int MultiRecordAnalysis::getResponseWidth(void) const
+{
+	return 1 + (int)m_outputs.size();
+}
+
+int MultiRecordAnalysis::snapshot()
+{
+	if (m_channel == 0)
+		m_channel = new MemoryChannel();
+	m_channel->clear();
+	MemoryChannel* theChannel = m_channel;
+
+	// the pattern added for each record must not clash with the
+	// patterns already in the model
+	m_pattern_tag = 0;
+	LoadPattern* thePattern;
+	LoadPatternIter& thePatterns = m_domain->getLoadPatterns();
+	while ((thePattern = thePatterns()) != 0)
+		if (thePattern->getTag() >= m_pattern_tag)
+			m_pattern_tag = thePattern->getTag() + 1;
+
+	// the model
+	if (m_domain->sendSelf(0, *theChannel) < 0) {
+		opserr << "MultiRecordAnalysis::analyze() - the Domain failed in sendSelf\n";
+		return -1;
+	}
+
+	// the analysis objects, their class tags first
+	LinearSOESolver* theSolver = m_soe->getSolver();
+	if (theSolver == 0) {
+		opserr << "MultiRecordAnalysis::analyze() - the LinearSOE has no solver\n";
+		return -1;
+	}
+	ID data(7);
+	data(0) = m_handler->getClassTag();
+	data(1) = m_numberer->getClassTag();
+	data(2) = m_algorithm->getClassTag();
+	data(3) = m_soe->getClassTag();
+	data(4) = theSolver->getClassTag();
+	data(5) = m_integrator->getClassTag();
+	data(6) = m_test != 0 ? m_test->getClassTag() : -1;
+	theChannel->sendID(0, 0, data);
+
+	if (m_handler->sendSelf(0, *theChannel) < 0 ||
+		m_numberer->sendSelf(0, *theChannel) < 0 ||
+		m_algorithm->sendSelf(0, *theChannel) < 0 ||
+		m_soe->sendSelf(0, *theChannel) < 0 ||
+		theSolver->sendSelf(0, *theChannel) < 0 ||
+		m_integrator->sendSelf(0, *theChannel) < 0 ||
+		(m_test != 0 && m_test->sendSelf(0, *theChannel) < 0)) {
+		opserr << "MultiRecordAnalysis::analyze() - an analysis object failed in sendSelf\n";
+		return -1;
+	}
+
+	return 0;
+}
+
+int MultiRecordAnalysis::runRecord(int index, int numSteps, double dt)
+{
+	Record& record = m_records[index];
+	MemoryChannel* theChannel = m_channel;
+	AnalysisCopy copy;
+
+	// rebuild the model and the analysis objects from the snapshot and
+	// add the excitation for this record
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		theChannel->rewind();
+
+		copy.domain = new Domain();
+		if (copy.domain->recvSelf(0, *theChannel, *m_broker) < 0) {
+			opserr << "MultiRecordAnalysis::analyze() - the Domain failed in recvSelf\n";
+			copy.clear();
+			return -1;
+		}
+
+		ID data(7);
+		theChannel->recvID(0, 0, data);
+		copy.handler = m_broker->getNewConstraintHandler(data(0));
+		copy.numberer = m_broker->getNewNumberer(data(1));
+		copy.algorithm = m_broker->getNewEquiSolnAlgo(data(2));
+		copy.soe = m_broker->getNewLinearSOE(data(3));
+		copy.integrator = m_broker->getNewTransientIntegrator(data(5));
+		if (data(6) != -1)
+			copy.test = m_broker->getNewConvergenceTest(data(6));
+		LinearSOESolver* theSolver = copy.soe != 0 ? copy.soe->getSolver() : 0;
+		if (copy.handler == 0 || copy.numberer == 0 || copy.algorithm == 0 ||
+			theSolver == 0 || theSolver->getClassTag() != data(4) ||
+			copy.integrator == 0 || (data(6) != -1 && copy.test == 0)) {
+			opserr << "MultiRecordAnalysis::analyze() - the FEM_ObjectBroker cannot create"
+				" a copy of the analysis objects\n";
+			copy.clear();
+			return -1;
+		}
+		if (copy.handler->recvSelf(0, *theChannel, *m_broker) < 0 ||
+			copy.numberer->recvSelf(0, *theChannel, *m_broker) < 0 ||
+			copy.algorithm->recvSelf(0, *theChannel, *m_broker) < 0 ||
+			copy.soe->recvSelf(0, *theChannel, *m_broker) < 0 ||
+			theSolver->recvSelf(0, *theChannel, *m_broker) < 0 ||
+			copy.integrator->recvSelf(0, *theChannel, *m_broker) < 0 ||
+			(copy.test != 0 && copy.test->recvSelf(0, *theChannel, *m_broker) < 0)) {
+			opserr << "MultiRecordAnalysis::analyze() - an analysis object failed in recvSelf\n";
+			copy.clear();
+			return -1;
+		}
+
+		// each record gets its own copy of the series, the series
+		// cache their position in the data
+		TimeSeries* theSeries = record.series->getCopy();
+		GroundMotion* theMotion = new GroundMotion(0, 0, theSeries, 0);
+		LoadPattern* thePattern = new UniformExcitation(*theMotion, record.direction - 1,
+			m_pattern_tag, 0.0, record.scale);
+		if (copy.domain->addLoadPattern(thePattern) == false) {
+			opserr << "MultiRecordAnalysis::analyze() - failed to add the excitation of record "
+				<< index + 1 << "\n";
+			delete thePattern;
+			copy.clear();
+			return -1;
+		}
+	}
+
+	AnalysisModel* theModel = new AnalysisModel();
+	copy.algorithm->setConvergenceTest(copy.test);
+	DirectIntegrationAnalysis theAnalysis(*copy.domain, *copy.handler, *copy.numberer,
+		*theModel, *copy.algorithm, *copy.soe, *copy.integrator, copy.test);
+
+	// run the record, gathering the response after each step
+	int width = this->getResponseWidth();
+	record.response.clear();
+	record.response.reserve((std::size_t)numSteps * width);
+	record.numStepsDone = 0;
+	std::vector<Node*> nodes(m_outputs.size());
+	for (std::size_t i = 0; i < m_outputs.size(); ++i)
+		nodes[i] = copy.domain->getNode(m_outputs[i].node);
+
+	for (int step = 0; step < numSteps; ++step) {
+		if (theAnalysis.analyze(1, dt) < 0) {
+			opserr << "MultiRecordAnalysis::analyze() - record " << index + 1
+				<< " failed at step " << step + 1 << "\n";
+			break;
+		}
+		record.response.push_back(copy.domain->getCurrentTime());
+		for (std::size_t i = 0; i < m_outputs.size(); ++i) {
+			const NodeResponse& output = m_outputs[i];
+			if (output.type == Vel)
+				record.response.push_back(nodes[i]->getVel()(output.dof));
+			else if (output.type == Accel)
+				record.response.push_back(nodes[i]->getAccel()(output.dof));
+			else
+				record.response.push_back(nodes[i]->getDisp()(output.dof));
+		}
+		record.numStepsDone = step + 1;
+	}
+
+	// clearAll() deletes the analysis objects, the Domain goes last
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		theAnalysis.clearAll();
+		delete copy.domain;
+	}
+
+	return 0;
+}
+
+void MultiRecordAnalysis::runWorker(int numSteps, double dt)
+{
+	while (true) {
+		int index;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			index = m_next_record++;
+		}
+		if (index >= (int)m_records.size())
+			break;
+		if (this->runRecord(index, numSteps, dt) < 0)
+			m_records[index].numStepsDone = -1;
+	}
+}
+
+int MultiRecordAnalysis::analyze(int numSteps, double dt, int numThreads)
+{
+	if (m_records.size() == 0)
+		return 0;
+
+	if (this->snapshot() < 0)
+		return -1;
+
+	// the records are handed out one at a time, so a thread finishing
+	// a short record picks up the next one
+	m_next_record = 0;
+	if (numThreads > (int)m_records.size())
+		numThreads = (int)m_records.size();
+
+	// the copies are only run concurrently if no element class shares
+	// scratch storage, or materials that do, between its instances
+	if (numThreads > 1) {
+		Element* theEle;
+		ElementIter& theEles = m_domain->getElements();
+		while ((theEle = theEles()) != 0) {
+			if (theEle->isThreadSafe() == false) {
+				opserr << "WARNING MultiRecordAnalysis::analyze() - element " << theEle->getTag()
+					<< " (" << theEle->getClassType() << ") is not thread safe, running the records on one thread\n";
+				numThreads = 1;
+				break;
+			}
+		}
+	}
+
+	if (numThreads <= 1) {
+		this->runWorker(numSteps, dt);
+	}
+	else {
+		std::vector<std::thread> workers;
+		for (int i = 0; i < numThreads; ++i)
+			workers.emplace_back(&MultiRecordAnalysis::runWorker, this, numSteps, dt);
+		for (std::thread& worker : workers)
+			worker.join();
+	}
+
+	for (const Record& record : m_records)
+		if (record.numStepsDone < 0)
+			return -1;
+
+	return 0;
+}
+
+int MultiRecordAnalysis::writeResponse(const char* fileBase) const
+{
+	int width = this->getResponseWidth();
+	for (std::size_t i = 0; i < m_records.size(); ++i) {
+		std::string fileName = std::string(fileBase) + "." + std::to_string(i + 1) + ".out";
+		std::ofstream theFile(fileName.c_str());
+		if (!theFile.is_open()) {
+			opserr << "MultiRecordAnalysis::writeResponse() - could not open file " << fileName.c_str() << "\n";
+			return -1;
+		}
+		theFile << std::setprecision(10);
+		const std::vector<double>& response = m_records[i].response;
+		for (std::size_t j = 0; j + width <= response.size(); j += width) {
+			for (int k = 0; k < width; ++k)
+				theFile << (k == 0 ? "" : " ") << response[j + k];
+			theFile << "\n";
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,130 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/MultiRecordAnalysis.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the class definition for MultiRecordAnalysis.
+// MultiRecordAnalysis runs the same model under a set of ground motion
+// records without rebuilding it for each one. The Domain and the transient
+// analysis objects are serialized once through their sendSelf() methods;
+// each record is then run on a fresh copy rebuilt with recvSelf() and the
+// FEM_ObjectBroker, with a UniformExcitation added for the record. The
+// records are distributed over a number of worker threads, if every
+// element of the model reports isThreadSafe(), and the nodal response
+// requested is gathered per record in memory.
+
+#ifndef MultiRecordAnalysis_h
+#define MultiRecordAnalysis_h
+
+#include <vector>
+#include <mutex>
+
+class Domain;
+class ConstraintHandler;
+class DOF_Numberer;
+class EquiSolnAlgo;
+class LinearSOE;
+class TransientIntegrator;
+class ConvergenceTest;
+class TimeSeries;
+class FEM_ObjectBroker;
+class MemoryChannel;
+
+class MultiRecordAnalysis
+{
+public:
+	// the response gathered at the nodes
+	enum ResponseType { Disp = 0, Vel = 1, Accel = 2 };
+
+	MultiRecordAnalysis(
+		Domain* theDomain,
+		ConstraintHandler* theHandler,
+		DOF_Numberer* theNumberer,
+		EquiSolnAlgo* theAlgorithm,
+		LinearSOE* theSOE,
+		TransientIntegrator* theIntegrator,
+		ConvergenceTest* theTest,
+		FEM_ObjectBroker* theBroker
+	);
+	~MultiRecordAnalysis();
+
+public:
+	// a record is an acceleration time series applied along a direction
+	// (1 to 6) with a scale factor
+	int addRecord(TimeSeries* theSeries, int theDirection, double scale);
+	int addNodeResponse(int nodeTag, int dof, int type = Disp);
+
+	int analyze(int numSteps, double dt, int numThreads = 1);
+
+	int getNumRecords(void) const;
+	// number of steps completed for a record (numSteps on success)
+	int getNumStepsDone(int record) const;
+	// rows of [time, response 1, response 2, ...], one per step
+	const std::vector<double>& getResponse(int record) const;
+	int getResponseWidth(void) const;
+	int writeResponse(const char* fileBase) const;
+
+private:
+	int snapshot();
+	int runRecord(int record, int numSteps, double dt);
+	void runWorker(int numSteps, double dt);
+
+private:
+	struct Record {
+		TimeSeries* series;
+		int direction;
+		double scale;
+		int numStepsDone;
+		std::vector<double> response;
+	};
+	struct NodeResponse {
+		int node;
+		int dof;
+		int type;
+	};
+
+	// the model and the analysis objects that are copied
+	Domain* m_domain;
+	ConstraintHandler* m_handler;
+	DOF_Numberer* m_numberer;
+	EquiSolnAlgo* m_algorithm;
+	LinearSOE* m_soe;
+	TransientIntegrator* m_integrator;
+	ConvergenceTest* m_test;
+	FEM_ObjectBroker* m_broker;
+
+	std::vector<Record> m_records;
+	std::vector<NodeResponse> m_outputs;
+
+	// the serialized model and the tag of the pattern added for a record
+	MemoryChannel* m_channel;
+	int m_pattern_tag;
+
+	// next record to be run and the lock taken while objects are
+	// rebuilt; recvSelf() implementations are not reentrant
+	int m_next_record;
+	std::mutex m_mutex;
+};
+
+#endif
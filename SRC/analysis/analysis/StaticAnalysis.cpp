@@ -66,7 +66,7 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
  theDOF_Numberer(&theNumberer), theAnalysisModel(&theModel), 
  theAlgorithm(&theSolnAlgo), theSOE(&theLinSOE), theEigenSOE(0),
  theIntegrator(&theStaticIntegrator), theTest(theConvergenceTest),
- domainStamp(0)
+ domainStamp(0), modelStamp(0)
 {
     // first we set up the links needed by the elements in the 
     // aggregation
@@ -365,6 +365,23 @@ StaticAnalysis::domainChanged(void)
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
 
+    // if elements have only been removed since the model was built
+    // their FE_Elements are dropped and the numbering and the system
+    // structure are kept, the removed entries simply no longer assembled
+    ID removedEles(0, 8);
+    if (modelStamp != 0 && the_Domain->getRemovedElements(modelStamp, removedEles) == true &&
+	theConstraintHandler->removeElements(removedEles) == 0) {
+	modelStamp = stamp;
+	if (theIntegrator->domainChanged() < 0 || theAlgorithm->domainChanged() < 0) {
+	    opserr << "StaticAnalysis::domainChanged() - ";
+	    opserr << "failed to update the Integrator or Algorithm\n";
+	    modelStamp = 0;
+	    return -4;
+	}
+	return 0;
+    }
+    modelStamp = 0;
+
     // Timer theTimer; theTimer.start();
     // opserr << "StaticAnalysis::domainChanged(void)\n";
 
@@ -446,6 +463,7 @@ StaticAnalysis::domainChanged(void)
     }	        
 
     // if get here successful
+    modelStamp = stamp;
     return 0;
 }    
 
@@ -462,6 +480,7 @@ StaticAnalysis::setNumberer(DOF_Numberer &theNewNumberer)
 
     // invoke domainChanged() either indirectly or directly
     domainStamp = 0;
+    modelStamp = 0;
 
     return 0;
 }
@@ -508,6 +527,7 @@ StaticAnalysis::setIntegrator(StaticIntegrator &theNewIntegrator)
 
     // cause domainChanged to be invoked on next analyze
     domainStamp = 0;
+    modelStamp = 0;
 
     /*
     if (domainStamp != 0)
@@ -541,6 +561,7 @@ StaticAnalysis::setLinearSOE(LinearSOE &theNewSOE)
     }
     */
     domainStamp = 0;
+    modelStamp = 0;
     return 0;
 }
 
@@ -567,6 +588,7 @@ StaticAnalysis::setEigenSOE(EigenSOE &theNewSOE)
     }
     */
     domainStamp = 0;
+    modelStamp = 0;
   }
   
   return 0;
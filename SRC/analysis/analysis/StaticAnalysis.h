@@ -91,6 +91,7 @@ class StaticAnalysis: public Analysis
     StaticIntegrator    *theIntegrator;
     ConvergenceTest     *theTest;
     int domainStamp;
+    int modelStamp;     // stamp the AnalysisModel was built for, 0 if none
 
 };
 
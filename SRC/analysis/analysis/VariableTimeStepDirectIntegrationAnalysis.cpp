@@ -40,6 +40,7 @@
 #include <Domain.h>
 #include <ConvergenceTest.h>
 #include <float.h>
+#include <math.h>
 #include <AnalysisModel.h>
 
 // Constructor
@@ -54,7 +55,8 @@ VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnal
 			      ConvergenceTest *theTest)
 
 :DirectIntegrationAnalysis(the_Domain, theHandler, theNumberer, theModel, 
-			   theSolnAlgo, theLinSOE, theTransientIntegrator, theTest)
+			   theSolnAlgo, theLinSOE, theTransientIntegrator, theTest),
+ errorControl(false), absTol(0.0), relTol(0.0), minFactor(0.2), maxFactor(2.0)
 {
 
 }    
@@ -64,9 +66,24 @@ VariableTimeStepDirectIntegrationAnalysis::~VariableTimeStepDirectIntegrationAna
 
 }    
 
+void
+VariableTimeStepDirectIntegrationAnalysis::setErrorControl(double aTol, double rTol,
+							   double minF, double maxF)
+{
+  errorControl = true;
+  absTol = aTol;
+  relTol = rTol;
+  minFactor = (minF > 0.0 && minF < 1.0) ? minF : 0.2;
+  maxFactor = (maxF > 1.0) ? maxF : 2.0;
+}
+
+
 int 
 VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, double dtMin, double dtMax, int Jd, bool flush)
 {
+  if (errorControl == true)
+    return this->analyzeErrorControl(numSteps, dT, dtMin, dtMax, flush);
+
   // get some pointers
   Domain *theDom = this->getDomainPtr();
   EquiSolnAlgo *theAlgo = this->getAlgorithm();
@@ -178,6 +195,155 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
 
 
 
+int 
+VariableTimeStepDirectIntegrationAnalysis::analyzeErrorControl(int numSteps, double dT, 
+							       double dtMin, double dtMax, 
+							       bool flush)
+{
+  // get some pointers
+  Domain *theDom = this->getDomainPtr();
+  EquiSolnAlgo *theAlgo = this->getAlgorithm();
+  TransientIntegrator *theIntegratr = this->getIntegrator();
+  AnalysisModel *theModel = this->getModel();
+
+  // a step is accepted if the error norm is <= 1; the error being of
+  // order dt^3 the next dt is dt*(1/error)^1/3, reduced by a safety factor
+  const double safety = 0.9;
+
+  // set some variables
+  double totalTimeIncr = numSteps * dT;
+  double currentTimeIncr = 0.0;
+  double currentDt = (dT < dtMax) ? dT : dtMax;
+
+  // loop until analysis has performed the total time incr requested
+  while (currentTimeIncr < totalTimeIncr) {
+
+    // clamp the last step to the time remaining; the tolerance only
+    // absorbs round off in the accumulated increments
+    double stepDt = currentDt;
+    bool lastStep = false;
+    if (currentTimeIncr + stepDt >= totalTimeIncr*(1.0 - 1.0e-12)) {
+      stepDt = totalTimeIncr - currentTimeIncr;
+      lastStep = true;
+    }
+
+    if (theModel->analysisStep(stepDt) < 0) {
+      opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - the AnalysisModel failed in newStepDomain";
+      opserr << " at time " << theDom->getCurrentTime() << endln;
+      theDom->revertToLastCommit();
+      return -2;
+    }
+
+    if (this->checkDomainChange() != 0) {
+      opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - failed checkDomainChange\n";
+      return -1;
+    }
+
+    int result = 0;
+    if (theIntegratr->newStep(stepDt) < 0)
+      result = -2;
+
+    if (result >= 0) {
+      result = theAlgo->solveCurrentStep();
+      if (result < 0) 
+	result = -3;
+    }    
+
+    double error = 0.0;
+    if (result >= 0) {
+      error = theIntegratr->getLocalError(absTol, relTol);
+      if (error < 0.0) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - the integrator ";
+	opserr << "provides no error estimate for error controlled time stepping\n";
+	theDom->revertToLastCommit();	    
+	theIntegratr->revertToLastStep();
+	return -5;
+      }
+    }
+
+    // reject the step if it failed, or if its error is too large and 
+    // dt can still be reduced; revert and try again with a smaller dt
+    if (result < 0 || (error > 1.0 && stepDt > dtMin)) {
+
+      theDom->revertToLastCommit();	    
+      theIntegratr->revertToLastStep();
+
+      // if last dT was <= min specified the analysis FAILS - return FAILURE
+      if (stepDt <= dtMin) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - ";
+	opserr << " failed at time " << theDom->getCurrentTime() << endln;
+	return result;
+      }
+
+      double factor = minFactor;
+      if (result >= 0) {
+	factor = safety*pow(error, -1.0/3.0);
+	if (factor < minFactor)
+	  factor = minFactor;
+      }
+      currentDt = stepDt*factor;
+      if (currentDt < dtMin)
+	currentDt = dtMin;
+
+      continue;
+    }
+
+    // AddingSensitivity:BEGIN ////////////////////////////////////
+#ifdef _RELIABILITY
+    if (theIntegratr->shouldComputeAtEachStep()) {
+      if (theIntegratr->computeSensitivities() < 0) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - the SensitivityAlgorithm failed";
+	opserr << " at time " << theDom->getCurrentTime() << endln;
+	theDom->revertToLastCommit();
+	theIntegratr->revertToLastStep();
+	return -5;
+      }    
+    }
+#endif
+    // AddingSensitivity:END //////////////////////////////////////
+
+    if (theIntegratr->commit() < 0) {
+      opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - ";
+      opserr << "the Integrator failed to commit at time " << theDom->getCurrentTime() << endln;
+      theDom->revertToLastCommit();	    
+      theIntegratr->revertToLastStep();
+      return -4;
+    }
+
+    if (lastStep == true)
+      currentTimeIncr = totalTimeIncr;
+    else
+      currentTimeIncr += stepDt;
+
+    // now we determine a new delta T for next loop, keeping it while
+    // the integrator is between the sub-steps of a composite scheme
+    if (theIntegratr->canChangeDeltaT() == true) {
+      double factor = maxFactor;
+      if (error > 0.0) {
+	factor = safety*pow(error, -1.0/3.0);
+	if (factor > maxFactor)
+	  factor = maxFactor;
+	else if (factor < minFactor)
+	  factor = minFactor;
+      }
+      currentDt = stepDt*factor;
+    } else
+      currentDt = stepDt;
+
+    if (currentDt > dtMax)
+      currentDt = dtMax;
+    else if (currentDt < dtMin)
+      currentDt = dtMin;
+  }
+
+  if (theDom != 0 && flush) {
+    theDom->flushRecorders();
+  }
+
+  return 0;
+}
+
+
 double 
 VariableTimeStepDirectIntegrationAnalysis::determineDt(double dT, 
 						       double dtMin, 
@@ -34,6 +34,10 @@
 // VariableTimeStepDirectIntegrationAnalysis. VariableTimeStepDirectIntegrationAnalysis 
 // is a subclass of DirectIntegrationAnalysis. It is used to perform a 
 // dynamic analysis on the FE\_Model using a direct integration scheme.  
+// By default the time step is chosen from the number of iterations of
+// the last step; with setErrorControl() it is chosen from the local
+// error estimate of the integrator, steps with too large an error being
+// rejected and repeated with a smaller time step.
 //
 // What: "@(#) VariableTimeStepDirectIntegrationAnalysis.h, revA"
 
@@ -63,11 +67,22 @@ class VariableTimeStepDirectIntegrationAnalysis: public DirectIntegrationAnalysi
     int analyze(int numSteps, double dT, double dtMin, double dtMax,
                 int Jd, bool flush = true);
 
+    // error controlled time stepping; the factors bound the change in dt
+    // from one step to the next
+    void setErrorControl(double absTol, double relTol,
+			 double minFactor = 0.2, double maxFactor = 2.0);
+
    protected:
     virtual double determineDt(double dT, double dtMin, double dtMax, int Jd,
 			       ConvergenceTest *theTest);
 
   private:
+    int analyzeErrorControl(int numSteps, double dT, double dtMin, double dtMax,
+			    bool flush);
+
+    bool errorControl;
+    double absTol, relTol;
+    double minFactor, maxFactor;
 };
 
 #endif
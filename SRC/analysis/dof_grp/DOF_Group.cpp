@@ -42,6 +42,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TransientIntegrator.h>
+#include <FE_Workspace.h>
 
 #define MAX_NUM_DOF 256
 
@@ -49,9 +50,6 @@
 // static variables initialisation
 Matrix DOF_Group::errMatrix(1,1);
 Vector DOF_Group::errVect(1);
-Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
-Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
-int DOF_Group::numDOFs(0);           // number of objects
 
 
 //  DOF_Group(Node *);
@@ -82,44 +80,9 @@ DOF_Group::DOF_Group(int tag, Node *node)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "DOF_Group::DOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-    
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
-		tangent == 0 || tangent->noCols() != numDOF)	{  
-		opserr << "DOF_Group::DOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
-    } else {
+    // set the pointers for the tangent and residual; up to
+    // MAX_NUM_DOF the thread's FE_Workspace objects are used
+    if (numDOF > MAX_NUM_DOF) {
 	// create matrices and vectors for each object instance
 	unbalance = new Vector(numDOF);
 	tangent = new Matrix(numDOF, numDOF);
@@ -132,8 +95,6 @@ DOF_Group::DOF_Group(int tag, Node *node)
 	    exit(-1);
 	}
     }
-    
-    numDOFs++;
 }
 
 
@@ -162,48 +123,13 @@ DOF_Group::DOF_Group(int tag, int ndof)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
-		tangent == 0 || tangent->noCols() != numDOF)	{  
-		opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
-    } else {
+    // set the pointers for the tangent and residual; up to
+    // MAX_NUM_DOF the thread's FE_Workspace objects are used
+    if (numDOF > MAX_NUM_DOF) {
 	// create matrices and vectors for each object instance
 	unbalance = new Vector(numDOF);
 	tangent = new Matrix(numDOF, numDOF);
-	if (unbalance == 0 || tangent ==0 ||
+	if (unbalance == 0 || unbalance->Size() ==0 ||
 	    tangent ==0 || tangent->noRows() ==0) {
 	    
 	    opserr << "DOF_Group::DOF_Group(int, int ndof) ";
@@ -212,8 +138,6 @@ DOF_Group::DOF_Group(int tag, int ndof)
 	    exit(-1);
 	}
     }
-    
-    numDOFs++;
 }
 
 // ~DOF_Group();    
@@ -221,35 +145,34 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
 DOF_Group::~DOF_Group()
 {
-    numDOFs--;
-
-    int numDOF = unbalance->Size();
-
     // set the pointer in the associated Node to 0, to stop
     // segmentation fault if node tries to use this object after destroyed
     if (myNode != 0) 
       myNode->setDOF_GroupPtr(0);
 
     // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
-	if (tangent != 0) delete tangent;
-	if (unbalance != 0) delete unbalance;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
-    }    
+    if (tangent != 0) delete tangent;
+    if (unbalance != 0) delete unbalance;
 }    
 
+Matrix &
+DOF_Group::tangentMatrix(void)
+{
+    if (tangent != 0)
+	return *tangent;
+
+    return FE_Workspace::getWorkspace().getMatrix(FE_Workspace::DOF_Tangent, numDOF);
+}
+
+Vector &
+DOF_Group::unbalanceVector(void)
+{
+    if (unbalance != 0)
+	return *unbalance;
+
+    return FE_Workspace::getWorkspace().getVector(FE_Workspace::DOF_Unbalance, numDOF);
+}
+
 // void setID(int index, int value);
 //	Method to set the corresponding index of the ID to value.
 
@@ -337,13 +260,13 @@ DOF_Group::getTangent(Integrator *theIntegrator)
 {	
     if (theIntegrator != 0)
 	theIntegrator->formNodTangent(this);    
-    return *tangent;
+    return this->tangentMatrix();
 }
 
 void  
 DOF_Group::zeroTangent(void)
 {
-    tangent->Zero();
+    this->tangentMatrix().Zero();
 }
 
 
@@ -351,7 +274,7 @@ void
 DOF_Group::addMtoTang(double fact)
 {
     if (myNode != 0) {
-	if (tangent->addMatrix(1.0, myNode->getMass(), fact) < 0) {
+	if (this->tangentMatrix().addMatrix(1.0, myNode->getMass(), fact) < 0) {
 	    opserr << "DOF_Group::addMtoTang(void) ";
 	    opserr << " invoking addMatrix() on the tangent failed\n";	    
 	}
@@ -367,7 +290,7 @@ void
 DOF_Group::addCtoTang(double fact)
 {
     if (myNode != 0) {
-	if (tangent->addMatrix(1.0, myNode->getDamp(), fact) < 0) {
+	if (this->tangentMatrix().addMatrix(1.0, myNode->getDamp(), fact) < 0) {
 	    opserr << "DOF_Group::addMtoTang(void) ";
 	    opserr << " invoking addMatrix() on the tangent failed\n";	    
 	}
@@ -383,7 +306,7 @@ DOF_Group::addCtoTang(double fact)
 void
 DOF_Group::zeroUnbalance(void) 
 {
-    unbalance->Zero();
+    this->unbalanceVector().Zero();
 }
 
 
@@ -393,7 +316,7 @@ DOF_Group::getUnbalance(Integrator *theIntegrator)
     if (theIntegrator != 0)
 	theIntegrator->formNodUnbalance(this);
 
-    return *unbalance;
+    return this->unbalanceVector();
 }
 
 
@@ -401,7 +324,7 @@ void
 DOF_Group::addPtoUnbalance(double fact)
 {
     if (myNode != 0) {
-	if (unbalance->addVector(1.0, myNode->getUnbalancedLoad(), fact) < 0) {
+	if (this->unbalanceVector().addVector(1.0, myNode->getUnbalancedLoad(), fact) < 0) {
 	    opserr << "DOF_Group::addPIncInertiaToUnbalance() -";
 	    opserr << " invoking addVector() on the unbalance failed\n";	    
 	}
@@ -417,7 +340,7 @@ void
 DOF_Group::addPIncInertiaToUnbalance(double fact)
 {
     if (myNode != 0) {
-	if (unbalance->addVector(1.0, myNode->getUnbalancedLoadIncInertia(), 
+	if (this->unbalanceVector().addVector(1.0, myNode->getUnbalancedLoadIncInertia(), 
 				 fact) < 0) {
 
 	    opserr << "DOF_Group::addPIncInertiaToUnbalance() - ";
@@ -449,7 +372,7 @@ DOF_Group::addM_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 	
-    if (unbalance->addMatrixVector(1.0, myNode->getMass(), accel, fact) < 0) {  
+    if (this->unbalanceVector().addMatrixVector(1.0, myNode->getMass(), accel, fact) < 0) {  
 	opserr << "DOF_Group::addM_Force() ";
 	opserr << " invoking addMatrixVector() on the unbalance failed\n";
     }
@@ -464,7 +387,7 @@ const Vector &
 DOF_Group::getTangForce(const Vector &Udotdot, double fact)
 {
   opserr << "DOF_Group::getTangForce() - not yet implemented";
-  return *unbalance;
+  return this->unbalanceVector();
 }
 
 
@@ -474,7 +397,7 @@ DOF_Group::getM_Force(const Vector &Udotdot, double fact)
     if (myNode == 0) {
 	opserr << "DOF_Group::getM_Force() - no Node associated";	
 	opserr << " subclass should not call this method \n";	    
-	return *unbalance;
+	return this->unbalanceVector();
     }
 
     Vector accel(numDOF);
@@ -486,12 +409,12 @@ DOF_Group::getM_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 	
-    if (unbalance->addMatrixVector(0.0, myNode->getMass(), accel, fact) < 0) {  
+    if (this->unbalanceVector().addMatrixVector(0.0, myNode->getMass(), accel, fact) < 0) {  
 	opserr << "DOF_Group::getM_Force() ";
 	opserr << " invoking addMatrixVector() on the unbalance failed\n";
     }
     
-    return *unbalance;
+    return this->unbalanceVector();
 }
 
 
@@ -502,7 +425,7 @@ DOF_Group::getC_Force(const Vector &Udotdot, double fact)
     if (myNode == 0) {
 	opserr << "DOF_Group::getC_Force() - no Node associated";	
 	opserr << " subclass should not call this method \n";	    
-	return *unbalance;
+	return this->unbalanceVector();
     }
 
     Vector accel(numDOF);
@@ -514,11 +437,11 @@ DOF_Group::getC_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 	
-    if (unbalance->addMatrixVector(0.0, myNode->getDamp(), accel, fact) < 0) {  
+    if (this->unbalanceVector().addMatrixVector(0.0, myNode->getDamp(), accel, fact) < 0) {  
 	opserr << "DOF_Group::getC_Force() ";
 	opserr << " invoking addMatrixVector() on the unbalance failed\n";
     }
-    return *unbalance;
+    return this->unbalanceVector();
 }
 
 
@@ -569,7 +492,7 @@ DOF_Group::setNodeDisp(const Vector &u)
 	return;
     }
     
-    Vector &disp = *unbalance;
+    Vector &disp = this->unbalanceVector();
     disp = myNode->getTrialDisp();
     int i;
     
@@ -597,7 +520,7 @@ DOF_Group::setNodeVel(const Vector &udot)
 	return;
     }
     
-    Vector &vel = *unbalance;
+    Vector &vel = this->unbalanceVector();
     vel = myNode->getTrialVel();
     int i;
     
@@ -627,7 +550,7 @@ DOF_Group::setNodeAccel(const Vector &udotdot)
 	return;
     }
 
-    Vector &accel = *unbalance;;
+    Vector &accel = this->unbalanceVector();;
     accel = myNode->getTrialAccel();
     int i;
     
@@ -654,7 +577,7 @@ DOF_Group::incrNodeDisp(const Vector &u)
 	exit(-1);
     }
 
-    Vector &disp = *unbalance;;
+    Vector &disp = this->unbalanceVector();;
 
     if (disp.Size() == 0) {
       opserr << "DOF_Group::incrNodeDisp - out of space\n";
@@ -687,7 +610,7 @@ DOF_Group::incrNodeVel(const Vector &udot)
 	exit(-1);
     }
     
-    Vector &vel = *unbalance;
+    Vector &vel = this->unbalanceVector();
     int i;
     
     // get vel for my dof out of vector udot
@@ -715,7 +638,7 @@ DOF_Group::incrNodeAccel(const Vector &udotdot)
 	exit(-1);
     }
 
-    Vector &accel = *unbalance;
+    Vector &accel = this->unbalanceVector();
     int i;
     
     // get disp for the unconstrained dof
@@ -773,7 +696,7 @@ DOF_Group::setEigenvector(int mode, const Vector &theVector)
 	exit(-1);
     }
 
-    Vector &eigenvector = *unbalance;
+    Vector &eigenvector = this->unbalanceVector();
     int i;
     
     // get disp for the unconstrained dof
@@ -813,7 +736,7 @@ void
 DOF_Group::addLocalM_Force(const Vector &accel, double fact)
 {
     if (myNode != 0) {
-	if (unbalance->addMatrixVector(1.0, myNode->getMass(), accel, fact) < 0) {  
+	if (this->unbalanceVector().addMatrixVector(1.0, myNode->getMass(), accel, fact) < 0) {  
 				       
 	    opserr << "DOF_Group::addLocalM_Force() ";
 	    opserr << " invoking addMatrixVector() on the unbalance failed\n"; 
@@ -830,7 +753,7 @@ DOF_Group::addLocalM_Force(const Vector &accel, double fact)
 const Vector &
 DOF_Group::getDispSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = this->unbalanceVector();
 	for (int i=0; i<numDOF; i++) {
 		result(i) = myNode->getDispSensitivity(i+1,gradNumber);
 	}
@@ -840,7 +763,7 @@ DOF_Group::getDispSensitivity(int gradNumber)
 const Vector &
 DOF_Group::getVelSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = this->unbalanceVector();
 	for (int i=0; i<numDOF; i++) {
 		result(i) = myNode->getVelSensitivity(i+1,gradNumber);
 	}
@@ -850,7 +773,7 @@ DOF_Group::getVelSensitivity(int gradNumber)
 const Vector &
 DOF_Group::getAccSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = this->unbalanceVector();
 	for (int i=0; i<numDOF; i++) {
 		result(i) = myNode->getAccSensitivity(i+1,gradNumber);
 	}
@@ -862,7 +785,7 @@ DOF_Group::getAccSensitivity(int gradNumber)
 int 
 DOF_Group::saveDispSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = this->unbalanceVector();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -878,7 +801,7 @@ DOF_Group::saveDispSensitivity(const Vector &v, int gradNum, int numGrads)
 int 
 DOF_Group::saveVelSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = this->unbalanceVector();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -894,7 +817,7 @@ DOF_Group::saveVelSensitivity(const Vector &v, int gradNum, int numGrads)
 int 
 DOF_Group::saveAccSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = this->unbalanceVector();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -939,7 +862,7 @@ DOF_Group::addM_ForceSensitivity(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 	
-    if (unbalance->addMatrixVector(1.0, myNode->getMassSensitivity(), accel, fact) < 0) {  
+    if (this->unbalanceVector().addMatrixVector(1.0, myNode->getMassSensitivity(), accel, fact) < 0) {  
 	opserr << "DOF_Group::addM_Force() ";
 	opserr << " invoking addMatrixVector() on the unbalance failed\n";
     }
@@ -966,7 +889,7 @@ DOF_Group::addD_Force(const Vector &Udot, double fact)
         else vel(i) = 0.0;
     }
 
-    if (unbalance->addMatrixVector(1.0, myNode->getDamp(), vel, fact) < 0) {
+    if (this->unbalanceVector().addMatrixVector(1.0, myNode->getDamp(), vel, fact) < 0) {
         opserr << "DOF_Group::addD_Force() ";
         opserr << " invoking addMatrixVector() on the unbalance failed\n";
     }
@@ -993,7 +916,7 @@ DOF_Group::addD_ForceSensitivity(const Vector &Udot, double fact)
         else vel(i) = 0.0;
     }
 
-    if (unbalance->addMatrixVector(1.0, myNode->getDampSensitivity(), vel, fact) < 0) {
+    if (this->unbalanceVector().addMatrixVector(1.0, myNode->getDampSensitivity(), vel, fact) < 0) {
         opserr << "DOF_Group::addD_ForceSensitivity() ";
         opserr << " invoking addMatrixVector() on the unbalance failed\n";
     }
@@ -1041,6 +964,6 @@ DOF_Group::getDampingBetaForce(int mode, double beta)
   for (int i=0; i<numDOF; i++)
     eigenvector(i) = eigenVectors(i,mode);
 
-  unbalance->addMatrixVector(0.0, mass, eigenvector, -beta);
-  return *unbalance;
+  this->unbalanceVector().addMatrixVector(0.0, mass, eigenvector, -beta);
+  return this->unbalanceVector();
 }
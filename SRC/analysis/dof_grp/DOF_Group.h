@@ -134,9 +134,13 @@ class DOF_Group: public TaggedObject
    protected:
     void  addLocalM_Force(const Vector &Udotdot, double fact = 1.0);     
 
+    // the objects used to form the tangent and unbalance
+    Matrix &tangentMatrix(void);
+    Vector &unbalanceVector(void);
+
     // protected variables - a copy for each object of the class            
-    Vector *unbalance;
-    Matrix *tangent;
+    Vector *unbalance;  // 0 if the FE_Workspace vector is used
+    Matrix *tangent;    // 0 if the FE_Workspace matrix is used
     Node *myNode;
     
   private:
@@ -147,9 +151,6 @@ class DOF_Group: public TaggedObject
     // static variables - single copy for all objects of the class	    
     static Matrix errMatrix;
     static Vector errVect;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;           // number of objects    
 };
 
 #endif
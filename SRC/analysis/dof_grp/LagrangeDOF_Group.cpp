@@ -76,19 +76,9 @@ const Matrix &
 LagrangeDOF_Group::getTangent(Integrator *theIntegrator)
 {
     // does nothing - the Lagrange FE_Elements provide coeffs to tangent
-    if (tangent == 0) {
-	int numDOF = this->getNumDOF();
-	tangent = new Matrix(numDOF,numDOF);
-	
-	if (tangent == 0) {
-	    opserr << "FATAL LagrangeDOF_Group::getTangent() ";
-	    opserr << " ranout of memory\n";
-	    exit(-1);
-	}
-    }
-    
-    tangent->Zero();
-    return *tangent;
+    Matrix &theTangent = this->tangentMatrix();
+    theTangent.Zero();
+    return theTangent;
     
 }
 
@@ -96,8 +86,9 @@ const Vector &
 LagrangeDOF_Group::getUnbalance(Integrator *theIntegrator)
 {
     // does nothing - the Lagrange FE_Elements provide residual 
-    unbalance->Zero();
-    return *unbalance;
+    Vector &theUnbalance = this->unbalanceVector();
+    theUnbalance.Zero();
+    return theUnbalance;
 }
 
 // void setNodeDisp(const Vector &u);
@@ -204,15 +195,17 @@ LagrangeDOF_Group::getCommittedDisp(void)
 const Vector &
 LagrangeDOF_Group::getCommittedVel(void)
 {
-    unbalance->Zero();
-    return *unbalance;
+    Vector &theUnbalance = this->unbalanceVector();
+    theUnbalance.Zero();
+    return theUnbalance;
 }
 
 const Vector &
 LagrangeDOF_Group::getCommittedAccel(void)
 {
-    unbalance->Zero();
-    return *unbalance;
+    Vector &theUnbalance = this->unbalanceVector();
+    theUnbalance.Zero();
+    return theUnbalance;
 }
 
 const Vector& LagrangeDOF_Group::getTrialDisp()
@@ -222,14 +215,16 @@ const Vector& LagrangeDOF_Group::getTrialDisp()
 
 const Vector& LagrangeDOF_Group::getTrialVel()
 {
-    unbalance->Zero();
-    return *unbalance;
+    Vector &theUnbalance = this->unbalanceVector();
+    theUnbalance.Zero();
+    return theUnbalance;
 }
 
 const Vector& LagrangeDOF_Group::getTrialAccel()
 {
-    unbalance->Zero();
-    return *unbalance;
+    Vector &theUnbalance = this->unbalanceVector();
+    theUnbalance.Zero();
+    return theUnbalance;
 }
 
 void  
@@ -269,22 +264,25 @@ const Vector &
 LagrangeDOF_Group::getTangForce(const Vector &disp, double fact)
 {
   opserr << "WARNING LagrangeDOF_Group::getTangForce() - not yet implemented\n";
-  unbalance->Zero();
-  return *unbalance;
+  Vector &theUnbalance = this->unbalanceVector();
+  theUnbalance.Zero();
+  return theUnbalance;
 }
 
 const Vector &
 LagrangeDOF_Group::getC_Force(const Vector &disp, double fact)
 {
-  unbalance->Zero();
-  return *unbalance;
+  Vector &theUnbalance = this->unbalanceVector();
+  theUnbalance.Zero();
+  return theUnbalance;
 }
 
 const Vector &
 LagrangeDOF_Group::getM_Force(const Vector &disp, double fact)
 {
-  unbalance->Zero();
-  return *unbalance;
+  Vector &theUnbalance = this->unbalanceVector();
+  theUnbalance.Zero();
+  return theUnbalance;
 }
 
 
@@ -44,13 +44,11 @@
 #include <SP_Constraint.h>
 #include <SP_ConstraintIter.h>
 #include <TransformationConstraintHandler.h>
+#include <FE_Workspace.h>
 
 #define MAX_NUM_DOF 16
 
 // static variables initialisation
-Matrix **TransformationDOF_Group::modMatrices; 
-Vector **TransformationDOF_Group::modVectors;  
-int TransformationDOF_Group::numTransDOFs(0);     // number of objects
 TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
 
 TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, 
@@ -119,44 +117,9 @@ TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node,
     for (int k=numConstrainedNodeRetainedDOF; k<modNumDOF; k++)
 	(*modID)(k) = -1;
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
-    // set the pointers for the modTangent and residual
-    if (modNumDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[modNumDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    modVectors[modNumDOF] = new Vector(modNumDOF);
-	    modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-		modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-		opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << modNumDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	}
-    } else {
+    // set the pointers for the modTangent and residual; up to
+    // MAX_NUM_DOF the thread's FE_Workspace objects are used
+    if (modNumDOF > MAX_NUM_DOF) {
 	// create matrices and vectors for each object instance
 	modUnbalance = new Vector(modNumDOF);
 	modTangent = new Matrix(modNumDOF, modNumDOF);
@@ -175,7 +138,6 @@ TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node,
     modTotalDisp = getTrialDisp();
 #endif // TRANSF_INCREMENTAL_MP
     
-    numTransDOFs++;
     theHandler = theTHandler;
 }
 
@@ -215,29 +177,11 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 	}
     }    
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
 #ifdef TRANSF_INCREMENTAL_MP
     modTotalDisp.resize(modNumDOF);
     modTotalDisp = getTrialDisp();
 #endif // TRANSF_INCREMENTAL_MP
 
-    numTransDOFs++;
     theHandler = theTHandler;
 }
 
@@ -247,33 +191,34 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 
 TransformationDOF_Group::~TransformationDOF_Group()
 {
-    numTransDOFs--;
-
     // delete modTangent and residual if created specially
-    if (modNumDOF > MAX_NUM_DOF) {
-	if (modTangent != 0) delete modTangent;
-	if (modUnbalance != 0) delete modUnbalance;
-    }
+    if (modTangent != 0) delete modTangent;
+    if (modUnbalance != 0) delete modUnbalance;
     
     if (modID != 0) delete modID;
     if (Trans != 0) delete Trans;
     if (theSPs != 0) delete [] theSPs;
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}	
-	delete [] modMatrices;
-	delete [] modVectors;
-    }    
 }    
 
 
+Matrix &
+TransformationDOF_Group::modTangentMatrix(void)
+{
+    if (modTangent != 0)
+	return *modTangent;
+
+    return FE_Workspace::getWorkspace().getMatrix(FE_Workspace::TransformationDOF_Tangent, modNumDOF);
+}
+
+Vector &
+TransformationDOF_Group::modUnbalanceVector(void)
+{
+    if (modUnbalance != 0)
+	return *modUnbalance;
+
+    return FE_Workspace::getWorkspace().getVector(FE_Workspace::TransformationDOF_Unbalance, modNumDOF);
+}
+
 const ID &
 TransformationDOF_Group::getID(void) const
 {
@@ -326,9 +271,9 @@ TransformationDOF_Group::getTangent(Integrator *theIntegrator)
     const Matrix &unmodTangent = this->DOF_Group::getTangent(theIntegrator);
     Matrix *T = this->getT();
     if (T != 0) {
-	// *modTangent = (*T) ^ unmodTangent * (*T);
-	modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
-	return *modTangent;
+	// this->modTangentMatrix() = (*T) ^ unmodTangent * (*T);
+	this->modTangentMatrix().addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
+	return this->modTangentMatrix();
 	
     } else 
       return unmodTangent;
@@ -342,12 +287,12 @@ TransformationDOF_Group::getEigenvectors(void)
     const Matrix &unmodTangent = this->DOF_Group::getEigenvectors();
     Matrix *T = this->getT();
     if (T != 0) {
-	// *modTangent = (*T) ^ unmodTangent * (*T);
-      static Matrix res;
-      res = (*T) ^ unmodTangent;
+	// this->modTangentMatrix() = (*T) ^ unmodTangent * (*T);
+      Matrix &res = FE_Workspace::getWorkspace().getScratchMatrix(FE_Workspace::TransformationDOF_Temp, T->noCols(), unmodTangent.noCols());
+      res.addMatrixTransposeProduct(0.0, *T, unmodTangent, 1.0);
       return res;
-      // modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
-      // return *modTangent;
+      // this->modTangentMatrix().addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
+      // return this->modTangentMatrix();
 	
     } else 
       return unmodTangent;
@@ -361,9 +306,9 @@ TransformationDOF_Group::getUnbalance(Integrator *theIntegrator)
 
     Matrix *T = this->getT();
     if (T != 0) {
-	// *modUnbalance = (*T) ^ unmodUnbalance;
-	modUnbalance->addMatrixTransposeVector(0.0, *T, unmodUnbalance, 1.0);
-	return *modUnbalance;    
+	// this->modUnbalanceVector() = (*T) ^ unmodUnbalance;
+	this->modUnbalanceVector().addMatrixTransposeVector(0.0, *T, unmodUnbalance, 1.0);
+	return this->modUnbalanceVector();    
     } else
 	return unmodUnbalance;
 }
@@ -389,17 +334,17 @@ TransformationDOF_Group::getCommittedDisp(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		this->modUnbalanceVector()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    this->modUnbalanceVector()(loc) = responseR(dof);
 	    loc++;
 	}
 
-	return *modUnbalance;
+	return this->modUnbalanceVector();
     }
 }
 
@@ -423,17 +368,17 @@ TransformationDOF_Group::getCommittedVel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		this->modUnbalanceVector()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    this->modUnbalanceVector()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return this->modUnbalanceVector();
     }
 }
 
@@ -458,17 +403,17 @@ TransformationDOF_Group::getCommittedAccel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		this->modUnbalanceVector()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    this->modUnbalanceVector()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return this->modUnbalanceVector();
     }
 }
 
@@ -481,7 +426,7 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
 {
 #ifdef TRANSF_INCREMENTAL_MP
     // save the previous mod trial here
-    static Vector modTrialDispOld;
+    Vector &modTrialDispOld = FE_Workspace::getWorkspace().getVector(FE_Workspace::TransformationDOF_Disp, modNumDOF);
     modTrialDispOld = modTotalDisp; // at previous iteration
 #endif // TRANSF_INCREMENTAL_MP
 
@@ -495,9 +440,9 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     else 
-      (*modUnbalance)(i) = 0.0;
+      this->modUnbalanceVector()(i) = 0.0;
   }
 
 
@@ -511,18 +456,18 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
     for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
       int loc = theID(i);
       if (loc < 0)
-	(*modUnbalance)(i) = responseR(retainedDOF(j));
+	this->modUnbalanceVector()(i) = responseR(retainedDOF(j));
     }
   }
 
 #ifdef TRANSF_INCREMENTAL_MP
-  modTotalDisp = *modUnbalance; // save it for next iteration
+  modTotalDisp = this->modUnbalanceVector(); // save it for next iteration
 #endif // TRANSF_INCREMENTAL_MP
 
   // at this point the modUnbalance contains the reduced total displacement.
   // remove the trial one to obtain the increment, so that we transform only the increment
 #ifdef TRANSF_INCREMENTAL_MP
-  modUnbalance->addVector(1.0, modTrialDispOld, -1.0);
+  this->modUnbalanceVector().addVector(1.0, modTrialDispOld, -1.0);
 #ifdef TRANSF_INCREMENTAL_MP_DEBUG
   opserr << " N = " << myNode->getTag() << "\n";
   opserr << " solut: " << u;
@@ -541,8 +486,8 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
 #endif // TRANSF_INCREMENTAL_MP
 
   Matrix *T = this->getT();
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+  this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
 
   const Vector &disp = myNode->getTrialDisp();
 
@@ -550,16 +495,16 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
 #ifdef TRANSF_INCREMENTAL_MP
-      (*unbalance)(i) = 0.0; // don't enfore the SP here as in incrNodeDisp!
+      this->unbalanceVector()(i) = 0.0; // don't enfore the SP here as in incrNodeDisp!
 #else
-      (*unbalance)(i) = disp(i);
+      this->unbalanceVector()(i) = disp(i);
 #endif // TRANSF_INCREMENTAL_MP
   }
 
 #ifdef TRANSF_INCREMENTAL_MP
-  myNode->incrTrialDisp(*unbalance);
+  myNode->incrTrialDisp(this->unbalanceVector());
 #else
-  myNode->setTrialDisp(*unbalance);
+  myNode->setTrialDisp(this->unbalanceVector());
 #endif // #ifdef TRANSF_INCREMENTAL_MP
 }
 
@@ -576,9 +521,9 @@ TransformationDOF_Group::setNodeVel(const Vector &u)
    for (int i=0; i<modNumDOF; i++) {
      int loc = theID(i);
      if (loc >= 0)
-       (*modUnbalance)(i) = u(loc);
+       this->modUnbalanceVector()(i) = u(loc);
      else   
-       (*modUnbalance)(i) = 0.0;	    
+       this->modUnbalanceVector()(i) = 0.0;	    
    }    
 
   if (needRetainedData == 0) {
@@ -591,21 +536,21 @@ TransformationDOF_Group::setNodeVel(const Vector &u)
     for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
       int loc = theID(i);
       if (loc < 0)
-	(*modUnbalance)(i) = responseR(retainedDOF(j));
+	this->modUnbalanceVector()(i) = responseR(retainedDOF(j));
     }
   }
 
   Matrix *T = this->getT();
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+  this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
 
   const Vector &vel = myNode->getTrialVel();
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = vel(i);
+      this->unbalanceVector()(i) = vel(i);
   }
-  myNode->setTrialVel(*unbalance);
+  myNode->setTrialVel(this->unbalanceVector());
 }
 
 
@@ -622,9 +567,9 @@ TransformationDOF_Group::setNodeAccel(const Vector &u)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = theID(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = u(loc);
+	    this->modUnbalanceVector()(i) = u(loc);
 	else 	// NO SP STUFF .. WHAT TO DO
-	    (*modUnbalance)(i) = 0.0;	    
+	    this->modUnbalanceVector()(i) = 0.0;	    
 
     }    
 
@@ -638,20 +583,20 @@ TransformationDOF_Group::setNodeAccel(const Vector &u)
     for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
       int loc = theID(i);
       if (loc < 0)
-	(*modUnbalance)(i) = responseR(retainedDOF(j));
+	this->modUnbalanceVector()(i) = responseR(retainedDOF(j));
     }
   }
 
     Matrix *T = this->getT();
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+    this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
     const Vector &accel = myNode->getTrialAccel();
     int numDOF = myNode->getNumberDOF();
     for (int i=0; i<numDOF; i++) {
       if (theSPs[i] != 0)
-	(*unbalance)(i) = accel(i);
+	this->unbalanceVector()(i) = accel(i);
     }
-    myNode->setTrialAccel(*unbalance);
+    myNode->setTrialAccel(this->unbalanceVector());
 }
 
 
@@ -673,25 +618,25 @@ TransformationDOF_Group::incrNodeDisp(const Vector &u)
    for (int i=0; i<modNumDOF; i++) {
      int loc = theID(i);
      if (loc >= 0)
-       (*modUnbalance)(i) = u(loc);
+       this->modUnbalanceVector()(i) = u(loc);
      else  
-       (*modUnbalance)(i) = 0.0;	    
+       this->modUnbalanceVector()(i) = 0.0;	    
    }    
    
 #ifdef TRANSF_INCREMENTAL_MP
-   modTotalDisp.addVector(1.0, *modUnbalance, 1.0); // accumulate it for next iteration
+   modTotalDisp.addVector(1.0, this->modUnbalanceVector(), 1.0); // accumulate it for next iteration
 #endif // TRANSF_INCREMENTAL_MP
 
    Matrix *T = this->getT();
-   // *unbalance = (*T) * (*modUnbalance);
-   unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+   // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+   this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
    
    int numDOF = myNode->getNumberDOF();
    for (int i=0; i<numDOF; i++) {
      if (theSPs[i] != 0)
-       (*unbalance)(i) = 0.0;
+       this->unbalanceVector()(i) = 0.0;
    }
-   myNode->incrTrialDisp(*unbalance);
+   myNode->incrTrialDisp(this->unbalanceVector());
 }
 
 
@@ -708,21 +653,21 @@ TransformationDOF_Group::incrNodeVel(const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     else   
-      (*modUnbalance)(i) = 0.0;	    
+      this->modUnbalanceVector()(i) = 0.0;	    
   }    
   Matrix *T = this->getT();
   
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+  this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
   
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = 0.0;
+      this->unbalanceVector()(i) = 0.0;
   }
-  myNode->incrTrialVel(*unbalance);
+  myNode->incrTrialVel(this->unbalanceVector());
 }
 
 
@@ -739,20 +684,20 @@ TransformationDOF_Group::incrNodeAccel(const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     else 	
-      (*modUnbalance)(i) = 0.0;	    
+      this->modUnbalanceVector()(i) = 0.0;	    
   }    
   Matrix *T = this->getT();
 
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+  this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = 0.0;
+      this->unbalanceVector()(i) = 0.0;
   }
-  myNode->incrTrialAccel(*unbalance);
+  myNode->incrTrialAccel(this->unbalanceVector());
 }
 
 const Vector & 
@@ -775,17 +720,17 @@ TransformationDOF_Group::getTrialDisp(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		this->modUnbalanceVector()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    this->modUnbalanceVector()(loc) = responseR(dof);
 	    loc++;
 	}
 
-	return *modUnbalance;
+	return this->modUnbalanceVector();
     }
 }
 
@@ -809,17 +754,17 @@ TransformationDOF_Group::getTrialVel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		this->modUnbalanceVector()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    this->modUnbalanceVector()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return this->modUnbalanceVector();
     }
 }
 
@@ -844,17 +789,17 @@ TransformationDOF_Group::getTrialAccel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		this->modUnbalanceVector()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    this->modUnbalanceVector()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return this->modUnbalanceVector();
     }
 }
 
@@ -872,18 +817,18 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     else 	
-      (*modUnbalance)(i) = 0.0;	    
+      this->modUnbalanceVector()(i) = 0.0;	    
   }    
   Matrix *T = this->getT();
 
     if (T != 0) {
-      // *unbalance = (*T) * (*modUnbalance);
-      unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
-      myNode->setEigenvector(mode, *unbalance);
+      // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+      this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
+      myNode->setEigenvector(mode, this->unbalanceVector());
     } else
-      myNode->setEigenvector(mode, *modUnbalance);
+      myNode->setEigenvector(mode, this->modUnbalanceVector());
 }
 
 
@@ -966,27 +911,9 @@ TransformationDOF_Group::doneID(void)
     }
   }
   
-  // set the pointers for the tangent and residual
-  if (modNumDOF <= MAX_NUM_DOF) {
-    // use class wide objects
-    if (modVectors[modNumDOF] == 0) {
-      // have to create matrix and vector of size as none yet created
-      modVectors[modNumDOF] = new Vector(modNumDOF);
-      modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-      modUnbalance = modVectors[modNumDOF];
-      modTangent = modMatrices[modNumDOF];
-      if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-	  modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-	opserr << "DOF_Group::DOF_Group(Node *) ";
-	opserr << " ran out of memory for vector/Matrix of size :";
-	opserr << modNumDOF << endln;
-	exit(-1);
-      }
-    } else {
-      modUnbalance = modVectors[modNumDOF];
-      modTangent = modMatrices[modNumDOF];
-    }
-  } else {
+  // set the pointers for the tangent and residual if not yet created;
+  // up to MAX_NUM_DOF the thread's FE_Workspace objects are used
+  if (modNumDOF > MAX_NUM_DOF && modUnbalance == 0) {
     // create matrices and vectors for each object instance
     modUnbalance = new Vector(modNumDOF);
     modTangent = new Matrix(modNumDOF, modNumDOF);
@@ -1066,23 +993,23 @@ TransformationDOF_Group::enforceSPs(int doMP)
 	const Vector &responseR = retainedNodePtr->getTrialDisp();
 	const ID &retainedDOF = theMP->getRetainedDOFs();
 	
-	modUnbalance->Zero();    
+	this->modUnbalanceVector().Zero();    
 	for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
 	  int loc = theID(i);
 	  if (loc < 0)
-	    (*modUnbalance)(i) = responseR(retainedDOF(j));
+	    this->modUnbalanceVector()(i) = responseR(retainedDOF(j));
 	}
 	
 	Matrix *T = this->getT();
 	if (T != 0) {
 	  
-	  // *unbalance = (*T) * (*modUnbalance);
-	  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+	  // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+	  this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
 	  
 	  const ID &constrainedDOF = theMP->getConstrainedDOFs();
 	  for (int i=0; i<constrainedDOF.Size(); i++) {
 	    int cDOF = constrainedDOF(i);
-	    myNode->setTrialDisp((*unbalance)(cDOF), cDOF);
+	    myNode->setTrialDisp(this->unbalanceVector()(cDOF), cDOF);
 	  }
 	}
       }
@@ -1104,14 +1031,14 @@ TransformationDOF_Group::addM_Force(const Vector &Udotdot, double fact)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udotdot(loc);
+	    this->modUnbalanceVector()(i) = Udotdot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    this->modUnbalanceVector()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
-    //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    //unmod = (*Trans) * this->modUnbalanceVector();
+    unmod.addMatrixVector(0.0, *Trans, this->modUnbalanceVector(), 1.0);
     this->addLocalM_Force(unmod, fact);
 }
 
@@ -1140,14 +1067,14 @@ TransformationDOF_Group::getM_Force(const Vector &Udotdot, double fact)
 
   Matrix *T = this->getT();
   if (T != 0) {
-    // *modTangent = (*T) ^ unmodTangent * (*T);
-    modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
-    modUnbalance->addMatrixVector(0.0, *modTangent, data, 1.0);
+    // this->modTangentMatrix() = (*T) ^ unmodTangent * (*T);
+    this->modTangentMatrix().addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
+    this->modUnbalanceVector().addMatrixVector(0.0, this->modTangentMatrix(), data, 1.0);
     
-    return *modUnbalance;
+    return this->modUnbalanceVector();
   } else {
-      modUnbalance->addMatrixVector(0.0, unmodTangent, data, 1.0);
-      return *modUnbalance;
+      this->modUnbalanceVector().addMatrixVector(0.0, unmodTangent, data, 1.0);
+      return this->modUnbalanceVector();
   }
 }
 
@@ -1155,14 +1082,14 @@ const Vector &
 TransformationDOF_Group::getC_Force(const Vector &Udotdot, double fact)
 {
   opserr << "TransformationDOF_Group::getC_Force() - not yet implemented\n";
-  return *modUnbalance;
+  return this->modUnbalanceVector();
 }
 
 const Vector &
 TransformationDOF_Group::getTangForce(const Vector &Udotdot, double fact)
 {
   opserr << "TransformationDOF_Group::getTangForce() - not yet implemented\n";
-  return *modUnbalance;
+  return this->modUnbalanceVector();
 }
 
 
@@ -1175,9 +1102,9 @@ TransformationDOF_Group::getDispSensitivity(int gradNumber)
 
   Matrix *T = this->getT();
   if (T != 0) {
-    // *modUnbalance = (*T) ^ unmodUnbalance;
-    modUnbalance->addMatrixTransposeVector(0.0, *T, result, 1.0);
-    return *modUnbalance;    
+    // this->modUnbalanceVector() = (*T) ^ unmodUnbalance;
+    this->modUnbalanceVector().addMatrixTransposeVector(0.0, *T, result, 1.0);
+    return this->modUnbalanceVector();    
   } else
     return result;
 
@@ -1190,9 +1117,9 @@ TransformationDOF_Group::getVelSensitivity(int gradNumber)
 
   Matrix *T = this->getT();
   if (T != 0) {
-    // *modUnbalance = (*T) ^ unmodUnbalance;
-    modUnbalance->addMatrixTransposeVector(0.0, *T, result, 1.0);
-    return *modUnbalance;    
+    // this->modUnbalanceVector() = (*T) ^ unmodUnbalance;
+    this->modUnbalanceVector().addMatrixTransposeVector(0.0, *T, result, 1.0);
+    return this->modUnbalanceVector();    
   } else
     return result;
 }
@@ -1204,9 +1131,9 @@ TransformationDOF_Group::getAccSensitivity(int gradNumber)
 
   Matrix *T = this->getT();
   if (T != 0) {
-    // *modUnbalance = (*T) ^ unmodUnbalance;
-    modUnbalance->addMatrixTransposeVector(0.0, *T, result, 1.0);
-    return *modUnbalance;    
+    // this->modUnbalanceVector() = (*T) ^ unmodUnbalance;
+    this->modUnbalanceVector().addMatrixTransposeVector(0.0, *T, result, 1.0);
+    return this->modUnbalanceVector();    
   } else
     return result;
 }
@@ -1225,20 +1152,20 @@ TransformationDOF_Group::saveDispSensitivity(const Vector &u,
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     // DO THE SP STUFF
   }    
   Matrix *T = this->getT();
   if (T != 0) {
     
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+    this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    this->unbalanceVector() = this->modUnbalanceVector();
 
 
-  myNode->saveDispSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveDispSensitivity(this->unbalanceVector(), gradNum, numGrads);
   
   return 0;
 }
@@ -1256,20 +1183,20 @@ TransformationDOF_Group::saveVelSensitivity(const Vector &u,
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     // DO THE SP STUFF
   }    
   Matrix *T = this->getT();
   if (T != 0) {
     
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+    this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    this->unbalanceVector() = this->modUnbalanceVector();
 
 
-  myNode->saveVelSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveVelSensitivity(this->unbalanceVector(), gradNum, numGrads);
   
   return 0;
 }
@@ -1287,20 +1214,20 @@ TransformationDOF_Group::saveAccSensitivity(const Vector &u,
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      this->modUnbalanceVector()(i) = u(loc);
     // DO THE SP STUFF
   }    
   Matrix *T = this->getT();
   if (T != 0) {
     
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->unbalanceVector() = (*T) * this->modUnbalanceVector();
+    this->unbalanceVector().addMatrixVector(0.0, *T, this->modUnbalanceVector(), 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    this->unbalanceVector() = this->modUnbalanceVector();
 
 
-  myNode->saveAccelSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveAccelSensitivity(this->unbalanceVector(), gradNum, numGrads);
   
   return 0;
 }
@@ -1337,14 +1264,14 @@ TransformationDOF_Group::addM_ForceSensitivity(const Vector &Udotdot, double fac
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udotdot(loc);
+	    this->modUnbalanceVector()(i) = Udotdot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    this->modUnbalanceVector()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
-    //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    //unmod = (*Trans) * this->modUnbalanceVector();
+    unmod.addMatrixVector(0.0, *Trans, this->modUnbalanceVector(), 1.0);
     this->DOF_Group::addM_ForceSensitivity(unmod, fact);
 }
 
@@ -1360,14 +1287,14 @@ TransformationDOF_Group::addD_Force(const Vector &Udot, double fact)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udot(loc);
+	    this->modUnbalanceVector()(i) = Udot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    this->modUnbalanceVector()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
-    //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    //unmod = (*Trans) * this->modUnbalanceVector();
+    unmod.addMatrixVector(0.0, *Trans, this->modUnbalanceVector(), 1.0);
     this->DOF_Group::addD_Force(unmod, fact);
 }
 
@@ -1383,14 +1310,14 @@ TransformationDOF_Group::addD_ForceSensitivity(const Vector &Udot, double fact)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udot(loc);
+	    this->modUnbalanceVector()(i) = Udot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    this->modUnbalanceVector()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
-    //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    //unmod = (*Trans) * this->modUnbalanceVector();
+    unmod.addMatrixVector(0.0, *Trans, this->modUnbalanceVector(), 1.0);
     this->DOF_Group::addD_ForceSensitivity(unmod, fact);
 }
 
@@ -122,11 +122,15 @@ class TransformationDOF_Group: public DOF_Group
   protected:
     
   private:
+    // the objects used to form the modified tangent and unbalance
+    Matrix &modTangentMatrix(void);
+    Vector &modUnbalanceVector(void);
+
     // private variables - a copy for each object of the class            
     MP_Constraint *theMP;
     Matrix *Trans;
-    Matrix *modTangent;
-    Vector *modUnbalance;
+    Matrix *modTangent;   // 0 if the FE_Workspace matrix is used
+    Vector *modUnbalance; // 0 if the FE_Workspace vector is used
     ID *modID;
     int modNumDOF;
     int numConstrainedNodeRetainedDOF; 
@@ -134,9 +138,6 @@ class TransformationDOF_Group: public DOF_Group
     SP_Constraint **theSPs;
     
     // static variables - single copy for all objects of the class	    
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static int numTransDOFs;           // number of objects        
     static TransformationConstraintHandler *theHandler;
 
 #ifdef TRANSF_INCREMENTAL_MP
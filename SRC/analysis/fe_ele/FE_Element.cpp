@@ -42,15 +42,13 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <FE_Workspace.h>
 
 #define MAX_NUM_DOF 64
 
 // static variables initialisation
 Matrix FE_Element::errMatrix(1,1);
 Vector FE_Element::errVector(1);
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
@@ -96,52 +94,18 @@ FE_Element::FE_Element(int tag, Element *ele)
 	}
     }
 
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-
     if (ele->isSubdomain() == false) {
 	
 	// if Elements are not subdomains, set up pointers to
 	// objects to return tangent Matrix and residual Vector.
+	// up to MAX_NUM_DOF the thread's FE_Workspace objects are used
 
-	if (numDOF <= MAX_NUM_DOF) {
-	    // use class wide objects
-	    if (theVectors[numDOF] == 0) {
-		theVectors[numDOF] = new Vector(numDOF);
-		theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-		if (theResidual == 0 || theResidual->Size() != numDOF ||	
-		    theTangent == 0 || theTangent->noCols() != numDOF)	{  
-		    opserr << "FE_Element::FE_Element(Element *) ";
-		    opserr << " ran out of memory for vector/Matrix of size :";
-		    opserr << numDOF << endln;
-		    exit(-1);
-		}
-	    } else {
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-	    }
-	} else {
+	if (numDOF > MAX_NUM_DOF) {
 	    // create matrices and vectors for each object instance
 	    theResidual = new Vector(numDOF);
 	    theTangent = new Matrix(numDOF, numDOF);
 	    if (theResidual == 0 || theTangent ==0 ||
-		theTangent ==0 || theTangent->noRows() ==0) {
+		theTangent->noRows() ==0) {
 	    
 		opserr << "FE_Element::FE_Element(Element *) ";
 		opserr << " ran out of memory for vector/Matrix of size :";
@@ -158,9 +122,6 @@ FE_Element::FE_Element(int tag, Element *ele)
 	Subdomain *theSub = (Subdomain *)ele;
 	theSub->setFE_ElementPtr(this);
     }
- 
-    // increment number of FE_Elements by 1
-    numFEs++;
 }
 
 
@@ -170,25 +131,7 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
    myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
-    numFEs++;
-
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-    
+
     // as subtypes have no access to the tangent or residual we don't set them
     // this way we can detect if subclass does not provide all methods it should
 }
@@ -199,28 +142,9 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
 //	destructor.
 FE_Element::~FE_Element()
 {
-
-    // decrement number of FE_Elements
-    numFEs--;
-
     // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
-	if (theTangent != 0) delete theTangent;
-	if (theResidual != 0) delete theResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numFEs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
-    }
+    if (theTangent != 0) delete theTangent;
+    if (theResidual != 0) delete theResidual;
 }    
 
 
@@ -300,7 +224,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
       if (theNewIntegrator != 0)
 	theNewIntegrator->formEleTangent(this);	    	    
 
-      return *theTangent;
+      return this->tangent();
     } else {
       Subdomain *theSub = (Subdomain *)myEle;
       theSub->computeTang();	    
@@ -314,7 +238,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     theIntegrator = theNewIntegrator;
 
     if (theIntegrator == 0)
-      return *theResidual;
+      return this->residual();
 
     if (myEle == 0) {
 	opserr << "FATAL FE_Element::getTangent() - no Element *given ";
@@ -325,7 +249,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
 
     if (myEle->isSubdomain() == false) {
       theNewIntegrator->formEleResidual(this);
-      return *theResidual;
+      return this->residual();
     } else {
       Subdomain *theSub = (Subdomain *)myEle;
       theSub->computeResidual();	    
@@ -340,7 +264,7 @@ FE_Element::zeroTangent(void)
 {
     if (myEle != 0) {
 	if (myEle->isSubdomain() == false)
-	    theTangent->Zero();
+	    this->tangent().Zero();
 	else {
 	    opserr << "WARNING FE_Element::zeroTangent() - ";
 	    opserr << "- this should not be called on a Subdomain!\n";
@@ -359,7 +283,7 @@ FE_Element::addKtToTang(double fact)
 	else if (myEle->isSubdomain() == false)	    
 	{
 	    const Matrix& Kt = myEle->getTangentStiff();
-	    theTangent->addMatrix(1.0, Kt,fact);
+	    this->tangent().addMatrix(1.0, Kt,fact);
 	}
 	else {
 	    opserr << "WARNING FE_Element::addKToTang() - ";
@@ -377,7 +301,7 @@ FE_Element::addCtoTang(double fact)
 	if (fact == 0.0) 
 	  return;
 	else if (myEle->isSubdomain() == false)	    	    
-	  theTangent->addMatrix(1.0, myEle->getDamp(),fact);
+	  this->tangent().addMatrix(1.0, myEle->getDamp(),fact);
 	else {
 	  opserr << "WARNING FE_Element::addCToTang() - ";
 	  opserr << "- this should not be called on a Subdomain!\n";
@@ -394,7 +318,7 @@ FE_Element::addMtoTang(double fact)
 	if (fact == 0.0) 
 	  return;
 	else if (myEle->isSubdomain() == false)	    	    
-	  theTangent->addMatrix(1.0, myEle->getMass(),fact);
+	  this->tangent().addMatrix(1.0, myEle->getMass(),fact);
 	else {
 	  opserr << "WARNING FE_Element::addMToTang() - ";
 	  opserr << "- this should not be called on a Subdomain!\n";
@@ -411,7 +335,7 @@ FE_Element::addKiToTang(double fact)
     if (fact == 0.0) 
       return;
     else if (myEle->isSubdomain() == false)	    	    
-      theTangent->addMatrix(1.0, myEle->getInitialStiff(), fact);
+      this->tangent().addMatrix(1.0, myEle->getInitialStiff(), fact);
     else {
 	opserr << "WARNING FE_Element::addKiToTang() - ";
 	opserr << "- this should not be called on a Subdomain!\n";
@@ -427,7 +351,7 @@ FE_Element::addKgToTang(double fact)
     if (fact == 0.0) 
       return;
     else if (myEle->isSubdomain() == false)	    	    
-      theTangent->addMatrix(1.0, myEle->getGeometricTangentStiff(), fact);
+      this->tangent().addMatrix(1.0, myEle->getGeometricTangentStiff(), fact);
     else {
 	opserr << "WARNING FE_Element::addKgToTang() - ";
 	opserr << "- this should not be called on a Subdomain!\n";
@@ -445,7 +369,7 @@ FE_Element::addKpToTang(double fact, int numP)
     else if (myEle->isSubdomain() == false) {
       const Matrix *thePrevMat = myEle->getPreviousK(numP);
       if (thePrevMat != 0)
-	theTangent->addMatrix(1.0, *thePrevMat, fact);
+	this->tangent().addMatrix(1.0, *thePrevMat, fact);
     } else {
       opserr << "WARNING FE_Element::addKpToTang() - ";
       opserr << "- this should not be called on a Subdomain!\n";
@@ -470,7 +394,7 @@ FE_Element::zeroResidual(void)
 {
     if (myEle != 0) {
 	if (myEle->isSubdomain() == false)
-	    theResidual->Zero();
+	    this->residual().Zero();
 	else {
 	    opserr << "WARNING FE_Element::zeroResidual() - ";
 	    opserr << "- this should not be called on a Subdomain!\n";
@@ -491,7 +415,7 @@ FE_Element::addRtoResidual(double fact)
       return;
     else if (myEle->isSubdomain() == false) {
       const Vector &eleResisting = myEle->getResistingForce();
-      theResidual->addVector(1.0, eleResisting, -fact);
+      this->residual().addVector(1.0, eleResisting, -fact);
     }
     else {
       opserr << "WARNING FE_Element::addRtoResidual() - ";
@@ -514,7 +438,7 @@ FE_Element::addRIncInertiaToResidual(double fact)
 	    return;
 	else if (myEle->isSubdomain() == false) {
 	  const Vector &eleResisting = myEle->getResistingForceIncInertia();
-	  theResidual->addVector(1.0, eleResisting, -fact);
+	  this->residual().addVector(1.0, eleResisting, -fact);
 	}
 	else {
 	    opserr << "WARNING FE_Element::addRtoResidual() - ";
@@ -534,15 +458,15 @@ FE_Element::getTangForce(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->residual().Zero();
 
 	// check for a quick return
 	if (fact == 0.0 || !myEle->isActive()) 
-	    return *theResidual;
+	    return this->residual();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
-	Vector tmp(numDOF);
+	Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	for (int i=0; i<numDOF; i++) {
 	  int dof = myID(i);
 	  if (dof >= 0)
@@ -554,19 +478,19 @@ FE_Element::getTangForce(const Vector &disp, double fact)
 	if (myEle->isSubdomain() == false) {
 	    // form the tangent again and then add the force
 	    theIntegrator->formEleTangent(this);
-	    if (theResidual->addMatrixVector(1.0, *theTangent,tmp,fact) < 0) {
+	    if (this->residual().addMatrixVector(1.0, this->tangent(),tmp,fact) < 0) {
 		opserr << "WARNING FE_Element::getTangForce() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }				
 	}
 	else {
 	    Subdomain *theSub = (Subdomain *)myEle;
-	    if (theResidual->addMatrixVector(1.0, theSub->getTang(),tmp,fact) < 0) {
+	    if (this->residual().addMatrixVector(1.0, theSub->getTang(),tmp,fact) < 0) {
 		opserr << "WARNING FE_Element::getTangForce() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }						
 	}
-	return *theResidual;
+	return this->residual();
     }
     else {
 	opserr << "WARNING FE_Element::addTangForce() - no Element *given ";
@@ -583,15 +507,15 @@ FE_Element::getK_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->residual().Zero();
 
 	// check for a quick return
 	if (fact == 0.0 || !myEle->isActive()) 
-	    return *theResidual;
+	    return this->residual();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
-	Vector tmp(numDOF);
+	Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	for (int i=0; i<numDOF; i++) {
 	  int dof = myID(i);
 	  if (dof >= 0)
@@ -600,12 +524,12 @@ FE_Element::getK_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
+	if (this->residual().addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getKForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
-	return *theResidual;
+	return this->residual();
     }
     else {
 	opserr << "WARNING FE_Element::getKForce() - no Element *given ";
@@ -621,15 +545,15 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->residual().Zero();
 
 	// check for a quick return
 	if (fact == 0.0 || !myEle->isActive()) 
-	    return *theResidual;
+	    return this->residual();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
-	Vector tmp(numDOF);
+	Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	for (int i=0; i<numDOF; i++) {
 	  int dof = myID(i);
 	  if (dof >= 0)
@@ -638,12 +562,12 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact) < 0){
+	if (this->residual().addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getKForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
-	return *theResidual;
+	return this->residual();
     }
     else {
 	opserr << "WARNING FE_Element::getKForce() - no Element *given ";
@@ -659,15 +583,15 @@ FE_Element::getM_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->residual().Zero();
 
 	// check for a quick return
 	if (fact == 0.0 || !myEle->isActive()) 
-	    return *theResidual;
+	    return this->residual();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
-	Vector tmp(numDOF);
+	Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	for (int i=0; i<numDOF; i++) {
 	  int dof = myID(i);
 	  if (dof >= 0)
@@ -676,13 +600,13 @@ FE_Element::getM_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
+	if (this->residual().addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getMForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
 
-	return *theResidual;
+	return this->residual();
     }
     else {
 	opserr << "WARNING FE_Element::getMForce() - no Element *given ";
@@ -697,15 +621,15 @@ FE_Element::getC_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->residual().Zero();
 
 	// check for a quick return
 	if (fact == 0.0 || !myEle->isActive()) 
-	    return *theResidual;
+	    return this->residual();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
-	Vector tmp(numDOF);
+	Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	for (int i=0; i<numDOF; i++) {
 	  int dof = myID(i);
 	  if (dof >= 0)
@@ -714,12 +638,12 @@ FE_Element::getC_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
+	if (this->residual().addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getDForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
-	return *theResidual;
+	return this->residual();
     }
     else {
 	opserr << "WARNING FE_Element::getDForce() - no Element *given ";
@@ -741,18 +665,18 @@ FE_Element::getLastResponse(void)
 {
     if (myEle != 0) {
       if (theIntegrator != 0) {
-	if (theIntegrator->getLastResponse(*theResidual,myID) < 0) {
+	if (theIntegrator->getLastResponse(this->residual(),myID) < 0) {
 	  opserr << "WARNING FE_Element::getLastResponse(void)";
 	  opserr << " - the Integrator had problems with getLastResponse()\n";
 	}
       }
       else {
-	theResidual->Zero();
+	this->residual().Zero();
 	opserr << "WARNING  FE_Element::getLastResponse()";
 	opserr << " No Integrator yet passed\n";
       }
     
-      Vector &result = *theResidual;
+      Vector &result = this->residual();
       return result;
     }
     else {
@@ -773,7 +697,7 @@ FE_Element::addM_Force(const Vector &accel, double fact)
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
 	    // and place in a temporary vector
-	    Vector tmp(numDOF);
+	    Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	    for (int i=0; i<numDOF; i++) {
 		int loc = myID(i);
 		if (loc >= 0)
@@ -782,7 +706,7 @@ FE_Element::addM_Force(const Vector &accel, double fact)
 		    tmp(i) = 0.0;		
 	    }	 
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
+	    if (this->residual().addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addM_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -809,7 +733,7 @@ FE_Element::addD_Force(const Vector &accel, double fact)
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
 	    // and place in a temporary vector
-	    Vector tmp(numDOF);
+	    Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	    for (int i=0; i<numDOF; i++) {
 		int loc = myID(i);
 		if (loc >= 0)
@@ -818,7 +742,7 @@ FE_Element::addD_Force(const Vector &accel, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
+	    if (this->residual().addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addD_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -845,7 +769,7 @@ FE_Element::addK_Force(const Vector &disp, double fact)
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
 	    // and place in a temporary vector
-	    Vector tmp(numDOF);
+	    Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	    for (int i=0; i<numDOF; i++) {
 		int loc = myID(i);
 		if (loc >= 0)
@@ -854,7 +778,7 @@ FE_Element::addK_Force(const Vector &disp, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
+	    if (this->residual().addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addK_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -881,7 +805,7 @@ FE_Element::addKg_Force(const Vector &disp, double fact)
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
 	    // and place in a temporary vector
-	    Vector tmp(numDOF);
+	    Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
 	    for (int i=0; i<numDOF; i++) {
 		int loc = myID(i);
 		if (loc >= 0)
@@ -890,7 +814,7 @@ FE_Element::addKg_Force(const Vector &disp, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact) < 0){
+	    if (this->residual().addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addKg_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -916,7 +840,7 @@ FE_Element::addLocalM_Force(const Vector &accel, double fact)
 	if (fact == 0.0 || !myEle->isActive()) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getMass(),
+	    if (this->residual().addMatrixVector(1.0, myEle->getMass(),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalM_Force() - ";
@@ -943,7 +867,7 @@ FE_Element::addLocalD_Force(const Vector &accel, double fact)
 	if (fact == 0.0 || !myEle->isActive()) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getDamp(),
+	    if (this->residual().addMatrixVector(1.0, myEle->getDamp(),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_Force() - ";
@@ -962,18 +886,47 @@ FE_Element::addLocalD_Force(const Vector &accel, double fact)
 }
 
 
+Matrix &
+FE_Element::tangent(void)
+{
+  if (theTangent != 0)
+    return *theTangent;
+
+  return FE_Workspace::getWorkspace().getMatrix(FE_Workspace::FE_Tangent, numDOF);
+}
+
+Vector &
+FE_Element::residual(void)
+{
+  if (theResidual != 0)
+    return *theResidual;
+
+  return FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Residual, numDOF);
+}
+
 Element *
 FE_Element::getElement(void)
 {
   return myEle;
 }
 
+bool
+FE_Element::isThreadSafe(void)
+{
+  // the tangent and residual are formed in the thread's FE_Workspace
+  // or in storage of this object, so it is up to the Element
+  if (myEle == 0 || myEle->isSubdomain() == true)
+    return false;
+
+  return myEle->isThreadSafe();
+}
+
 
 // AddingSensitivity:BEGIN /////////////////////////////////
 void  
 FE_Element::addResistingForceSensitivity(int gradNumber, double fact)
 {
-  theResidual->addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
+  this->residual().addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
 }
 
 void  
@@ -981,7 +934,7 @@ FE_Element::addM_ForceSensitivity(int gradNumber, const Vector &vect, double fac
 {
   // Get the components we need out of the vector
   // and place in a temporary vector
-  Vector tmp(numDOF);
+  Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
   for (int i=0; i<numDOF; i++) {
     int loc = myID(i);
     if (loc >= 0) {
@@ -991,7 +944,7 @@ FE_Element::addM_ForceSensitivity(int gradNumber, const Vector &vect, double fac
       tmp(i) = 0.0;
     }
   }
-  if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
+  if (this->residual().addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
     opserr << "WARNING FE_Element::addM_ForceSensitivity() - ";
     opserr << "- addMatrixVector returned error\n";		 
   }
@@ -1008,7 +961,7 @@ FE_Element::addD_ForceSensitivity(int gradNumber, const Vector &vect, double fac
     if (myEle->isSubdomain() == false) {
       // get the components we need out of the vector
       // and place in a temporary vector
-      Vector tmp(numDOF);
+      Vector &tmp = FE_Workspace::getWorkspace().getVector(FE_Workspace::FE_Temp, numDOF);
       for (int i=0; i<numDOF; i++) {
 	int loc = myID(i);
 	if (loc >= 0)
@@ -1016,7 +969,7 @@ FE_Element::addD_ForceSensitivity(int gradNumber, const Vector &vect, double fac
 	else
 	  tmp(i) = 0.0;		
       }	
-      if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
+      if (this->residual().addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
 	opserr << "WARNING FE_Element::addD_ForceSensitivity() - ";
 	opserr << "- addMatrixVector returned error\n";		 
       }		
@@ -1041,7 +994,7 @@ FE_Element::addLocalD_ForceSensitivity(int gradNumber, const Vector &accel, doub
 	if (fact == 0.0) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
+	    if (this->residual().addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
@@ -1068,7 +1021,7 @@ FE_Element::addLocalM_ForceSensitivity(int gradNumber, const Vector &accel, doub
 	if (fact == 0.0) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),
+	    if (this->residual().addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
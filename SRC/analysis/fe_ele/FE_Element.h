@@ -92,6 +92,7 @@ class FE_Element: public TaggedObject
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
+    virtual bool isThreadSafe(void);
 
     virtual void  Print(OPS_Stream&, int = 0) {return;};
 
@@ -118,20 +119,21 @@ class FE_Element: public TaggedObject
     ID myID;
 
   private:
+    // the objects used to form the tangent and residual
+    Matrix &tangent(void);
+    Vector &residual(void);
+
     // private variables - a copy for each object of the class    
     int numDOF;
     AnalysisModel *theModel;
     Element *myEle;
-    Vector *theResidual;
-    Matrix *theTangent;
+    Vector *theResidual;       // 0 if the FE_Workspace vector is used
+    Matrix *theTangent;        // 0 if the FE_Workspace matrix is used
     Integrator *theIntegrator; // need for Subdomain
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
     
 
 };
@@ -42,6 +42,7 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <FE_Workspace.h>
 #include <Node.h>
 #include <MP_Constraint.h>
 #include <DOF_Group.h>
@@ -237,12 +238,11 @@ const Vector &
 LagrangeMP_FE::getResidual(Integrator *theNewIntegrator)
 {
     // get the solution vector [Uc Ur lambda]
-    static Vector UU;
     const ID& id1 = theMP->getConstrainedDOFs();
     const ID& id2 = theMP->getRetainedDOFs();
     const ID& id3 = theDofGroup->getID();
     int size = id1.Size() + id2.Size() + id3.Size();
-    UU.resize(size);
+    Vector &UU = FE_Workspace::getWorkspace().getVector(FE_Workspace::MP_Response, size);
     const Vector& Uc = theConstrainedNode->getTrialDisp();
     const Vector& Ur = theRetainedNode->getTrialDisp();
     const Vector& Uc0 = theMP->getConstrainedDOFsInitialDisplacement();
@@ -44,6 +44,7 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <FE_Workspace.h>
 #include <Node.h>
 #include <MP_Constraint.h>
 #include <DOF_Group.h>
@@ -212,11 +213,10 @@ PenaltyMP_FE::getResidual(Integrator *theNewIntegrator)
     // zero residual, CD = 0
 
     // get the solution vector [Uc Ur]
-    static Vector UU;
     const ID& id1 = theMP->getConstrainedDOFs();
     const ID& id2 = theMP->getRetainedDOFs();
     int size = id1.Size() + id2.Size();
-    UU.resize(size);
+    Vector &UU = FE_Workspace::getWorkspace().getVector(FE_Workspace::MP_Response, size);
     const Vector& Uc = theConstrainedNode->getTrialDisp();
     const Vector& Ur = theRetainedNode->getTrialDisp();
     const Vector& Uc0 = theMP->getConstrainedDOFsInitialDisplacement();
@@ -49,9 +49,7 @@
 #include <Node.h>
 #include <SP_Constraint.h>
 #include <DOF_Group.h>
-
-Matrix PenaltySP_FE::tang(1,1);
-Vector PenaltySP_FE::resid(1);
+#include <FE_Workspace.h>
 
 PenaltySP_FE::PenaltySP_FE(int tag, Domain &theDomain, 
 			   SP_Constraint &TheSP, double Alpha)
@@ -113,6 +111,7 @@ PenaltySP_FE::setID(void)
 const Matrix &
 PenaltySP_FE::getTangent(Integrator *theNewIntegrator)
 {
+  Matrix &tang = FE_Workspace::getWorkspace().getMatrix(FE_Workspace::PenaltySP_Tangent, 1);
   tang(0,0) = alpha;
   return tang;
 }
@@ -121,6 +120,7 @@ PenaltySP_FE::getTangent(Integrator *theNewIntegrator)
 const Vector &
 PenaltySP_FE::getResidual(Integrator *theNewIntegrator)
 {
+    Vector &resid = FE_Workspace::getWorkspace().getVector(FE_Workspace::PenaltySP_Residual, 1);
     double constraint = theSP->getValue();
     double initialValue = theSP->getInitialValue();
     int constrainedDOF = theSP->getDOF_Number();
@@ -145,6 +145,7 @@ PenaltySP_FE::getResidual(Integrator *theNewIntegrator)
 const Vector &
 PenaltySP_FE::getTangForce(const Vector &disp, double fact)
 {
+    Vector &resid = FE_Workspace::getWorkspace().getVector(FE_Workspace::PenaltySP_Residual, 1);
     double constraint = theSP->getValue();
     int constrainedID = myID(0);
     if (constrainedID < 0 || constrainedID >= disp.Size()) {
@@ -161,6 +162,7 @@ PenaltySP_FE::getTangForce(const Vector &disp, double fact)
 const Vector &
 PenaltySP_FE::getK_Force(const Vector &disp, double fact)
 {
+  Vector &resid = FE_Workspace::getWorkspace().getVector(FE_Workspace::PenaltySP_Residual, 1);
   opserr << "WARNING PenaltySP_FE::getK_Force() - not yet implemented\n";
   resid(0) = 0.0;
   return resid;
@@ -169,6 +171,7 @@ PenaltySP_FE::getK_Force(const Vector &disp, double fact)
 const Vector &
 PenaltySP_FE::getKi_Force(const Vector &disp, double fact)
 {
+  Vector &resid = FE_Workspace::getWorkspace().getVector(FE_Workspace::PenaltySP_Residual, 1);
   opserr << "WARNING PenaltySP_FE::getKi_Force() - not yet implemented\n";
   resid(0) = 0.0;
   return resid;
@@ -178,6 +181,7 @@ PenaltySP_FE::getKi_Force(const Vector &disp, double fact)
 const Vector &
 PenaltySP_FE::getC_Force(const Vector &disp, double fact)
 {
+  Vector &resid = FE_Workspace::getWorkspace().getVector(FE_Workspace::PenaltySP_Residual, 1);
   // opserr << "WARNING PenaltySP_FE::getC_Force() - not yet implemented\n";
   resid(0) = 0.0;
   return resid;
@@ -186,6 +190,7 @@ PenaltySP_FE::getC_Force(const Vector &disp, double fact)
 const Vector &
 PenaltySP_FE::getM_Force(const Vector &disp, double fact)
 {
+  Vector &resid = FE_Workspace::getWorkspace().getVector(FE_Workspace::PenaltySP_Residual, 1);
   // opserr << "WARNING PenaltySP_FE::getM_Force() - not yet implemented\n";
   resid(0) = 0.0;
   return resid;
@@ -41,21 +41,10 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <TransformationConstraintHandler.h>
+#include <FE_Workspace.h>
 
 #define MAX_NUM_DOF 64
 
-// static variables initialisation
-Matrix **TransformationFE::modMatrices; 
-Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
-int TransformationFE::numTransFE(0);           
-int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
-double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
-int TransformationFE::sizeBuffer(0);            
-
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
 TransformationFE::TransformationFE(int tag, Element *ele)
@@ -94,47 +83,6 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	}	
 	theDOFs[i] = theDofGroup;
     }
-
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new one
-    if (numNodes > sizeTransformations) {
-	if (theTransformations != 0) 
-	    delete [] theTransformations;
-	
-	theTransformations = new Matrix *[numNodes];
-	if (theTransformations == 0) {
-	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
-	    opserr << "for array of pointers for Transformation matrices of size ";
-	    opserr << numNodes;
-	    exit(-1);
-	}		    
-	sizeTransformations = numNodes;
-    }	
-
-    // if this is the first element of this type create the arrays for 
-    // modified tangent and residual matrices
-    if (numTransFE == 0) {
-
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
-	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
-	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
-	    opserr << "TransformationFE::TransformationFE(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }
-
-    // increment the number of transformations
-    numTransFE++;
 }
 
 
@@ -144,52 +92,16 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 
 TransformationFE::~TransformationFE()
 {
-
-    numTransFE--;
-    
     if (theDOFs != 0)
 	delete [] theDOFs;
     if (theSPs != 0)
 	delete [] theSPs;
-
-    int numDOF = 0;    
-    if (modID != 0)
-	numDOF = modID->Size();
-    
     if (modID != 0)
 	delete modID;
 
-    if (numDOF > MAX_NUM_DOF) {
-	// tangent and residual may have been  created specially
-	if (modTangent != 0) delete modTangent;
-	if (modResidual != 0) delete modResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransFE == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}
-	delete [] modMatrices;
-	delete [] modVectors;
-	delete [] theTransformations;
-	delete [] dataBuffer;
-	delete [] localKbuffer;
-	delete [] dofData;
-	modMatrices = 0;
-	modVectors = 0;
-	theTransformations = 0;
-	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
-	sizeTransformations = 0;
-	sizeBuffer = 0;
-	transCounter = 0;
-    }
+    // tangent and residual may have been  created specially
+    if (modTangent != 0) delete modTangent;
+    if (modResidual != 0) delete modResidual;
 }    
 
 
@@ -252,26 +164,14 @@ TransformationFE::setID(void)
 	    }		
     }
     
-    // set the pointers to the modified tangent matrix and residual vector
-    if (numTransformedDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[numTransformedDOF] == 0) {
-	    modVectors[numTransformedDOF] = new Vector(numTransformedDOF);
-	    modMatrices[numTransformedDOF] = new Matrix(numTransformedDOF,numTransformedDOF);
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	    if (modResidual == 0 || modResidual->Size() != numTransformedDOF ||	
-		modTangent == 0 || modTangent->noCols() != numTransformedDOF)	{  
-		opserr << "TransformationFE::setID() ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numTransformedDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	}
-    } else {
+    // set the pointers to the modified tangent matrix and residual vector;
+    // up to MAX_NUM_DOF the thread's FE_Workspace objects are used
+    if (modTangent != 0) delete modTangent;
+    if (modResidual != 0) delete modResidual;
+    modTangent = 0;
+    modResidual = 0;
+
+    if (numTransformedDOF > MAX_NUM_DOF) {
 	// create matrices and vectors for each object instance
 	modResidual = new Vector(numTransformedDOF);
 	modTangent = new Matrix(numTransformedDOF, numTransformedDOF);
@@ -288,13 +188,32 @@ TransformationFE::setID(void)
     return 0;
 }
 
+Matrix &
+TransformationFE::modTangentMatrix(void)
+{
+    if (modTangent != 0)
+	return *modTangent;
+
+    return FE_Workspace::getWorkspace().getMatrix(FE_Workspace::TransformationFE_Tangent, numTransformedDOF);
+}
+
+Vector &
+TransformationFE::modResidualVector(void)
+{
+    if (modResidual != 0)
+	return *modResidual;
+
+    return FE_Workspace::getWorkspace().getVector(FE_Workspace::TransformationFE_Residual, numTransformedDOF);
+}
+
 const Matrix &
 TransformationFE::getTangent(Integrator *theNewIntegrator)
 {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
+    FE_Workspace &theWorkspace = FE_Workspace::getWorkspace();
+    ID &numDOFs = theWorkspace.getScratchID(FE_Workspace::TransformationFE_NumDOFs, numGroups);
+    Matrix **theTransformations = (Matrix **)theWorkspace.getScratchPointers(FE_Workspace::TransformationFE_Transformations, numGroups);
     
     // DO THE SP STUFF TO THE TANGENT 
     
@@ -317,7 +236,9 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
     int noRowsTransformed = 0;
     int noRowsOriginal = 0;
 
-    static Matrix localK;
+    Matrix localK;
+    double *localKbuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_LocalK, numOriginalDOF*numOriginalDOF);
+    double *dataBuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_TtKT, numTransformedDOF*numTransformedDOF);
 
     // foreach block row, for each block col do
     for (int i=0; i<numNode; i++) {
@@ -342,7 +263,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 	    // now perform the matrix computation T(i)^T localK T(j)
 	    // note: if T == 0 then the Identity is assumed
 	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
+	    Matrix localTtKT;
 	    
 	    if (Ti != 0 && Tj != 0) {
 		noRowsTransformed = Ti->noCols();
@@ -373,7 +294,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
 	    for (int c=0; c<noRowsTransformed; c++) 
 		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+		    this->modTangentMatrix()(startRow+c, startCol+d) = localTtKT(c,d);
 	    
 	    startCol += noColsTransformed;
 	    noColsOriginal += numDOFj;
@@ -383,7 +304,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 	startRow += noRowsTransformed;
     }
 
-    return *modTangent;
+    return this->modTangentMatrix();
 }
 
 
@@ -417,7 +338,7 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 	    orig(k-startRowOriginal)= theResidual(k);
 	  mod = (*Ti)^orig;
 	  for (int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-	    (*modResidual)(k) = mod (k-startRowTransformed);
+	    this->modResidualVector()(k) = mod (k-startRowTransformed);
 
 	  */
 
@@ -425,20 +346,20 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 	    double sum = 0.0;
 	    for (int k=0; k<noCols; k++)
 	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-	    (*modResidual)(startRowTransformed +j) = sum;
+	    this->modResidualVector()(startRowTransformed +j) = sum;
 	  }
 
 	} else {
 	  noCols = theDOFs[i]->getNumDOF();
 	  noRows = noCols;
 	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
+	    this->modResidualVector()(startRowTransformed +j) = theResidual(startRowOriginal + j);
 	}
 	startRowTransformed += noRows;
 	startRowOriginal += noCols;
     }
 
-    return *modResidual;
+    return this->modResidualVector();
 }
 
 
@@ -448,8 +369,8 @@ const Vector &
 TransformationFE::getTangForce(const Vector &disp, double fact)
 {
     opserr << "TransformationFE::getTangForce() - not yet implemented\n";
-    modResidual->Zero();
-    return *modResidual;
+    this->modResidualVector().Zero();
+    return this->modResidualVector();
 }
 
 const Vector &
@@ -459,8 +380,9 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  FE_Workspace &theWorkspace = FE_Workspace::getWorkspace();
+  ID &numDOFs = theWorkspace.getScratchID(FE_Workspace::TransformationFE_NumDOFs, numGroups);
+  Matrix **theTransformations = (Matrix **)theWorkspace.getScratchPointers(FE_Workspace::TransformationFE_Transformations, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -483,7 +405,9 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
+  double *localKbuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_LocalK, numOriginalDOF*numOriginalDOF);
+  double *dataBuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_TtKT, numTransformedDOF*numTransformedDOF);
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -508,7 +432,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -540,7 +464,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  this->modTangentMatrix()(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -561,9 +485,9 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  this->modResidualVector().addMatrixVector(0.0, this->modTangentMatrix(), tmp, 1.0);
 
-  return *modResidual;
+  return this->modResidualVector();
 }
 
 
@@ -574,8 +498,9 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   this->FE_Element::addKiToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  FE_Workspace &theWorkspace = FE_Workspace::getWorkspace();
+  ID &numDOFs = theWorkspace.getScratchID(FE_Workspace::TransformationFE_NumDOFs, numGroups);
+  Matrix **theTransformations = (Matrix **)theWorkspace.getScratchPointers(FE_Workspace::TransformationFE_Transformations, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -598,7 +523,9 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
+  double *localKbuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_LocalK, numOriginalDOF*numOriginalDOF);
+  double *dataBuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_TtKT, numTransformedDOF*numTransformedDOF);
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -623,7 +550,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -655,7 +582,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  this->modTangentMatrix()(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -676,9 +603,9 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  this->modResidualVector().addMatrixVector(0.0, this->modTangentMatrix(), tmp, 1.0);
 
-  return *modResidual;
+  return this->modResidualVector();
 }
 
 const Vector &
@@ -688,8 +615,9 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   this->FE_Element::addMtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  FE_Workspace &theWorkspace = FE_Workspace::getWorkspace();
+  ID &numDOFs = theWorkspace.getScratchID(FE_Workspace::TransformationFE_NumDOFs, numGroups);
+  Matrix **theTransformations = (Matrix **)theWorkspace.getScratchPointers(FE_Workspace::TransformationFE_Transformations, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -712,7 +640,9 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
+  double *localKbuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_LocalK, numOriginalDOF*numOriginalDOF);
+  double *dataBuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_TtKT, numTransformedDOF*numTransformedDOF);
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -737,7 +667,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -769,7 +699,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  this->modTangentMatrix()(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -790,9 +720,9 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  this->modResidualVector().addMatrixVector(0.0, this->modTangentMatrix(), tmp, 1.0);
 
-  return *modResidual;
+  return this->modResidualVector();
 }
 
 const Vector &
@@ -802,8 +732,9 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  FE_Workspace &theWorkspace = FE_Workspace::getWorkspace();
+  ID &numDOFs = theWorkspace.getScratchID(FE_Workspace::TransformationFE_NumDOFs, numGroups);
+  Matrix **theTransformations = (Matrix **)theWorkspace.getScratchPointers(FE_Workspace::TransformationFE_Transformations, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -826,7 +757,9 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
+  double *localKbuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_LocalK, numOriginalDOF*numOriginalDOF);
+  double *dataBuffer = theWorkspace.getScratchData(FE_Workspace::TransformationFE_TtKT, numTransformedDOF*numTransformedDOF);
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -851,7 +784,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -883,7 +816,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  this->modTangentMatrix()(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -904,9 +837,9 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  this->modResidualVector().addMatrixVector(0.0, this->modTangentMatrix(), tmp, 1.0);
 
-  return *modResidual;
+  return this->modResidualVector();
 }
 
 
@@ -916,17 +849,16 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector &response = FE_Workspace::getWorkspace().getScratchVector(FE_Workspace::TransformationFE_Response, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    this->modResidualVector()(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    this->modResidualVector()(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(this->modResidualVector(), response);
     this->addLocalD_Force(response, fact);
 }   	 
 
@@ -936,17 +868,16 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector &response = FE_Workspace::getWorkspace().getScratchVector(FE_Workspace::TransformationFE_Response, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    this->modResidualVector()(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    this->modResidualVector()(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(this->modResidualVector(), response);
     this->addLocalM_Force(response, fact);
 }   	 
 
@@ -958,18 +889,18 @@ TransformationFE::getLastResponse(void)
 {
     Integrator *theLastIntegrator = this->getLastIntegrator();
     if (theLastIntegrator != 0) {
-	if (theLastIntegrator->getLastResponse(*modResidual,*modID) < 0) {
+	if (theLastIntegrator->getLastResponse(this->modResidualVector(),*modID) < 0) {
 	    opserr << "WARNING TransformationFE::getLastResponse(void)";
 	    opserr << " - the Integrator had problems with getLastResponse()\n";
 	}
     }
     else {
-	modResidual->Zero();
+	this->modResidualVector().Zero();
 	opserr << "WARNING  TransformationFE::getLastResponse()";
 	opserr << " No Integrator yet passed\n";
     }
     
-    Vector &result = *modResidual;
+    Vector &result = this->modResidualVector();
     return result;
 }
 
@@ -1019,17 +950,16 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector &response = FE_Workspace::getWorkspace().getScratchVector(FE_Workspace::TransformationFE_Response, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    this->modResidualVector()(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    this->modResidualVector()(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(this->modResidualVector(), response);
     this->addLocalD_ForceSensitivity(gradNumber, response, fact);
 }   	 
 
@@ -1039,17 +969,16 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector &response = FE_Workspace::getWorkspace().getScratchVector(FE_Workspace::TransformationFE_Response, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    this->modResidualVector()(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    this->modResidualVector()(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(this->modResidualVector(), response);
     this->addLocalM_ForceSensitivity(gradNumber, response, fact);
 }   	 
 
@@ -79,29 +79,20 @@ class TransformationFE: public FE_Element
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
     
   private:
+    // the objects used to form the modified tangent and residual
+    Matrix &modTangentMatrix(void);
+    Vector &modResidualVector(void);
     
     // private variables - a copy for each object of the class        
     DOF_Group **theDOFs;
     int numSPs;
     SP_Constraint **theSPs;
     ID *modID;
-    Matrix *modTangent;
-    Vector *modResidual;
+    Matrix *modTangent;   // 0 if the FE_Workspace matrix is used
+    Vector *modResidual;  // 0 if the FE_Workspace vector is used
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
-    
-    // static variables - single copy for all objects of the class	
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
-    static int numTransFE;     // number of objects    
-    static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
-    static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
-    static int sizeBuffer;
 };
 
 #endif
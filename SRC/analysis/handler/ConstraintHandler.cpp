@@ -60,6 +60,21 @@ ConstraintHandler::doneNumberingDOF(void)
   return 0;
 }
 
+// int removeElements(const ID &eleTags);
+//	Invoked by the analysis when the only change to the Domain since
+//	handle() is the removal of the Elements given. Removes their
+//	FE_Elements from the AnalysisModel, leaving the DOF_Groups and the
+//	numbering as they are. A negative return means handle() must be
+//	invoked again; subclasses holding on to FE_Elements must override.
+
+int
+ConstraintHandler::removeElements(const ID &eleTags)
+{
+  if (theAnalysisModelPtr == 0)
+    return -1;
+  return theAnalysisModelPtr->removeFE_Elements(eleTags);
+}
+
 void 
 ConstraintHandler::setLinks(Domain &theDomain, 
 			    AnalysisModel &theModel,
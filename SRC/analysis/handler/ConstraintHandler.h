@@ -62,6 +62,7 @@ class ConstraintHandler : public MovableObject
     virtual int update(void);
     virtual int applyLoad(void);
     virtual int doneNumberingDOF(void);
+    virtual int removeElements(const ID &eleTags);
     virtual void clearAll(void) =0;    
 
   protected:
@@ -411,6 +411,14 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 
 
 
+int
+TransformationConstraintHandler::removeElements(const ID &eleTags)
+{
+    // theFEs holds on to the FE_Elements, so the model is rebuilt
+    return -1;
+}
+
+
 void 
 TransformationConstraintHandler::clearAll(void)
 {
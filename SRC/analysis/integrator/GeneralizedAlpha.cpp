@@ -205,6 +205,17 @@ int GeneralizedAlpha::newStep(double _deltaT)
 }
 
 
+double GeneralizedAlpha::getLocalError(double absTol, double relTol)
+{
+    if (U == 0)
+        return -1.0;
+
+    // the estimate for Newmark with the beta of this scheme
+    return this->getNewmarkError(beta, deltaT, *U, *Udotdot, *Utdotdot,
+                                 absTol, relTol);
+}
+
+
 int GeneralizedAlpha::revertToLastStep()
 {
     // set response at t+deltaT to be that at t .. for next step
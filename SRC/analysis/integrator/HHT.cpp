@@ -193,6 +193,17 @@ int HHT::newStep(double _deltaT)
 }
 
 
+double HHT::getLocalError(double absTol, double relTol)
+{
+    if (U == 0)
+        return -1.0;
+
+    // the estimate for Newmark with the beta of this scheme
+    return this->getNewmarkError(beta, deltaT, *U, *Udotdot, *Utdotdot,
+                                 absTol, relTol);
+}
+
+
 int HHT::revertToLastStep()
 {
     // set response at t+deltaT to be that at t .. for next step
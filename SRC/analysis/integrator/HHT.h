@@ -62,6 +62,7 @@ public:
     int commit(void);
 
     const Vector &getVel(void);
+    double getLocalError(double absTol, double relTol);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -39,14 +39,18 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <Domain.h>
 #include <cmath>
+#include <vector>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ theColoredFEs(0), colorStart(0), coloredResults(0), coloredThreadSafe(0),
+ numColors(0), numColoredFEs(0), numThreadSafeFEs(0), colorStamp(-1), numThreads(1)
 {
   
 }
@@ -65,6 +69,14 @@ IncrementalIntegrator::~IncrementalIntegrator()
     delete tmpV1;
   if (tmpV2 != 0)
     delete tmpV2;
+  if (theColoredFEs != 0)
+    delete [] theColoredFEs;
+  if (colorStart != 0)
+    delete [] colorStart;
+  if (coloredResults != 0)
+    delete [] coloredResults;
+  if (coloredThreadSafe != 0)
+    delete [] coloredThreadSafe;
 }
 
 void
@@ -99,6 +111,12 @@ IncrementalIntegrator::formTangent(int statFlag)
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
 
+    if (this->useColoredAssembly() == true) {
+      if (this->addColoredContributions(true) < 0)
+	result = -3;
+      return result;
+    }
+
     // loop through the FE_Elements adding their contributions to the tangent
     FE_Element *elePtr;
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
@@ -271,6 +289,12 @@ IncrementalIntegrator::formElementResidual(void)
 
     int res = 0;    
 
+    if (this->useColoredAssembly() == true) {
+      if (this->addColoredContributions(false) < 0)
+	res = -2;
+      return res;
+    }
+
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0) {
 
@@ -284,6 +308,184 @@ IncrementalIntegrator::formElementResidual(void)
     return res;	    
 }
 
+bool
+IncrementalIntegrator::useColoredAssembly(void)
+{
+#ifdef _OPENMP
+    if (theAnalysisModel == 0 || theSOE == 0)
+	return false;
+
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+    if (theDomain == 0 || theDomain->getNumThreads() < 2)
+	return false;
+
+    if (theSOE->isThreadSafe() == false)
+	return false;
+
+    numThreads = theDomain->getNumThreads();
+
+    // color the FE_Elements once for each numbering of the equations
+    if (colorStamp != theAnalysisModel->getEqnStamp())
+	if (this->formColors() < 0)
+	    return false;
+
+    return (numThreadSafeFEs > 0);
+#else
+    return false;
+#endif
+}
+
+int
+IncrementalIntegrator::formColors(void)
+{
+    // count the FE_Elements & make sure there is space
+    int numFE = 0;
+    FE_Element *elePtr;
+    FE_EleIter &theEles1 = theAnalysisModel->getFEs();
+    while ((elePtr = theEles1()) != 0)
+	numFE++;
+
+    if (numFE > numColoredFEs || theColoredFEs == 0) {
+	if (theColoredFEs != 0)
+	    delete [] theColoredFEs;
+	if (colorStart != 0)
+	    delete [] colorStart;
+	if (coloredResults != 0)
+	    delete [] coloredResults;
+	if (coloredThreadSafe != 0)
+	    delete [] coloredThreadSafe;
+	theColoredFEs = new FE_Element *[numFE+1];
+	colorStart = new int[numFE+2];
+	coloredResults = new int[numFE+1];
+	coloredThreadSafe = new char[numFE+1];
+    }
+    numColoredFEs = numFE;
+    numColors = 0;
+    numThreadSafeFEs = 0;
+
+    // each FE_Element is given, first-fit, the smallest color not yet
+    // used by an FE_Element sharing an equation with it, so FE_Elements
+    // of one color share no equations; a structured mesh needs only a
+    // few colors. The colors are processed in turn, so the contributions
+    // to any one entry of the SOE are added in the same order for every
+    // run and number of threads; that order is by color and not the
+    // FE_EleIter order of the serial loop, so the assembled system can
+    // differ from the serial one in the last bits.
+    int numEqn = theAnalysisModel->getNumEqn();
+    std::vector<std::vector<int> > eqnColors(numEqn);
+    std::vector<int> colorMark;
+    int *feColor = new int[numFE+1];
+
+    int count = 0;
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();
+    while ((elePtr = theEles2()) != 0 && count < numFE) {
+	const ID &id = elePtr->getID();
+	int idSize = id.Size();
+
+	// mark the colors in use at the equations and take the first free one
+	for (int i=0; i<idSize; i++) {
+	    int eqn = id(i);
+	    if (eqn >= 0 && eqn < numEqn) {
+		const std::vector<int> &used = eqnColors[eqn];
+		for (std::size_t j=0; j<used.size(); j++)
+		    colorMark[used[j]] = count;
+	    }
+	}
+	int color = 0;
+	while (color < numColors && colorMark[color] == count)
+	    color++;
+	if (color == numColors) {
+	    numColors++;
+	    colorMark.push_back(-1);
+	}
+
+	for (int i=0; i<idSize; i++) {
+	    int eqn = id(i);
+	    if (eqn >= 0 && eqn < numEqn)
+		eqnColors[eqn].push_back(color);
+	}
+	feColor[count] = color;
+	theColoredFEs[count++] = elePtr;
+    }
+
+    // bucket the FE_Elements by color, keeping their order within a color
+    for (int c=0; c<=numColors; c++)
+	colorStart[c] = 0;
+    for (int i=0; i<numFE; i++)
+	colorStart[feColor[i]+1]++;
+    for (int c=0; c<numColors; c++)
+	colorStart[c+1] += colorStart[c];
+
+    FE_Element **theFEs = new FE_Element *[numFE+1];
+    int *nextLoc = new int[numColors+1];
+    for (int i=0; i<numFE; i++)
+	theFEs[i] = theColoredFEs[i];
+    for (int c=0; c<numColors; c++)
+	nextLoc[c] = colorStart[c];
+    for (int i=0; i<numFE; i++) {
+	int loc = nextLoc[feColor[i]]++;
+	theColoredFEs[loc] = theFEs[i];
+	coloredThreadSafe[loc] = theFEs[i]->isThreadSafe() ? 1 : 0;
+	if (coloredThreadSafe[loc] != 0)
+	    numThreadSafeFEs++;
+    }
+
+    delete [] theFEs;
+    delete [] nextLoc;
+    delete [] feColor;
+
+    colorStamp = theAnalysisModel->getEqnStamp();
+
+    return 0;
+}
+
+int
+IncrementalIntegrator::addColoredContributions(bool tangent)
+{
+    for (int c=0; c<numColors; c++) {
+	int start = colorStart[c];
+	int end = colorStart[c+1];
+
+	// FE_Elements of a color touch disjoint equations, those that are
+	// thread safe form and add their contributions concurrently
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic)
+	for (int i=start; i<end; i++) {
+	    if (coloredThreadSafe[i] != 0) {
+		FE_Element *elePtr = theColoredFEs[i];
+		if (tangent == true)
+		    coloredResults[i] = theSOE->addA(elePtr->getTangent(this),elePtr->getID());
+		else
+		    coloredResults[i] = theSOE->addB(elePtr->getResidual(this),elePtr->getID());
+	    }
+	}
+
+	// and the remainder one at a time
+	for (int i=start; i<end; i++) {
+	    if (coloredThreadSafe[i] == 0) {
+		FE_Element *elePtr = theColoredFEs[i];
+		if (tangent == true)
+		    coloredResults[i] = theSOE->addA(elePtr->getTangent(this),elePtr->getID());
+		else
+		    coloredResults[i] = theSOE->addB(elePtr->getResidual(this),elePtr->getID());
+	    }
+	}
+    }
+
+    int res = 0;
+    for (int i=0; i<numColoredFEs; i++) {
+	if (coloredResults[i] < 0) {
+	    opserr << "WARNING IncrementalIntegrator::addColoredContributions -";
+	    if (tangent == true)
+		opserr << " failed in addA for ID " << theColoredFEs[i]->getID();
+	    else
+		opserr << " failed in addB for ID " << theColoredFEs[i]->getID();
+	    res = -1;
+	}
+    }
+
+    return res;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
@@ -111,6 +111,11 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+
+    // methods for the colored, threaded assembly of the FE_Elements
+    bool useColoredAssembly(void);
+    int  addColoredContributions(bool tangent);
+
     int statusFlag;
     double iFactor;
     double cFactor;
@@ -127,10 +132,24 @@ class IncrementalIntegrator : public Integrator
     Vector *tmpV2;
     
   private:
+    int  formColors(void);
+
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    // FE_Elements sorted by color, colorStart[c] giving the first
+    // FE_Element of color c, and the eqn stamp they were formed for
+    FE_Element **theColoredFEs;
+    int *colorStart;
+    int *coloredResults;
+    char *coloredThreadSafe;
+    int numColors;
+    int numColoredFEs;
+    int numThreadSafeFEs;
+    int colorStamp;
+    int numThreads;
+
 };
 
 #endif
@@ -104,7 +104,7 @@ OPS_Newmark(void)
 
 Newmark::Newmark(int classTag)
     : TransientIntegrator(classTag),
-      displ(1), gamma(0), beta(0), 
+      displ(1), gamma(0), beta(0), dt(0.0), 
       c1(0.0), c2(0.0), c3(0.0), 
       Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
       determiningMass(false),
@@ -118,7 +118,7 @@ Newmark::Newmark(int classTag)
 
 Newmark::Newmark(double _gamma, double _beta, int dispFlag, bool aflag, int classTag_)
     : TransientIntegrator(classTag_),
-      displ(dispFlag), gamma(_gamma), beta(_beta), 
+      displ(dispFlag), gamma(_gamma), beta(_beta), dt(0.0), 
       c1(0.0), c2(0.0), c3(0.0), 
       Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
       determiningMass(false),
@@ -170,6 +170,7 @@ int Newmark::newStep(double deltaT)
 
     // get a pointer to the AnalysisModel
     AnalysisModel *theModel = this->getAnalysisModel();
+    dt = deltaT;
     
     // set the constants
     if (displ == 1)  {
@@ -267,6 +268,16 @@ Newmark::getVel(void)
   return *Udot;
 }
 
+double Newmark::getLocalError(double absTol, double relTol)
+{
+    if (U == 0)
+        return -1.0;
+
+    return this->getNewmarkError(beta, dt, *U, *Udotdot, *Utdotdot,
+                                 absTol, relTol);
+}
+
+
 int Newmark::revertToLastStep()
 {
   // set response at t+deltaT to be that at t .. for next newStep
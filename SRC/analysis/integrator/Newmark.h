@@ -68,6 +68,7 @@ public:
     double getCFactor(void);
 
     const Vector &getVel(void);
+    double getLocalError(double absTol, double relTol);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -87,6 +88,7 @@ protected:
     int displ;      // a flag indicating whether displ(1), vel(2) or accel(3) increments
     double gamma;
     double beta;
+    double dt;                      // time step of the last newStep()
     
     double c1, c2, c3;              // some constants we need to keep
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
@@ -155,6 +155,25 @@ int TRBDF2::newStep(double deltaT)
 }
 
 
+double TRBDF2::getLocalError(double absTol, double relTol)
+{
+  if (U == 0)
+    return -1.0;
+
+  // error constants of the trapezoidal rule and of BDF2, with the
+  // third derivative taken from the change in acceleration
+  double c = (step == 0) ? 1.0/12.0 : 2.0/9.0;
+  return this->getErrorNorm(*U, *Udotdot, *Utdotdot, c*dt*dt, absTol, relTol);
+}
+
+
+bool TRBDF2::canChangeDeltaT(void)
+{
+  // the BDF2 step must follow its trapezoidal step with the same dt
+  return (step == 1);
+}
+
+
 int TRBDF2::revertToLastStep()
 {
   // set response at t+deltaT to be that at t .. for next newStep
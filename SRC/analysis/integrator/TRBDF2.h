@@ -62,6 +62,8 @@ public:
     int update(const Vector &deltaU);
 
     const Vector &getVel(void);
+    double getLocalError(double absTol, double relTol);
+    bool canChangeDeltaT(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
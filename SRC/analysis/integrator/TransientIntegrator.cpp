@@ -44,6 +44,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <math.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -104,6 +105,14 @@ TransientIntegrator::formTangent(int statFlag)
 	}
     }    
 
+    if (this->useColoredAssembly() == true) {
+	if (this->addColoredContributions(true) < 0) {
+	    opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
+	    result = -2;
+	}
+	return result;
+    }
+
     // loop through the FE_Elements getting them to add the tangent    
     FE_EleIter &theEles2 = theModel->getFEs();    
     FE_Element *elePtr;    
@@ -168,5 +177,54 @@ TransientIntegrator::formNodUnbalance(DOF_Group *theDof)
   return 0;
 }    
 
+double
+TransientIntegrator::getLocalError(double absTol, double relTol)
+{
+  return -1.0;
+}
+
+double
+TransientIntegrator::getErrorNorm(const Vector &U, const Vector &Udotdot,
+				  const Vector &Utdotdot, double c,
+				  double absTol, double relTol)
+{
+  // the a posteriori estimate of Zienkiewicz and Xie: the displacement
+  // error is c*dt^2 times the change in acceleration over the step, with
+  // c depending on the integration rule; each component is weighted by
+  // absTol + relTol*|U(i)|
+  int size = U.Size();
+  if (size == 0)
+    return 0.0;
+
+  double sum = 0.0;
+  for (int i=0; i<size; i++) {
+    double error = c*(Udotdot(i) - Utdotdot(i));
+    double scale = absTol + relTol*fabs(U(i));
+    if (scale > 0.0) {
+      error /= scale;
+      sum += error*error;
+    }
+  }
+
+  return sqrt(sum/size);
+}
+
+double
+TransientIntegrator::getNewmarkError(double beta, double dt, const Vector &U,
+				     const Vector &Udotdot, const Vector &Utdotdot,
+				     double absTol, double relTol)
+{
+  // the Newmark constant is beta - 1/6; it vanishes for the linear
+  // acceleration rule (beta = 1/6), which then has no usable estimate
+  double c = beta - 1.0/6.0;
+  if (fabs(c) < 1.0e-6) {
+    opserr << "TransientIntegrator::getLocalError() - no error estimate for beta = 1/6;";
+    opserr << " use another beta for error controlled time stepping\n";
+    return -1.0;
+  }
+
+  return this->getErrorNorm(U, Udotdot, Utdotdot, c*dt*dt, absTol, relTol);
+}
+
 
 
@@ -66,7 +66,19 @@ class TransientIntegrator : public IncrementalIntegrator
     
     virtual int initialize(void) {return 0;};
 
+    // local error estimate for adaptive time stepping: a weighted rms
+    // norm of the displacement error of the step just solved, <= 1.0
+    // being acceptable; negative if the integrator has no estimate
+    virtual double getLocalError(double absTol, double relTol);
+    virtual bool canChangeDeltaT(void) {return true;};
+
   protected:
+    double getErrorNorm(const Vector &U, const Vector &Udotdot,
+			const Vector &Utdotdot, double c,
+			double absTol, double relTol);
+    double getNewmarkError(double beta, double dt, const Vector &U,
+			   const Vector &Udotdot, const Vector &Utdotdot,
+			   double absTol, double relTol);
     
   private:
 };
@@ -41,6 +41,7 @@
 #include <AnalysisModel.h>
 #include <Domain.h>
 #include <FE_Element.h>
+#include <Element.h>
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
@@ -49,6 +50,8 @@
 #include <Node.h>
 #include <NodeIter.h>
 #include <ConstraintHandler.h>
+#include <NodalStateStore.h>
+#include <typeinfo>
 
 
 #include <MapOfTaggedObjects.h>
@@ -63,7 +66,8 @@ AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), eqnStamp(0),
+ storeStamp(0), storeEqnStamp(-1)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    =  new ArrayOfTaggedObjects(1024);
@@ -77,7 +81,8 @@ AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), eqnStamp(0),
+ storeStamp(0), storeEqnStamp(-1)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -90,7 +95,8 @@ AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &t
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), eqnStamp(0),
+ storeStamp(0), storeEqnStamp(-1)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -159,6 +165,9 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
   if (result == true) {
     theElement->setAnalysisModel(*this);
     numFE_Ele++;
+    Element *theEle = theElement->getElement();
+    if (theEle != 0)
+      theEleFEs[theEle->getTag()] = tag;
     return true;  // o.k.
   } else
     return false;
@@ -200,6 +209,43 @@ AnalysisModel::addDOF_Group(DOF_Group *theGroup)
     return false;
 }
 
+// int removeFE_Elements(const ID &eleTags);
+//	Method to remove and delete the FE_Elements of the Elements whose
+//	tags are given, the Elements having already been removed from the
+//	Domain. The DOF_Groups and equation numbers are left as they are.
+//	Returns -1 if an Element has no FE_Element, in which case the
+//	AnalysisModel must be rebuilt.
+
+int
+AnalysisModel::removeFE_Elements(const ID &eleTags)
+{
+  if (theFEs == 0)
+    return -1;
+
+  int numEle = eleTags.Size();
+  for (int i=0; i<numEle; i++) {
+    std::unordered_map<int, int>::iterator it = theEleFEs.find(eleTags(i));
+    if (it == theEleFEs.end())
+      return -1;
+    TaggedObject *theFE = theFEs->removeComponent(it->second);
+    theEleFEs.erase(it);
+    if (theFE == 0)
+      return -1;
+    delete theFE;
+    numFE_Ele--;
+  }
+
+  // the connectivity is now stale; the FE_Element list has changed for
+  // those who cached it against the equation stamp
+  if (numEle != 0) {
+    this->clearDOFGraph();
+    this->clearDOFGroupGraph();
+    eqnStamp++;
+  }
+
+  return 0;
+}
+
 void
 AnalysisModel::clearAll(void) 
 {
@@ -212,6 +258,7 @@ AnalysisModel::clearAll(void)
 
     theFEs->clearAll();
     theDOFs->clearAll();
+    theEleFEs.clear();
 
     myDOFGraph = 0;
     myGroupGraph = 0;
@@ -219,6 +266,7 @@ AnalysisModel::clearAll(void)
     numFE_Ele =0;
     numDOF_Grp = 0;
     numEqn = 0;    
+    eqnStamp++;
 }
 
 void
@@ -279,6 +327,7 @@ void
 AnalysisModel::setNumEqn(int theNumEqn)
 {
     numEqn = theNumEqn;
+    eqnStamp++;
 }
 
 int 
@@ -287,6 +336,12 @@ AnalysisModel::getNumEqn(void) const
     return numEqn;
 }
 
+int 
+AnalysisModel::getEqnStamp(void) const
+{
+    return eqnStamp;
+}
+
 
 Graph &
 AnalysisModel::getDOFGraph(void)
@@ -436,6 +491,9 @@ AnalysisModel::setResponse(const Vector &disp,
 			   const Vector &vel, 
 			   const Vector &accel)
 {
+    if (this->setStoreResponse(&disp, &vel, &accel) == 0)
+	return;
+
     DOF_GrpIter &theDOFGrps = this->getDOFs();
     DOF_Group 	*dofPtr;
 
@@ -449,6 +507,9 @@ AnalysisModel::setResponse(const Vector &disp,
 void 
 AnalysisModel::setDisp(const Vector &disp)
 {
+    if (this->setStoreResponse(&disp, 0, 0) == 0)
+	return;
+
     DOF_GrpIter &theDOFGrps = this->getDOFs();
     DOF_Group 	*dofPtr;
 
@@ -459,7 +520,10 @@ AnalysisModel::setDisp(const Vector &disp)
 void 
 AnalysisModel::setVel(const Vector &vel)
 {
-        DOF_GrpIter &theDOFGrps = this->getDOFs();
+    if (this->setStoreResponse(0, &vel, 0) == 0)
+	return;
+
+    DOF_GrpIter &theDOFGrps = this->getDOFs();
     DOF_Group 	*dofPtr;
     
     while ((dofPtr = theDOFGrps()) != 0) 
@@ -470,6 +534,9 @@ AnalysisModel::setVel(const Vector &vel)
 void 
 AnalysisModel::setAccel(const Vector &accel)
 {
+    if (this->setStoreResponse(0, 0, &accel) == 0)
+	return;
+
     DOF_GrpIter &theDOFGrps = this->getDOFs();
     DOF_Group 	*dofPtr;
     
@@ -477,6 +544,97 @@ AnalysisModel::setAccel(const Vector &accel)
 	dofPtr->setNodeAccel(accel);	
 }	
 
+// int setStoreResponse(const Vector *disp, const Vector *vel, const Vector *accel);
+//	When the nodes of the domain are in a NodalStateStore and each
+//	DOF_Group passes its values straight to its node, the trial response
+//	is set by a single pass over the store arrays, with the same result
+//	as Node::setTrialDisp(), setTrialVel() and setTrialAccel(). Returns
+//	-1, leaving it to the DOF_Groups, if this is not possible.
+
+int
+AnalysisModel::setStoreResponse(const Vector *disp, const Vector *vel,
+				const Vector *accel)
+{
+    NodalStateStore *theStore = (myDomain != 0) ? myDomain->getNodalStateStore() : 0;
+    if (theStore == 0 || theStore->getNumDOF() == 0)
+	return -1;
+
+    // map the dofs of the DOF_Groups onto the store when the equations
+    // or the layout of the store have changed
+    if (storeStamp != theStore->getLayoutStamp() || storeEqnStamp != eqnStamp) {
+	storeStamp = theStore->getLayoutStamp();
+	storeEqnStamp = eqnStamp;
+	storeLoc.clear();
+	storeEqn.clear();
+
+	std::unordered_map<int, int> nodeIndex;
+	int numStoreNodes = theStore->getNumNodes();
+	for (int i=0; i<numStoreNodes; i++)
+	    nodeIndex[theStore->getNode(i)->getTag()] = i;
+
+	bool mapped = true;
+	DOF_GrpIter &theDOFGrps = this->getDOFs();
+	DOF_Group *dofPtr;
+	while (mapped == true && (dofPtr = theDOFGrps()) != 0) {
+	    // subclasses transform their values or have no node
+	    std::unordered_map<int, int>::iterator it = nodeIndex.find(dofPtr->getNodeTag());
+	    if (typeid(*dofPtr) != typeid(DOF_Group) || it == nodeIndex.end() ||
+		theStore->getNode(it->second)->getNumberDOF() != dofPtr->getNumDOF()) {
+		mapped = false;
+		break;
+	    }
+	    const ID &theID = dofPtr->getID();
+	    int loc = theStore->getNodeLocation(it->second);
+	    for (int i=0; i<theID.Size(); i++) {
+		storeLoc.push_back(loc+i);
+		storeEqn.push_back(theID(i));
+	    }
+	}
+
+	if (mapped == false) {
+	    storeLoc.clear();
+	    storeEqn.clear();
+	}
+    }
+
+    int n = (int)storeLoc.size();
+    if (n == 0)
+	return -1;
+
+    const int *loc = &storeLoc[0];
+    const int *eqn = &storeEqn[0];
+    int stride = theStore->getBlockSize();
+
+    // trial = new, incr = new - commit, incrDelta = new - old trial; the
+    // dofs without an equation keep their trial value
+    if (disp != 0) {
+	double *d = theStore->getDisp();
+	for (int i=0; i<n; i++) {
+	    int k = loc[i];
+	    double u = (eqn[i] >= 0) ? (*disp)(eqn[i]) : d[k];
+	    d[k+2*stride] = u - d[k+stride];
+	    d[k+3*stride] = u - d[k];
+	    d[k] = u;
+	}
+    }
+
+    if (vel != 0) {
+	double *v = theStore->getVel();
+	for (int i=0; i<n; i++)
+	    if (eqn[i] >= 0)
+		v[loc[i]] = (*vel)(eqn[i]);
+    }
+
+    if (accel != 0) {
+	double *a = theStore->getAccel();
+	for (int i=0; i<n; i++)
+	    if (eqn[i] >= 0)
+		a[loc[i]] = (*accel)(eqn[i]);
+    }
+
+    return 0;
+}
+
 void 
 AnalysisModel::incrDisp(const Vector &disp)
 {
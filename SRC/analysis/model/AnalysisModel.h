@@ -40,6 +40,8 @@
 // What: "@(#) AnalysisModel.h, revA"
 
 #include <MovableObject.h>
+#include <unordered_map>
+#include <vector>
 
 class TaggedObjectStorage;
 class Domain;
@@ -51,6 +53,7 @@ class DOF_Group;
 class Vector;
 class FEM_ObjectBroker;
 class ConstraintHandler;
+class ID;
 
 class AnalysisModel: public MovableObject
 {
@@ -64,6 +67,7 @@ class AnalysisModel: public MovableObject
     // methods to populate/depopulate the AnalysisModel
     virtual bool addFE_Element(FE_Element *theFE_Ele);
     virtual bool addDOF_Group(DOF_Group *theDOF_Grp);
+    virtual int  removeFE_Elements(const ID &eleTags);
     virtual void clearAll(void);
     virtual void clearDOFGraph(void);
     virtual void clearDOFGroupGraph(void);
@@ -77,6 +81,7 @@ class AnalysisModel: public MovableObject
     // method to access the connectivity for SysOfEqn to size itself
     virtual void setNumEqn(int) ;	
     virtual int getNumEqn(void) const ; 
+    int getEqnStamp(void) const;
     virtual Graph &getDOFGraph(void);
     virtual Graph &getDOFGroupGraph(void);
     
@@ -125,6 +130,9 @@ class AnalysisModel: public MovableObject
 
     
   private:
+    int setStoreResponse(const Vector *disp, const Vector *vel,
+			 const Vector *accel);
+
     Domain *myDomain;
     ConstraintHandler *myHandler;
 
@@ -134,6 +142,14 @@ class AnalysisModel: public MovableObject
     int numFE_Ele;             // number of FE_Elements objects added
     int numDOF_Grp;            // number of DOF_Group objects added
     int numEqn;                // numEqn set by the ConstraintHandler typically
+    int eqnStamp;              // incremented each time the equations are renumbered
+                               // or FE_Elements are removed
+    std::unordered_map<int, int> theEleFEs; // FE_Element tag of each Element tag
+
+    // position in the domain's NodalStateStore and equation number of
+    // each dof of the DOF_Groups, for setting the response over the store
+    std::vector<int> storeLoc, storeEqn;
+    int storeStamp, storeEqnStamp;
 
     TaggedObjectStorage  *theFEs;
     TaggedObjectStorage  *theDOFs;
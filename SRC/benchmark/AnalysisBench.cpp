@@ -0,0 +1,135 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/AnalysisBench.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the end-to-end cases of OpenSeesBench:
+// a Newmark transient analysis with Newton-Raphson iterations of the
+// nonlinear fiber frame and of the elastic brick block. The model and
+// the analysis are built afresh before each repetition and only the
+// time steps are timed. The items reported are time steps.
+
+#include "OpenSeesBench.h"
+#include "BenchmarkRunner.h"
+#include "BenchModels.h"
+
+#include <Domain.h>
+#include <OPS_Globals.h>
+
+#include <DirectIntegrationAnalysis.h>
+#include <AnalysisModel.h>
+#include <NewtonRaphson.h>
+#include <CTestNormDispIncr.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <Newmark.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+
+class TransientRun
+{
+  public:
+    TransientRun() :theDomain(0), theAnalysis(0) {}
+    ~TransientRun() {this->clear();}
+
+    void setUp(bool solid, bool quick, int numThreads);
+    void clear(void);
+
+    Domain *theDomain;
+    DirectIntegrationAnalysis *theAnalysis;
+};
+
+void
+TransientRun::setUp(bool solid, bool quick, int numThreads)
+{
+  this->clear();
+
+  theDomain = new Domain();
+  theDomain->setNumThreads(numThreads);
+
+  LinearSOE *theSOE;
+  if (solid == true) {
+    int n = quick ? 4 : 10;
+    createBenchSolid(*theDomain, n, n, n);
+    ProfileSPDLinDirectSolver *theSolver = new ProfileSPDLinDirectSolver();
+    theSOE = new ProfileSPDLinSOE(*theSolver);
+  } else {
+    createBenchFrame(*theDomain, 3, 3, quick ? 3 : 6);
+    BandGenLinLapackSolver *theSolver = new BandGenLinLapackSolver();
+    theSOE = new BandGenLinSOE(*theSolver);
+  }
+
+  AnalysisModel *theModel = new AnalysisModel();
+  ConvergenceTest *theTest = new CTestNormDispIncr(1.0e-8, 20, 0);
+  EquiSolnAlgo *theAlgorithm = new NewtonRaphson();
+  ConstraintHandler *theHandler = new PlainHandler();
+  RCM *theRCM = new RCM();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*theRCM);
+  TransientIntegrator *theIntegrator = new Newmark(0.5, 0.25);
+
+  theAnalysis = new DirectIntegrationAnalysis(*theDomain, *theHandler, *theNumberer,
+					      *theModel, *theAlgorithm, *theSOE,
+					      *theIntegrator, theTest);
+}
+
+void
+TransientRun::clear(void)
+{
+  if (theAnalysis != 0) {
+    theAnalysis->clearAll();
+    delete theAnalysis;
+    theAnalysis = 0;
+  }
+  if (theDomain != 0) {
+    delete theDomain;
+    theDomain = 0;
+  }
+}
+
+void
+benchAnalysis(BenchmarkRunner &theRunner)
+{
+  const double dT = 0.01;
+  int numSteps = theRunner.isQuick() ? 10 : 100;
+  bool quick = theRunner.isQuick();
+  int numThreads = theRunner.getNumThreads();
+
+  TransientRun theRun;
+  for (int i = 0; i < 2; i++) {
+    bool solid = (i == 1);
+    const char *name = solid ? "Analysis/transient/solid" : "Analysis/transient/frame";
+    theRunner.run(name,
+		  [&]() {
+		    theRun.setUp(solid, quick, numThreads);
+		  },
+		  [&]() {
+		    if (theRun.theAnalysis->analyze(numSteps, dT) < 0)
+		      opserr << "OpenSeesBench - " << name << " failed to converge\n";
+		  }, numSteps, "step");
+    theRun.clear();
+  }
+}
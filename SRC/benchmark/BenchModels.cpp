@@ -0,0 +1,251 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/BenchModels.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the model generators for OpenSeesBench.
+
+#include "BenchModels.h"
+
+#include <Domain.h>
+#include <Node.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <SP_Constraint.h>
+#include <LoadPattern.h>
+#include <TrigSeries.h>
+#include <NodalLoad.h>
+
+#include <Steel02.h>
+#include <Concrete02.h>
+#include <ElasticMaterial.h>
+#include <UniaxialFiber3d.h>
+#include <FiberSection3d.h>
+#include <ForceBeamColumn3d.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearCrdTransf3d.h>
+
+#include <ElasticIsotropicThreeDimensional.h>
+#include <Brick.h>
+
+FiberSection3d *
+createBenchSection(int tag, int numFibersY, int numFibersZ)
+{
+  const double h = 0.5;        // section depth and width
+  const double cover = 0.05;
+  const double barArea = 5.0e-4;
+
+  Concrete02 concrete(1, -30000.0, -0.002, -6000.0, -0.006, 0.1, 3000.0, 1.5e6);
+  Steel02 steel(2, 420000.0, 2.0e8, 0.01, 18.0, 0.925, 0.15);
+  ElasticMaterial torsion(3, 1.0e6);
+
+  int numFibers = numFibersY*numFibersZ + 8;
+  Fiber **theFibers = new Fiber *[numFibers];
+  Vector position(2);
+
+  double dy = h/numFibersY;
+  double dz = h/numFibersZ;
+  int count = 0;
+  for (int i = 0; i < numFibersY; i++) {
+    for (int j = 0; j < numFibersZ; j++) {
+      position(0) = -0.5*h + (i+0.5)*dy;
+      position(1) = -0.5*h + (j+0.5)*dz;
+      theFibers[count] = new UniaxialFiber3d(count+1, concrete, dy*dz, position);
+      count++;
+    }
+  }
+
+  double barLoc[3] = {-0.5*h+cover, 0.0, 0.5*h-cover};
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      if (i == 1 && j == 1)
+	continue;
+      position(0) = barLoc[i];
+      position(1) = barLoc[j];
+      theFibers[count] = new UniaxialFiber3d(count+1, steel, barArea, position);
+      count++;
+    }
+  }
+
+  FiberSection3d *theSection = new FiberSection3d(tag, numFibers, theFibers, torsion);
+
+  // the section keeps copies of the fiber materials
+  for (int i = 0; i < numFibers; i++)
+    delete theFibers[i];
+  delete [] theFibers;
+
+  return theSection;
+}
+
+int
+createBenchFrame(Domain &theDomain, int numBaysX, int numBaysY,
+		 int numStories, int numFibersPerSide)
+{
+  const double bayWidth = 5.0;
+  const double storyHeight = 3.0;
+  const double nodalMass = 20.0;
+  const int numSections = 5;
+
+  int numNodesX = numBaysX + 1;
+  int numNodesY = numBaysY + 1;
+
+  Matrix mass(6,6);
+  mass(0,0) = nodalMass;
+  mass(1,1) = nodalMass;
+  mass(2,2) = nodalMass;
+
+  for (int k = 0; k <= numStories; k++) {
+    for (int j = 0; j < numNodesY; j++) {
+      for (int i = 0; i < numNodesX; i++) {
+	int tag = 1 + i + numNodesX*(j + numNodesY*k);
+	Node *theNode = new Node(tag, 6, i*bayWidth, j*bayWidth, k*storyHeight);
+	theDomain.addNode(theNode);
+	if (k == 0) {
+	  for (int dof = 0; dof < 6; dof++)
+	    theDomain.addSP_Constraint(new SP_Constraint(tag, dof, 0.0, true));
+	} else
+	  theNode->setMass(mass);
+      }
+    }
+  }
+
+  FiberSection3d *theSection = createBenchSection(1, numFibersPerSide, numFibersPerSide);
+  SectionForceDeformation *theSections[numSections];
+  for (int i = 0; i < numSections; i++)
+    theSections[i] = theSection;
+
+  LobattoBeamIntegration theIntegration;
+  Vector vecXZ(3);
+  vecXZ(0) = 1.0;
+  LinearCrdTransf3d columnTransf(1, vecXZ);
+  vecXZ(0) = 0.0;
+  vecXZ(2) = 1.0;
+  LinearCrdTransf3d beamTransf(2, vecXZ);
+
+  int numElements = 0;
+  for (int k = 0; k < numStories; k++) {
+    for (int j = 0; j < numNodesY; j++) {
+      for (int i = 0; i < numNodesX; i++) {
+	int nodeI = 1 + i + numNodesX*(j + numNodesY*k);
+	int nodeJ = nodeI + numNodesX*numNodesY;
+	numElements++;
+	theDomain.addElement(new ForceBeamColumn3d(numElements, nodeI, nodeJ, numSections,
+						   theSections, theIntegration, columnTransf));
+      }
+    }
+
+    for (int j = 0; j < numNodesY; j++) {
+      for (int i = 0; i < numNodesX; i++) {
+	int node = 1 + i + numNodesX*(j + numNodesY*(k+1));
+	if (i < numBaysX) {
+	  numElements++;
+	  theDomain.addElement(new ForceBeamColumn3d(numElements, node, node+1, numSections,
+						     theSections, theIntegration, beamTransf));
+	}
+	if (j < numBaysY) {
+	  numElements++;
+	  theDomain.addElement(new ForceBeamColumn3d(numElements, node, node+numNodesX, numSections,
+						     theSections, theIntegration, beamTransf));
+	}
+      }
+    }
+  }
+
+  delete theSection;
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new TrigSeries(1, 0.0, 1.0e10, 0.5, 0.0));
+  theDomain.addLoadPattern(thePattern);
+
+  Vector load(6);
+  load(0) = 100.0;
+  for (int j = 0; j < numNodesY; j++) {
+    for (int i = 0; i < numNodesX; i++) {
+      int node = 1 + i + numNodesX*(j + numNodesY*numStories);
+      theDomain.addNodalLoad(new NodalLoad(node, node, load), 1);
+    }
+  }
+
+  theDomain.setRayleighDampingFactors(0.2, 0.0, 0.0, 0.002);
+
+  return numElements;
+}
+
+int
+createBenchSolid(Domain &theDomain, int numX, int numY, int numZ)
+{
+  const double size = 1.0;
+
+  int numNodesX = numX + 1;
+  int numNodesY = numY + 1;
+
+  for (int k = 0; k <= numZ; k++) {
+    for (int j = 0; j < numNodesY; j++) {
+      for (int i = 0; i < numNodesX; i++) {
+	int tag = 1 + i + numNodesX*(j + numNodesY*k);
+	theDomain.addNode(new Node(tag, 3, i*size, j*size, k*size));
+	if (k == 0) {
+	  for (int dof = 0; dof < 3; dof++)
+	    theDomain.addSP_Constraint(new SP_Constraint(tag, dof, 0.0, true));
+	}
+      }
+    }
+  }
+
+  ElasticIsotropicThreeDimensional theMaterial(1, 3.0e7, 0.2, 2.4);
+
+  int numElements = 0;
+  int layer = numNodesX*numNodesY;
+  for (int k = 0; k < numZ; k++) {
+    for (int j = 0; j < numY; j++) {
+      for (int i = 0; i < numX; i++) {
+	int n1 = 1 + i + numNodesX*(j + numNodesY*k);
+	int n2 = n1 + 1;
+	int n3 = n2 + numNodesX;
+	int n4 = n1 + numNodesX;
+	numElements++;
+	theDomain.addElement(new Brick(numElements, n1, n2, n3, n4,
+				       n1+layer, n2+layer, n3+layer, n4+layer,
+				       theMaterial));
+      }
+    }
+  }
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new TrigSeries(1, 0.0, 1.0e10, 0.2, 0.0));
+  theDomain.addLoadPattern(thePattern);
+
+  Vector load(3);
+  load(0) = 1000.0;
+  for (int j = 0; j < numNodesY; j++) {
+    for (int i = 0; i < numNodesX; i++) {
+      int node = 1 + i + numNodesX*(j + numNodesY*numZ);
+      theDomain.addNodalLoad(new NodalLoad(node, node, load), 1);
+    }
+  }
+
+  theDomain.setRayleighDampingFactors(0.2, 0.0, 0.0, 0.002);
+
+  return numElements;
+}
@@ -0,0 +1,53 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/BenchModels.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the generators for the models used by
+// OpenSeesBench. All the models are deterministic so that results from
+// different builds and machines can be compared: a reinforced concrete
+// fiber section, a 3d moment frame of force-based fiber beam-columns and
+// a block of 8-node bricks. Both meshes are fixed at the base and carry
+// a sinusoidal lateral load on their top nodes in load pattern 1.
+
+#ifndef BenchModels_h
+#define BenchModels_h
+
+class Domain;
+class FiberSection3d;
+
+// square 0.5 x 0.5 section of Concrete02 fibers with 8 Steel02 bars;
+// the caller is responsible for deleting the section
+FiberSection3d *createBenchSection(int tag, int numFibersY, int numFibersZ);
+
+// numBaysX x numBaysY x numStories frame of ForceBeamColumn3d elements;
+// returns the number of elements added
+int createBenchFrame(Domain &theDomain, int numBaysX, int numBaysY,
+		     int numStories, int numFibersPerSide = 8);
+
+// numX x numY x numZ block of Brick elements; returns the number of
+// elements added
+int createBenchSolid(Domain &theDomain, int numX, int numY, int numZ);
+
+#endif
@@ -0,0 +1,228 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/BenchmarkRunner.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the implementation of BenchmarkRunner.
+
+#include "BenchmarkRunner.h"
+#include <OPS_Globals.h>
+#include <algorithm>
+#include <chrono>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+typedef std::chrono::steady_clock BenchmarkClock;
+
+static double
+timeCalls(const BenchmarkFunction &body, long numCalls)
+{
+  BenchmarkClock::time_point start = BenchmarkClock::now();
+  for (long i = 0; i < numCalls; i++)
+    body();
+  std::chrono::duration<double> elapsed = BenchmarkClock::now() - start;
+  return elapsed.count();
+}
+
+static void
+writeString(FILE *theFile, const std::string &s)
+{
+  fputc('"', theFile);
+  for (size_t i = 0; i < s.size(); i++) {
+    unsigned char c = s[i];
+    if (c == '"' || c == '\\')
+      fprintf(theFile, "\\%c", c);
+    else if (c < 0x20)
+      fprintf(theFile, "\\u%04x", c);
+    else
+      fputc(c, theFile);
+  }
+  fputc('"', theFile);
+}
+
+BenchmarkRunner::BenchmarkRunner(const char *theFilter, bool quick,
+				 int threads)
+  :filter(), numRepetitions(5), minTime(0.2), numThreads(threads), results()
+{
+  if (theFilter != 0)
+    filter = theFilter;
+
+  if (quick == true) {
+    numRepetitions = 2;
+    minTime = 0.01;
+  }
+}
+
+BenchmarkRunner::~BenchmarkRunner()
+{
+
+}
+
+bool
+BenchmarkRunner::isSelected(const char *name) const
+{
+  if (filter.empty())
+    return true;
+  return std::string(name).find(filter) != std::string::npos;
+}
+
+bool
+BenchmarkRunner::isQuick(void) const
+{
+  return numRepetitions < 5;
+}
+
+int
+BenchmarkRunner::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+int
+BenchmarkRunner::run(const char *name, const BenchmarkFunction &body,
+		     double itemsPerCall, const char *itemName)
+{
+  if (this->isSelected(name) == false)
+    return 0;
+
+  opserr << "OpenSeesBench: " << name << endln;
+
+  // warm up and grow the call count until one repetition takes minTime
+  long numCalls = 1;
+  double elapsed = timeCalls(body, numCalls);
+  while (elapsed < minTime && numCalls < 1000000000L) {
+    long next = numCalls * 10;
+    if (elapsed > 0.0) {
+      double estimate = 1.2 * minTime / elapsed * numCalls;
+      if (estimate < next)
+	next = (long)estimate + 1;
+    }
+    if (next <= numCalls)
+      next = numCalls + 1;
+    numCalls = next;
+    elapsed = timeCalls(body, numCalls);
+  }
+
+  std::vector<double> times(numRepetitions);
+  for (int i = 0; i < numRepetitions; i++)
+    times[i] = timeCalls(body, numCalls) / numCalls;
+
+  this->addResult(name, times, numCalls, itemsPerCall, itemName);
+  return 0;
+}
+
+int
+BenchmarkRunner::run(const char *name, const BenchmarkFunction &setup,
+		     const BenchmarkFunction &body,
+		     double itemsPerCall, const char *itemName)
+{
+  if (this->isSelected(name) == false)
+    return 0;
+
+  opserr << "OpenSeesBench: " << name << endln;
+
+  std::vector<double> times(numRepetitions);
+  for (int i = 0; i < numRepetitions; i++) {
+    setup();
+    times[i] = timeCalls(body, 1);
+  }
+
+  this->addResult(name, times, 1, itemsPerCall, itemName);
+  return 0;
+}
+
+void
+BenchmarkRunner::addResult(const char *name, std::vector<double> &times,
+			   long numCalls, double itemsPerCall,
+			   const char *itemName)
+{
+  Result theResult;
+  theResult.name = name;
+  theResult.itemName = itemName;
+  theResult.numRepetitions = (int)times.size();
+  theResult.numCalls = numCalls;
+  theResult.itemsPerCall = itemsPerCall;
+
+  std::sort(times.begin(), times.end());
+  int n = (int)times.size();
+  double sum = 0.0;
+  for (int i = 0; i < n; i++)
+    sum += times[i];
+  theResult.minTime = times[0];
+  theResult.meanTime = sum/n;
+  if (n % 2 == 1)
+    theResult.medianTime = times[n/2];
+  else
+    theResult.medianTime = 0.5*(times[n/2-1] + times[n/2]);
+
+  results.push_back(theResult);
+}
+
+int
+BenchmarkRunner::getNumResults(void) const
+{
+  return (int)results.size();
+}
+
+int
+BenchmarkRunner::writeJSON(FILE *theFile) const
+{
+  fprintf(theFile, "{\n  \"suite\": \"OpenSeesBench\",\n");
+  fprintf(theFile, "  \"version\": ");
+  writeString(theFile, OPS_VERSION);
+#ifdef __VERSION__
+  fprintf(theFile, ",\n  \"compiler\": ");
+  writeString(theFile, __VERSION__);
+#endif
+#ifdef _OPENMP
+  fprintf(theFile, ",\n  \"openmpThreads\": %d", omp_get_max_threads());
+#else
+  fprintf(theFile, ",\n  \"openmpThreads\": 0");
+#endif
+  fprintf(theFile, ",\n  \"domainThreads\": %d", numThreads);
+  fprintf(theFile, ",\n  \"quick\": %s", this->isQuick() ? "true" : "false");
+  fprintf(theFile, ",\n  \"benchmarks\": [");
+
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &r = results[i];
+    double itemsPerSecond = 0.0;
+    if (r.minTime > 0.0)
+      itemsPerSecond = r.itemsPerCall/r.minTime;
+
+    fprintf(theFile, "%s\n    {\"name\": ", i == 0 ? "" : ",");
+    writeString(theFile, r.name);
+    fprintf(theFile, ", \"repetitions\": %d, \"callsPerRepetition\": %ld,",
+	    r.numRepetitions, r.numCalls);
+    fprintf(theFile, "\n     \"minNs\": %.6g, \"medianNs\": %.6g, \"meanNs\": %.6g,",
+	    r.minTime*1.0e9, r.medianTime*1.0e9, r.meanTime*1.0e9);
+    fprintf(theFile, "\n     \"items\": %.6g, \"itemName\": ", r.itemsPerCall);
+    writeString(theFile, r.itemName);
+    fprintf(theFile, ", \"itemsPerSecond\": %.6g}", itemsPerSecond);
+  }
+
+  fprintf(theFile, "\n  ]\n}\n");
+  return 0;
+}
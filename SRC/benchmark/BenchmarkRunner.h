@@ -0,0 +1,87 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/BenchmarkRunner.h,v $
+
+// Written: 10/26
+//
+// Description: BenchmarkRunner times the cases of the OpenSeesBench
+// suite. A case without a setup function is called in a loop whose
+// length is calibrated so that one repetition runs for at least the
+// minimum time; a case with a setup function is set up afresh before
+// each repetition and timed once. For every case the minimum, median
+// and mean time per call over the repetitions are kept, together with
+// the number of work items per call, and written out as JSON.
+
+#ifndef BenchmarkRunner_h
+#define BenchmarkRunner_h
+
+#include <stdio.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+typedef std::function<void(void)> BenchmarkFunction;
+
+class BenchmarkRunner
+{
+  public:
+    BenchmarkRunner(const char *filter = 0, bool quick = false,
+		    int numThreads = 1);
+    ~BenchmarkRunner();
+
+    bool isSelected(const char *name) const;
+    bool isQuick(void) const;
+    int getNumThreads(void) const;   // threads handed to each Domain
+
+    int run(const char *name, const BenchmarkFunction &body,
+	    double itemsPerCall, const char *itemName);
+    int run(const char *name, const BenchmarkFunction &setup,
+	    const BenchmarkFunction &body,
+	    double itemsPerCall, const char *itemName);
+
+    int getNumResults(void) const;
+    int writeJSON(FILE *theFile) const;
+
+  private:
+    struct Result {
+      std::string name;
+      std::string itemName;
+      int numRepetitions;
+      long numCalls;        // calls per repetition
+      double minTime;       // seconds per call
+      double medianTime;
+      double meanTime;
+      double itemsPerCall;
+    };
+
+    void addResult(const char *name, std::vector<double> &times,
+		   long numCalls, double itemsPerCall, const char *itemName);
+
+    std::string filter;
+    int numRepetitions;
+    double minTime;         // minimum seconds per repetition
+    int numThreads;
+    std::vector<Result> results;
+};
+
+#endif
@@ -0,0 +1,198 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/ComponentBench.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the state determination cases of
+// OpenSeesBench: FiberSection3d, a single ForceBeamColumn3d and the
+// Domain update and commit of the frame model. The trial state is
+// alternated between two deformed configurations so that every call
+// does the full work of a Newton iteration; nothing is committed, so
+// each call starts from the same committed state.
+
+#include "OpenSeesBench.h"
+#include "BenchmarkRunner.h"
+#include "BenchModels.h"
+
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <SP_Constraint.h>
+#include <stdio.h>
+#include <vector>
+
+#include <FiberSection3d.h>
+#include <ForceBeamColumn3d.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearCrdTransf3d.h>
+
+void
+benchSection(BenchmarkRunner &theRunner)
+{
+  static const int sizes[] = {4, 8, 16};
+  char name[80];
+
+  for (int k = 0; k < 3; k++) {
+    int n = sizes[k];
+    int numFibers = n*n + 8;
+    snprintf(name, 80, "FiberSection3d/update/%d", numFibers);
+    if (theRunner.isSelected(name) == false)
+      continue;
+
+    FiberSection3d *theSection = createBenchSection(1, n, n);
+
+    Vector deformations[2];
+    for (int i = 0; i < 2; i++)
+      deformations[i] = Vector(4);
+    deformations[0](0) = -0.0005;
+    deformations[0](1) = 0.004;
+    deformations[0](2) = 0.002;
+    deformations[0](3) = 0.0001;
+    deformations[1](0) = -0.0002;
+    deformations[1](1) = -0.001;
+    deformations[1](2) = 0.003;
+
+    int phase = 0;
+    theRunner.run(name, [&]() {
+	theSection->setTrialSectionDeformation(deformations[phase]);
+	theSection->getStressResultant();
+	theSection->getSectionTangent();
+	phase = 1 - phase;
+      }, numFibers, "fiber");
+
+    delete theSection;
+  }
+}
+
+void
+benchElement(BenchmarkRunner &theRunner)
+{
+  static const int sizes[] = {4, 8};
+  char name[80];
+
+  for (int k = 0; k < 2; k++) {
+    int n = sizes[k];
+    snprintf(name, 80, "ForceBeamColumn3d/update/%d", n*n + 8);
+    if (theRunner.isSelected(name) == false)
+      continue;
+
+    Domain theDomain;
+    Node *theNode = new Node(2, 6, 0.0, 0.0, 3.0);
+    theDomain.addNode(new Node(1, 6, 0.0, 0.0, 0.0));
+    theDomain.addNode(theNode);
+    for (int dof = 0; dof < 6; dof++)
+      theDomain.addSP_Constraint(new SP_Constraint(1, dof, 0.0, true));
+
+    const int numSections = 5;
+    FiberSection3d *theSection = createBenchSection(1, n, n);
+    SectionForceDeformation *theSections[numSections];
+    for (int i = 0; i < numSections; i++)
+      theSections[i] = theSection;
+    LobattoBeamIntegration theIntegration;
+    Vector vecXZ(3);
+    vecXZ(0) = 1.0;
+    LinearCrdTransf3d theTransf(1, vecXZ);
+
+    ForceBeamColumn3d *theElement =
+      new ForceBeamColumn3d(1, 1, 2, numSections, theSections, theIntegration, theTransf);
+    theDomain.addElement(theElement);
+    delete theSection;
+
+    Vector displacements[2];
+    for (int i = 0; i < 2; i++)
+      displacements[i] = Vector(6);
+    displacements[0](0) = 0.005;
+    displacements[0](1) = 0.002;
+    displacements[0](2) = -0.0005;
+    displacements[0](4) = 0.001;
+    displacements[0](5) = 0.0005;
+    displacements[1](0) = 0.002;
+    displacements[1](1) = -0.001;
+    displacements[1](2) = -0.0002;
+    displacements[1](3) = 0.0004;
+
+    int phase = 0;
+    theRunner.run(name, [&]() {
+	theNode->setTrialDisp(displacements[phase]);
+	theElement->update();
+	theElement->getResistingForce();
+	theElement->getTangentStiff();
+	phase = 1 - phase;
+      }, 1, "element");
+  }
+}
+
+void
+benchDomain(BenchmarkRunner &theRunner)
+{
+  if (theRunner.isSelected("Domain/update/frame") == false &&
+      theRunner.isSelected("Domain/commit/frame") == false)
+    return;
+
+  Domain theDomain;
+  theDomain.setNumThreads(theRunner.getNumThreads());
+  int numStories = theRunner.isQuick() ? 3 : 10;
+  int numElements = createBenchFrame(theDomain, 4, 4, numStories);
+  double height = 3.0*numStories;
+
+  // two lateral drift profiles, applied to all nodes above the base
+  std::vector<Node *> theNodes;
+  std::vector<Vector> displacements[2];
+  NodeIter &theIter = theDomain.getNodes();
+  Node *theNode;
+  while ((theNode = theIter()) != 0) {
+    double z = theNode->getCrds()(2);
+    if (z <= 0.0)
+      continue;
+    Vector u(6);
+    theNodes.push_back(theNode);
+    u(0) = 0.01*z/height;
+    u(1) = 0.002*z/height;
+    u(5) = 0.0002*z/height;
+    displacements[0].push_back(u);
+    u(0) = 0.004*z/height;
+    u(1) = -0.003*z/height;
+    u(5) = 0.0;
+    displacements[1].push_back(u);
+  }
+  int numNodes = (int)theNodes.size();
+
+  int phase = 0;
+  theRunner.run("Domain/update/frame", [&]() {
+      for (int i = 0; i < numNodes; i++)
+	theNodes[i]->setTrialDisp(displacements[phase][i]);
+      theDomain.update();
+      phase = 1 - phase;
+    }, numElements, "element");
+
+  for (int i = 0; i < numNodes; i++)
+    theNodes[i]->setTrialDisp(displacements[0][i]);
+  theDomain.update();
+
+  theRunner.run("Domain/commit/frame", [&]() {
+      theDomain.commit();
+    }, numElements, "element");
+}
@@ -0,0 +1,195 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/LinearSOEBench.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the LinearSOE assembly cases of
+// OpenSeesBench. For each system of equations the frame and solid
+// models are numbered and sized as for an analysis, the element
+// tangents are formed once and stored, and the case times zeroA()
+// followed by addA() of every stored element matrix. The items reported
+// are element matrices assembled.
+
+#include "OpenSeesBench.h"
+#include "BenchmarkRunner.h"
+#include "BenchModels.h"
+
+#include <Domain.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <stdio.h>
+#include <vector>
+
+#include <StaticAnalysis.h>
+#include <AnalysisModel.h>
+#include <FE_EleIter.h>
+#include <FE_Element.h>
+#include <Linear.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <LoadControl.h>
+
+#include <FullGenLinSOE.h>
+#include <FullGenLinLapackSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+
+static LinearSOE *
+createFullGen(void)
+{
+  FullGenLinLapackSolver *theSolver = new FullGenLinLapackSolver();
+  return new FullGenLinSOE(*theSolver);
+}
+
+static LinearSOE *
+createBandGen(void)
+{
+  BandGenLinLapackSolver *theSolver = new BandGenLinLapackSolver();
+  return new BandGenLinSOE(*theSolver);
+}
+
+static LinearSOE *
+createBandSPD(void)
+{
+  BandSPDLinLapackSolver *theSolver = new BandSPDLinLapackSolver();
+  return new BandSPDLinSOE(*theSolver);
+}
+
+static LinearSOE *
+createProfileSPD(void)
+{
+  ProfileSPDLinDirectSolver *theSolver = new ProfileSPDLinDirectSolver();
+  return new ProfileSPDLinSOE(*theSolver);
+}
+
+static LinearSOE *
+createSparseGen(void)
+{
+  SuperLU *theSolver = new SuperLU();
+  return new SparseGenColLinSOE(*theSolver);
+}
+
+static LinearSOE *
+createUmfpack(void)
+{
+  UmfpackGenLinSolver *theSolver = new UmfpackGenLinSolver();
+  return new UmfpackGenLinSOE(*theSolver);
+}
+
+static LinearSOE *
+createSparseSPD(void)
+{
+  SymSparseLinSolver *theSolver = new SymSparseLinSolver();
+  return new SymSparseLinSOE(*theSolver, 1);
+}
+
+struct BenchSOE {
+  const char *name;
+  LinearSOE *(*create)(void);
+};
+
+static const BenchSOE theSOEs[] = {
+  {"FullGeneral", createFullGen},
+  {"BandGeneral", createBandGen},
+  {"BandSPD", createBandSPD},
+  {"ProfileSPD", createProfileSPD},
+  {"SparseGeneral", createSparseGen},
+  {"Umfpack", createUmfpack},
+  {"SparseSPD", createSparseSPD}
+};
+
+static void
+benchAddA(BenchmarkRunner &theRunner, const BenchSOE &theType, bool solid)
+{
+  char name[80];
+  snprintf(name, 80, "LinearSOE/addA/%s/%s", theType.name, solid ? "solid" : "frame");
+  if (theRunner.isSelected(name) == false)
+    return;
+
+  Domain theDomain;
+  if (solid == true)
+    createBenchSolid(theDomain, 6, 6, 6);
+  else
+    createBenchFrame(theDomain, 3, 3, 3);
+
+  AnalysisModel *theModel = new AnalysisModel();
+  EquiSolnAlgo *theAlgorithm = new Linear();
+  ConstraintHandler *theHandler = new PlainHandler();
+  RCM *theRCM = new RCM();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*theRCM);
+  StaticIntegrator *theIntegrator = new LoadControl(0.0, 1, 0.0, 0.0);
+  LinearSOE *theSOE = theType.create();
+
+  StaticAnalysis *theAnalysis = new StaticAnalysis(theDomain, *theHandler, *theNumberer,
+						   *theModel, *theAlgorithm,
+						   *theSOE, *theIntegrator);
+  if (theAnalysis->domainChanged() < 0) {
+    opserr << "OpenSeesBench - " << name << " failed to set up the analysis\n";
+    theAnalysis->clearAll();
+    delete theAnalysis;
+    return;
+  }
+
+  // form the element tangents once; FE_Element returns a shared
+  // workspace so each one is copied
+  std::vector<Matrix> theTangents;
+  std::vector<ID> theIDs;
+  FE_EleIter &theFEs = theModel->getFEs();
+  FE_Element *theFE;
+  while ((theFE = theFEs()) != 0) {
+    theTangents.push_back(theFE->getTangent(theIntegrator));
+    theIDs.push_back(theFE->getID());
+  }
+
+  int numFEs = (int)theTangents.size();
+  theRunner.run(name, [&]() {
+      theSOE->zeroA();
+      for (int i = 0; i < numFEs; i++)
+	theSOE->addA(theTangents[i], theIDs[i]);
+    }, numFEs, "elementMatrix");
+
+  theAnalysis->clearAll();
+  delete theAnalysis;
+}
+
+void
+benchLinearSOE(BenchmarkRunner &theRunner)
+{
+  int numSOEs = sizeof(theSOEs)/sizeof(BenchSOE);
+  for (int i = 0; i < numSOEs; i++) {
+    benchAddA(theRunner, theSOEs[i], false);
+    benchAddA(theRunner, theSOEs[i], true);
+  }
+}
@@ -0,0 +1,137 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/MatrixBench.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the Vector and Matrix kernel cases of
+// OpenSeesBench, run at the sizes typical of element computations. The
+// items reported are floating point operations.
+
+#include "OpenSeesBench.h"
+#include "BenchmarkRunner.h"
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <stdio.h>
+
+// deterministic fill values in [-1,1)
+static double
+benchValue(unsigned int &seed)
+{
+  seed = seed*1664525u + 1013904223u;
+  return (seed >> 8)*(2.0/16777216.0) - 1.0;
+}
+
+static void
+fillMatrix(Matrix &A, unsigned int seed, bool diagonallyDominant = false)
+{
+  int n = A.noRows();
+  for (int j = 0; j < A.noCols(); j++)
+    for (int i = 0; i < n; i++)
+      A(i,j) = benchValue(seed);
+  if (diagonallyDominant == true)
+    for (int i = 0; i < n; i++)
+      A(i,i) += n;
+}
+
+static void
+fillVector(Vector &v, unsigned int seed)
+{
+  for (int i = 0; i < v.Size(); i++)
+    v(i) = benchValue(seed);
+}
+
+void
+benchMatrix(BenchmarkRunner &theRunner)
+{
+  static const int sizes[] = {6, 12, 24};
+  char name[80];
+
+  for (int k = 0; k < 3; k++) {
+    int n = sizes[k];
+    double dn = n;
+
+    Matrix A(n,n), B(n,n), C(n,n);
+    Vector x(n), y(n);
+    fillMatrix(A, 1);
+    fillMatrix(B, 2);
+    fillVector(x, 3);
+
+    snprintf(name, 80, "Matrix/addMatrixVector/%d", n);
+    theRunner.run(name, [&]() {
+	y.addMatrixVector(0.0, A, x, 1.0);
+      }, 2.0*dn*dn, "flop");
+
+    snprintf(name, 80, "Matrix/addMatrixTransposeVector/%d", n);
+    theRunner.run(name, [&]() {
+	y.addMatrixTransposeVector(0.0, A, x, 1.0);
+      }, 2.0*dn*dn, "flop");
+
+    snprintf(name, 80, "Matrix/addMatrix/%d", n);
+    theRunner.run(name, [&]() {
+	C.addMatrix(0.5, A, 1.0);
+      }, 2.0*dn*dn, "flop");
+
+    snprintf(name, 80, "Matrix/addMatrixProduct/%d", n);
+    theRunner.run(name, [&]() {
+	C.addMatrixProduct(0.0, A, B, 1.0);
+      }, 2.0*dn*dn*dn, "flop");
+
+    snprintf(name, 80, "Matrix/addMatrixTransposeProduct/%d", n);
+    theRunner.run(name, [&]() {
+	C.addMatrixTransposeProduct(0.0, A, B, 1.0);
+      }, 2.0*dn*dn*dn, "flop");
+
+    snprintf(name, 80, "Matrix/addMatrixTripleProduct/%d", n);
+    theRunner.run(name, [&]() {
+	C.addMatrixTripleProduct(0.0, A, B, 1.0);
+      }, 4.0*dn*dn*dn, "flop");
+
+    Matrix S(n,n);
+    fillMatrix(S, 4, true);
+    snprintf(name, 80, "Matrix/Solve/%d", n);
+    theRunner.run(name, [&]() {
+	S.Solve(x, y);
+      }, 2.0*dn*dn*dn/3.0 + 2.0*dn*dn, "flop");
+  }
+
+  static const int lengths[] = {100, 10000};
+  for (int k = 0; k < 2; k++) {
+    int n = lengths[k];
+    Vector a(n), b(n);
+    fillVector(a, 5);
+    fillVector(b, 6);
+
+    snprintf(name, 80, "Vector/addVector/%d", n);
+    theRunner.run(name, [&]() {
+	a.addVector(1.0, b, 1.0e-3);
+      }, 2.0*n, "flop");
+
+    snprintf(name, 80, "Vector/dot/%d", n);
+    double sum = 0.0;
+    theRunner.run(name, [&]() {
+	sum += a^b;
+      }, 2.0*n, "flop");
+  }
+}
@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/OpenSeesBench.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the main program of OpenSeesBench, the
+// micro and macro benchmark suite. It is run as
+//
+//   OpenSeesBench <-o file.json> <-filter substring> <-threads n> <-quick>
+//
+// and writes the timings of the selected cases as JSON to the file, or
+// to stdout if no file is given. Progress is written to opserr. The
+// -quick option cuts the repetitions and model sizes to give a fast
+// smoke run; its numbers should not be compared with full runs.
+
+#include "OpenSeesBench.h"
+#include "BenchmarkRunner.h"
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+int main(int argc, char **argv)
+{
+  const char *fileName = 0;
+  const char *filter = 0;
+  bool quick = false;
+  int numThreads = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i+1 < argc)
+      fileName = argv[++i];
+    else if (strcmp(argv[i], "-filter") == 0 && i+1 < argc)
+      filter = argv[++i];
+    else if (strcmp(argv[i], "-threads") == 0 && i+1 < argc)
+      numThreads = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-quick") == 0)
+      quick = true;
+    else {
+      opserr << "usage: OpenSeesBench <-o file.json> <-filter substring> <-threads n> <-quick>\n";
+      return -1;
+    }
+  }
+
+  if (numThreads < 1)
+    numThreads = 1;
+
+  BenchmarkRunner theRunner(filter, quick, numThreads);
+
+  benchMatrix(theRunner);
+  benchLinearSOE(theRunner);
+  benchSection(theRunner);
+  benchElement(theRunner);
+  benchDomain(theRunner);
+  benchAnalysis(theRunner);
+
+  FILE *theFile = stdout;
+  if (fileName != 0) {
+    theFile = fopen(fileName, "w");
+    if (theFile == 0) {
+      opserr << "OpenSeesBench - could not open file: " << fileName << endln;
+      return -1;
+    }
+  }
+
+  theRunner.writeJSON(theFile);
+
+  if (theFile != stdout)
+    fclose(theFile);
+
+  opserr << "OpenSeesBench - " << theRunner.getNumResults() << " cases run\n";
+  return 0;
+}
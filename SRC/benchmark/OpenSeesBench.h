@@ -0,0 +1,44 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/benchmark/OpenSeesBench.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the declarations of the suites run by
+// OpenSeesBench. Each suite adds its cases to the BenchmarkRunner; case
+// names are of the form group/operation/variant so that a subset can be
+// picked with the -filter option.
+
+#ifndef OpenSeesBench_h
+#define OpenSeesBench_h
+
+class BenchmarkRunner;
+
+void benchMatrix(BenchmarkRunner &theRunner);     // Vector and Matrix kernels
+void benchLinearSOE(BenchmarkRunner &theRunner);  // addA for each LinearSOE
+void benchSection(BenchmarkRunner &theRunner);    // FiberSection3d state update
+void benchElement(BenchmarkRunner &theRunner);    // ForceBeamColumn3d update
+void benchDomain(BenchmarkRunner &theRunner);     // Domain update and commit
+void benchAnalysis(BenchmarkRunner &theRunner);   // end-to-end transient runs
+
+#endif
@@ -57,6 +57,11 @@ public:
 
     virtual CrdTransf *getCopy2d(void) {return 0;};
     virtual CrdTransf *getCopy3d(void) {return 0;};
+
+    // true if different objects of the class may be used at the same
+    // time from different threads, i.e. the class keeps no shared scratch
+    virtual bool isThreadSafe(void) {return false;};
+
   virtual int getLocalAxes(Vector &xAxis, Vector &yAxis, Vector &zAxis);
   virtual int getRigidOffsets(Vector &offsets);
   
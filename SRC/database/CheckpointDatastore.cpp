@@ -0,0 +1,681 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/database/CheckpointDatastore.cpp,v $
+                                                                        
+                                                                        
+// Written: 10/26
+//
+// Description: This file contains the class implementation for 
+// CheckpointDatastore. CheckpointDatastore is a concrete subclass of
+// FE_Datastore. A CheckpointDatastore object is used in the program to
+// store/restore the geometry and state information in a domain, together
+// with the integrator and algorithm, in a single append-only binary file.
+//
+// What: "@(#) CheckpointDatastore.cpp, revA"
+
+#include "CheckpointDatastore.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+
+#include <elementAPI.h>
+#include <FEM_ObjectBroker.h>
+#include <Domain.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <Message.h>
+#include <EquiSolnAlgo.h>
+#include <StaticIntegrator.h>
+#include <TransientIntegrator.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define CHECKPOINT_SEEK _fseeki64
+#define CHECKPOINT_TELL _ftelli64
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#define CHECKPOINT_SEEK fseeko
+#define CHECKPOINT_TELL ftello
+#endif
+
+// the layout of the file, all sizes are multiples of 8 bytes
+typedef struct checkpointFileHeader {
+  char magic[8];
+  int version;
+  int byteOrder;
+} CheckpointFileHeader;
+
+typedef struct checkpointRecordHeader {
+  int magic;
+  int commitTag;
+  long long numEntries;
+  long long dataBytes;
+  long long numBytes;
+} CheckpointRecordHeader;
+
+typedef struct checkpointRecordTrailer {
+  int magic;
+  int commitTag;
+  long long numBytes;
+} CheckpointRecordTrailer;
+
+static const char fileMagic[8] = {'O','P','S','C','K','P','T','\0'};
+static const int  fileVersion = 1;
+static const int  fileByteOrder = 0x01020304;
+static const int  recordMagic = 0x54504b43;   // "CKPT"
+static const int  trailerMagic = 0x434b5054;  // "TPKC"
+
+enum { MSG_DATA = 1, MATRIX_DATA = 2, VECTOR_DATA = 3, ID_DATA = 4 };
+
+// dbTag under which the integrator and algorithm tags of a commit are
+// stored; the dbTags handed out by FE_Datastore are all positive and
+// the Domain uses 0
+static const int analysisDbTag = -1;
+
+static inline long long
+paddedSize(long long numBytes)
+{
+  return (numBytes + 7) & ~((long long)7);
+}
+
+static bool
+entryLess(const CheckpointEntry &a, const CheckpointEntry &b)
+{
+  if (a.dbTag != b.dbTag) return a.dbTag < b.dbTag;
+  if (a.commitTag != b.commitTag) return a.commitTag < b.commitTag;
+  if (a.type != b.type) return a.type < b.type;
+  return a.size < b.size;
+}
+
+
+CheckpointDatastore::CheckpointDatastore(const char *name,
+					 Domain &domain, 
+					 FEM_ObjectBroker &theObjBroker) 
+  :FE_Datastore(domain, theObjBroker), 
+   fileName(0), theFile(0), fileEnd(0), theDomain(&domain), lastRecord(-1),
+   data(0), sizeData(0), numData(0), mapData(0), mapSize(0)
+{
+  fileName = new char [strlen(name)+1];
+  strcpy(fileName, name);
+
+  if (this->openFile() < 0) {
+    opserr << "WARNING CheckpointDatastore::CheckpointDatastore() - could not open file ";
+    opserr << fileName << endln;
+    if (theFile != 0)
+      fclose(theFile);
+    theFile = 0;
+  }
+}
+
+CheckpointDatastore::~CheckpointDatastore() 
+{
+  this->unmapFile();
+
+  if (theFile != 0)
+    fclose(theFile);
+
+  if (fileName != 0)
+    delete [] fileName;
+  
+  if (data != 0)
+    delete [] data;
+}
+
+
+int
+CheckpointDatastore::openFile(void)
+{
+  // open an existing file to append to it, else create a new one
+  theFile = fopen(fileName, "r+b");
+  if (theFile == 0) {
+    theFile = fopen(fileName, "w+b");
+    if (theFile == 0)
+      return -1;
+
+    CheckpointFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.byteOrder = fileByteOrder;
+    if (fwrite(&header, sizeof(header), 1, theFile) != 1)
+      return -1;
+    fflush(theFile);
+    fileEnd = sizeof(header);
+    return 0;
+  }
+
+  CheckpointFileHeader header;
+  if (fread(&header, sizeof(header), 1, theFile) != 1 ||
+      memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0 ||
+      header.version != fileVersion || header.byteOrder != fileByteOrder) {
+    opserr << "WARNING CheckpointDatastore - " << fileName;
+    opserr << " is not a checkpoint file written on this type of machine\n";
+    return -1;
+  }
+
+  CHECKPOINT_SEEK(theFile, 0, SEEK_END);
+  long long fileSize = CHECKPOINT_TELL(theFile);
+
+  // walk the records, stopping at the first one not completely written
+  long long pos = sizeof(header);
+  while (pos + (long long)sizeof(CheckpointRecordHeader) <= fileSize) {
+    CheckpointRecordHeader recHeader;
+    CheckpointRecordTrailer recTrailer;
+    CHECKPOINT_SEEK(theFile, pos, SEEK_SET);
+    if (fread(&recHeader, sizeof(recHeader), 1, theFile) != 1 ||
+	recHeader.magic != recordMagic ||
+	recHeader.numBytes < (long long)(sizeof(recHeader) + sizeof(recTrailer)) ||
+	pos + recHeader.numBytes > fileSize)
+      break;
+
+    CHECKPOINT_SEEK(theFile, pos + recHeader.numBytes - sizeof(recTrailer), SEEK_SET);
+    if (fread(&recTrailer, sizeof(recTrailer), 1, theFile) != 1 ||
+	recTrailer.magic != trailerMagic ||
+	recTrailer.commitTag != recHeader.commitTag ||
+	recTrailer.numBytes != recHeader.numBytes)
+      break;
+
+    CheckpointRecord theRecord;
+    theRecord.commitTag = recHeader.commitTag;
+    theRecord.offset = pos;
+    theRecord.numEntries = recHeader.numEntries;
+    theRecord.numBytes = recHeader.numBytes;
+    records.push_back(theRecord);
+
+    pos += recHeader.numBytes;
+  }
+  fileEnd = pos;
+
+  // drop a record left incomplete by a run that was interrupted
+  if (fileEnd < fileSize) {
+    opserr << "WARNING CheckpointDatastore - ignoring an incomplete record at the end of ";
+    opserr << fileName << endln;
+    fflush(theFile);
+#ifdef _WIN32
+    _chsize_s(_fileno(theFile), fileEnd);
+#else
+    if (ftruncate(fileno(theFile), fileEnd) != 0)
+      opserr << "WARNING CheckpointDatastore - could not truncate " << fileName << endln;
+#endif
+  }
+
+  return 0;
+}
+
+
+int 
+CheckpointDatastore::commitState(int commitTag)
+{
+  if (theFile == 0) {
+    opserr << "CheckpointDatastore::commitState() - no file open\n";
+    return -1;
+  }
+
+  // gather everything in memory: the analysis objects are sent first so
+  // the lastDbTag stored by FE_Datastore covers the dbTags they are given
+  this->sendAnalysis(commitTag);
+
+  int result = FE_Datastore::commitState(commitTag);
+  if (result < 0) {
+    entries.clear();
+    numData = 0;
+    return result;
+  }
+
+  // sort the index, keeping the last of any data sent twice under a key
+  std::stable_sort(entries.begin(), entries.end(), entryLess);
+  int numEntries = 0;
+  for (int i=0; i<(int)entries.size(); i++) {
+    if (i+1 < (int)entries.size() && !entryLess(entries[i], entries[i+1]))
+      continue;
+    entries[numEntries++] = entries[i];
+  }
+  entries.resize(numEntries);
+
+  CheckpointRecordHeader recHeader;
+  recHeader.magic = recordMagic;
+  recHeader.commitTag = commitTag;
+  recHeader.numEntries = numEntries;
+  recHeader.dataBytes = numData;
+  recHeader.numBytes = sizeof(CheckpointRecordHeader) + numEntries*sizeof(CheckpointEntry)
+    + numData + sizeof(CheckpointRecordTrailer);
+
+  CheckpointRecordTrailer recTrailer;
+  recTrailer.magic = trailerMagic;
+  recTrailer.commitTag = commitTag;
+  recTrailer.numBytes = recHeader.numBytes;
+
+  // append the record; the trailer goes last so a record cut short by a
+  // crash is recognized when the file is reopened
+  CHECKPOINT_SEEK(theFile, fileEnd, SEEK_SET);
+  bool ok = fwrite(&recHeader, sizeof(recHeader), 1, theFile) == 1;
+  if (ok && numEntries != 0)
+    ok = fwrite(&entries[0], sizeof(CheckpointEntry), numEntries, theFile) == (size_t)numEntries;
+  if (ok && numData != 0)
+    ok = fwrite(data, 1, numData, theFile) == (size_t)numData;
+  if (ok)
+    ok = fwrite(&recTrailer, sizeof(recTrailer), 1, theFile) == 1;
+  if (ok)
+    ok = fflush(theFile) == 0;
+
+  entries.clear();
+  numData = 0;
+
+  if (!ok) {
+    opserr << "CheckpointDatastore::commitState() - failed to write commitTag ";
+    opserr << commitTag << " to " << fileName << endln;
+    return -1;
+  }
+
+  CheckpointRecord theRecord;
+  theRecord.commitTag = commitTag;
+  theRecord.offset = fileEnd;
+  theRecord.numEntries = numEntries;
+  theRecord.numBytes = recHeader.numBytes;
+  records.push_back(theRecord);
+  fileEnd += recHeader.numBytes;
+
+  return result;
+}
+
+
+int
+CheckpointDatastore::restoreState(int commitTag)
+{
+  if (theFile == 0) {
+    opserr << "CheckpointDatastore::restoreState() - no file open\n";
+    return -1;
+  }
+
+  // start the lookups in the newest record of this commit
+  lastRecord = -1;
+  for (int i=(int)records.size()-1; i>=0 && lastRecord<0; i--)
+    if (records[i].commitTag == commitTag)
+      lastRecord = i;
+
+  if (lastRecord < 0) {
+    opserr << "CheckpointDatastore::restoreState() - no checkpoint with commitTag ";
+    opserr << commitTag << " in " << fileName << endln;
+    return -1;
+  }
+
+  int result = FE_Datastore::restoreState(commitTag);
+  if (result < 0)
+    return result;
+
+  this->recvAnalysis(commitTag);
+
+  // the integrator still holds the response it last computed; flag the
+  // domain as changed so the analysis sets up again from the restored
+  // nodal response at the next step
+  theDomain->domainChange();
+
+  return result;
+}
+
+
+int
+CheckpointDatastore::sendAnalysis(int commitTag)
+{
+  MovableObject *theObjects[3] = {0, 0, 0};
+
+  TransientIntegrator **theTransientIntegrator = OPS_GetTransientIntegrator();
+  StaticIntegrator **theStaticIntegrator = OPS_GetStaticIntegrator();
+  EquiSolnAlgo **theAlgorithm = OPS_GetAlgorithm();
+  if (theTransientIntegrator != 0) theObjects[0] = *theTransientIntegrator;
+  if (theStaticIntegrator != 0) theObjects[1] = *theStaticIntegrator;
+  if (theAlgorithm != 0) theObjects[2] = *theAlgorithm;
+
+  ID analysisData(6);
+  for (int i=0; i<3; i++) {
+    MovableObject *theObject = theObjects[i];
+    if (theObject == 0)
+      continue;
+
+    if (theObject->getDbTag() == 0)
+      theObject->setDbTag(this->getDbTag());
+
+    if (theObject->sendSelf(commitTag, *this) < 0) {
+      opserr << "WARNING CheckpointDatastore::commitState() - object with classTag ";
+      opserr << theObject->getClassTag() << " failed in sendSelf, only its Domain state is saved\n";
+      continue;
+    }
+
+    analysisData(2*i) = theObject->getClassTag();
+    analysisData(2*i+1) = theObject->getDbTag();
+  }
+
+  return this->sendID(analysisDbTag, commitTag, analysisData);
+}
+
+
+int
+CheckpointDatastore::recvAnalysis(int commitTag)
+{
+  ID analysisData(6);
+  if (this->recvID(analysisDbTag, commitTag, analysisData) < 0)
+    return -1;
+
+  MovableObject *theObjects[3] = {0, 0, 0};
+
+  TransientIntegrator **theTransientIntegrator = OPS_GetTransientIntegrator();
+  StaticIntegrator **theStaticIntegrator = OPS_GetStaticIntegrator();
+  EquiSolnAlgo **theAlgorithm = OPS_GetAlgorithm();
+  if (theTransientIntegrator != 0) theObjects[0] = *theTransientIntegrator;
+  if (theStaticIntegrator != 0) theObjects[1] = *theStaticIntegrator;
+  if (theAlgorithm != 0) theObjects[2] = *theAlgorithm;
+
+  // only objects of the class saved can be brought back, any other
+  // integrator or algorithm now in use keeps its own settings
+  int result = 0;
+  for (int i=0; i<3; i++) {
+    MovableObject *theObject = theObjects[i];
+    if (theObject == 0 || analysisData(2*i) == 0 || 
+	theObject->getClassTag() != analysisData(2*i))
+      continue;
+
+    theObject->setDbTag(analysisData(2*i+1));
+    if (theObject->recvSelf(commitTag, *this, *(this->getObjectBroker())) < 0) {
+      opserr << "WARNING CheckpointDatastore::restoreState() - object with classTag ";
+      opserr << theObject->getClassTag() << " failed in recvSelf\n";
+      result = -1;
+    }
+  }
+
+  return result;
+}
+
+
+char *
+CheckpointDatastore::putData(int dbTag, int commitTag, int type, int size, long long numBytes)
+{
+  long long paddedBytes = paddedSize(numBytes);
+
+  if (numData + paddedBytes > sizeData) {
+    long long newSize = 2*sizeData;
+    if (newSize < 1048576)
+      newSize = 1048576;
+    while (newSize < numData + paddedBytes)
+      newSize *= 2;
+
+    char *newData = new char[newSize];
+    if (newData == 0) {
+      opserr << "CheckpointDatastore - out of memory gathering commit data\n";
+      return 0;
+    }
+    if (numData != 0)
+      memcpy(newData, data, numData);
+    if (data != 0)
+      delete [] data;
+    data = newData;
+    sizeData = newSize;
+  }
+
+  CheckpointEntry theEntry;
+  theEntry.dbTag = dbTag;
+  theEntry.commitTag = commitTag;
+  theEntry.type = type;
+  theEntry.size = size;
+  theEntry.offset = numData;
+  theEntry.numBytes = numBytes;
+  entries.push_back(theEntry);
+
+  char *result = data + numData;
+  if (paddedBytes != numBytes)
+    memset(result + numBytes, 0, paddedBytes - numBytes);
+  numData += paddedBytes;
+
+  return result;
+}
+
+
+const char *
+CheckpointDatastore::getData(int dbTag, int commitTag, int type, int size, 
+			     const char *method, int *sizeFound)
+{
+  CheckpointEntry key;
+  key.dbTag = dbTag;
+  key.commitTag = commitTag;
+  key.type = type;
+  key.size = size;    // size < 0 matches any size
+
+  int numRecords = records.size();
+  for (int i=-1; i<numRecords; i++) {
+
+    // first the record of the last hit, then the rest newest first
+    int record;
+    if (i < 0)
+      record = lastRecord;
+    else {
+      record = numRecords-1-i;
+      if (record == lastRecord)
+	continue;
+    }
+    if (record < 0 || record >= numRecords)
+      continue;
+
+    const char *theRecord = this->mapRecord(record);
+    if (theRecord == 0)
+      return 0;
+
+    const CheckpointEntry *first = 
+      (const CheckpointEntry *)(theRecord + sizeof(CheckpointRecordHeader));
+    const CheckpointEntry *last = first + records[record].numEntries;
+    const CheckpointEntry *theEntry = std::lower_bound(first, last, key, entryLess);
+
+    if (theEntry != last && theEntry->dbTag == dbTag && theEntry->commitTag == commitTag &&
+	theEntry->type == type && (size < 0 || theEntry->size == size)) {
+      lastRecord = record;
+      if (sizeFound != 0)
+	*sizeFound = theEntry->size;
+      return (const char *)last + theEntry->offset;
+    }
+  }
+
+  opserr << "CheckpointDatastore::" << method << "() - no data for dbTag " << dbTag;
+  opserr << " commitTag " << commitTag << " of size " << size << endln;
+  return 0;
+}
+
+
+const char *
+CheckpointDatastore::mapRecord(int record)
+{
+  const CheckpointRecord &theRecord = records[record];
+
+#ifndef _WIN32
+  // map the whole file, again only if it has grown past the mapping
+  if (mapData == 0 || theRecord.offset + theRecord.numBytes > mapSize) {
+    this->unmapFile();
+    void *theMap = mmap(0, fileEnd, PROT_READ|PROT_WRITE, MAP_PRIVATE, fileno(theFile), 0);
+    if (theMap == MAP_FAILED) {
+      opserr << "CheckpointDatastore - could not map " << fileName << endln;
+      return 0;
+    }
+    mapData = (char *)theMap;
+    mapSize = fileEnd;
+  }
+  return mapData + theRecord.offset;
+#else
+  // no mmap(), read each record once as it is needed
+  if (recordData.size() < records.size())
+    recordData.resize(records.size(), (char *)0);
+
+  if (recordData[record] == 0) {
+    char *theData = new char[theRecord.numBytes];
+    if (theData == 0) {
+      opserr << "CheckpointDatastore - out of memory reading " << fileName << endln;
+      return 0;
+    }
+    CHECKPOINT_SEEK(theFile, theRecord.offset, SEEK_SET);
+    if (fread(theData, 1, theRecord.numBytes, theFile) != (size_t)theRecord.numBytes) {
+      opserr << "CheckpointDatastore - could not read " << fileName << endln;
+      delete [] theData;
+      return 0;
+    }
+    recordData[record] = theData;
+  }
+  return recordData[record];
+#endif
+}
+
+
+void
+CheckpointDatastore::unmapFile(void)
+{
+#ifndef _WIN32
+  if (mapData != 0)
+    munmap(mapData, mapSize);
+#endif
+  mapData = 0;
+  mapSize = 0;
+
+  for (int i=0; i<(int)recordData.size(); i++)
+    if (recordData[i] != 0)
+      delete [] recordData[i];
+  recordData.clear();
+}
+
+
+int 
+CheckpointDatastore::sendMsg(int dataTag, int commitTag, 
+			     const Message &theMessage, 
+			     ChannelAddress *theAddress)
+{
+  char *theData = this->putData(dataTag, commitTag, MSG_DATA, theMessage.length, theMessage.length);
+  if (theData == 0)
+    return -1;
+  memcpy(theData, theMessage.data, theMessage.length);
+  return 0;
+}		       
+
+int 
+CheckpointDatastore::recvMsg(int dataTag, int commitTag, 
+			     Message &theMessage, 
+			     ChannelAddress *theAddress)
+{
+  const char *theData = this->getData(dataTag, commitTag, MSG_DATA, theMessage.length, "recvMsg");
+  if (theData == 0)
+    return -1;
+  memcpy(theMessage.data, theData, theMessage.length);
+  return 0;
+}		       
+
+int 
+CheckpointDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+					Message &theMessage, 
+					ChannelAddress *theAddress)
+{
+  // the Message is set to point at the record, which stays valid until
+  // a restore needs data committed after the file was last mapped
+  int size = 0;
+  const char *theData = this->getData(dataTag, commitTag, MSG_DATA, -1, "recvMsgUnknownSize", &size);
+  if (theData == 0)
+    return -1;
+  theMessage.setData((char *)theData, size);
+  return 0;
+}		       
+
+
+int 
+CheckpointDatastore::sendMatrix(int dataTag, int commitTag, 
+				const Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.dataSize;
+  char *theData = this->putData(dataTag, commitTag, MATRIX_DATA, size, (long long)size*sizeof(double));
+  if (theData == 0)
+    return -1;
+  memcpy(theData, theMatrix.data, size*sizeof(double));
+  return 0;
+}		       
+
+int 
+CheckpointDatastore::recvMatrix(int dataTag, int commitTag, 
+				Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.dataSize;
+  const char *theData = this->getData(dataTag, commitTag, MATRIX_DATA, size, "recvMatrix");
+  if (theData == 0)
+    return -1;
+  memcpy(theMatrix.data, theData, size*sizeof(double));
+  return 0;
+}		       
+
+
+int 
+CheckpointDatastore::sendVector(int dataTag, int commitTag, 
+				const Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  int size = theVector.sz;
+  char *theData = this->putData(dataTag, commitTag, VECTOR_DATA, size, (long long)size*sizeof(double));
+  if (theData == 0)
+    return -1;
+  memcpy(theData, theVector.theData, size*sizeof(double));
+  return 0;
+}		       
+
+int 
+CheckpointDatastore::recvVector(int dataTag, int commitTag, 
+				Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  int size = theVector.sz;
+  const char *theData = this->getData(dataTag, commitTag, VECTOR_DATA, size, "recvVector");
+  if (theData == 0)
+    return -1;
+  memcpy(theVector.theData, theData, size*sizeof(double));
+  return 0;
+}		       
+
+
+int 
+CheckpointDatastore::sendID(int dataTag, int commitTag, 
+			    const ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  int size = theID.sz;
+  char *theData = this->putData(dataTag, commitTag, ID_DATA, size, (long long)size*sizeof(int));
+  if (theData == 0)
+    return -1;
+  memcpy(theData, theID.data, size*sizeof(int));
+  return 0;
+}		       
+
+int 
+CheckpointDatastore::recvID(int dataTag, int commitTag, 
+			    ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  int size = theID.sz;
+  const char *theData = this->getData(dataTag, commitTag, ID_DATA, size, "recvID");
+  if (theData == 0)
+    return -1;
+  memcpy(theID.data, theData, size*sizeof(int));
+  return 0;
+}		       
@@ -0,0 +1,156 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/database/CheckpointDatastore.h,v $
+                                                                        
+                                                                        
+#ifndef CheckpointDatastore_h
+#define CheckpointDatastore_h
+
+// Written: 10/26
+//
+// Description: This file contains the class definition for 
+// CheckpointDatastore. CheckpointDatastore is a concrete subclass of
+// FE_Datastore. All the data for a commitState() is gathered in memory
+// and appended to a single binary file as one record with one write:
+//
+//   file:    header | record | record | ...
+//   record:  header | index | data | trailer
+//
+// The index is sorted on (dbTag, commitTag, type, size) and every offset
+// is a multiple of 8 bytes, so a record can be used in place from a memory
+// mapped file. A restoreState() looks the data up in the newest record
+// holding it, data that did not change since an earlier commit (the domain
+// geometry) is found in the record that first stored it. Records that were
+// not completely written are ignored when an existing file is reopened.
+//
+// Besides the Domain (nodes, elements and so their material history,
+// loads and constraints) a record holds the current integrator and
+// solution algorithm. After a restore the Domain is flagged as changed so
+// that the analysis reinitializes from the restored state, which allows a
+// run to be rolled back to a checkpoint after a failure to converge.
+//
+// What: "@(#) CheckpointDatastore.h, revA"
+
+#include <FE_Datastore.h>
+#include <vector>
+#include <stdio.h>
+
+class FEM_ObjectBroker;
+
+typedef struct checkpointEntry {
+  int dbTag;
+  int commitTag;
+  int type;
+  int size;                 // number of values (bytes for a Message)
+  long long offset;         // from the start of the record data
+  long long numBytes;
+} CheckpointEntry;
+
+typedef struct checkpointRecord {
+  int commitTag;
+  long long offset;         // from the start of the file
+  long long numEntries;
+  long long numBytes;       // of the whole record
+} CheckpointRecord;
+
+class CheckpointDatastore: public FE_Datastore
+{
+  public:
+    CheckpointDatastore(const char *fileName,
+			Domain &theDomain, 
+			FEM_ObjectBroker &theBroker);    
+    
+    ~CheckpointDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+    
+  protected:
+
+  private:
+    // Private methods
+    int openFile(void);
+    char *putData(int dbTag, int commitTag, int type, int size, long long numBytes);
+    const char *getData(int dbTag, int commitTag, int type, int size, 
+			const char *method, int *sizeFound = 0);
+    const char *mapRecord(int record);
+    void unmapFile(void);
+    int sendAnalysis(int commitTag);
+    int recvAnalysis(int commitTag);
+
+    // private attributes
+    char *fileName;
+    FILE *theFile;
+    long long fileEnd;                      // end of the last complete record
+    Domain *theDomain;
+
+    std::vector<CheckpointRecord> records;  // records in the file
+    int lastRecord;                         // record of the last successful lookup
+
+    // the record being assembled during a commitState()
+    bool committing;
+    std::vector<CheckpointEntry> entries;
+    char *data;
+    long long sizeData;
+    long long numData;
+
+    // the file mapped (or read) for a restoreState()
+    char *mapData;
+    long long mapSize;
+    std::vector<char *> recordData;         // only used without mmap()
+};
+
+
+#endif
@@ -191,3 +191,9 @@ FE_Datastore::getDbTag(void)
   lastDbTag++;
   return lastDbTag;
 }
+
+FEM_ObjectBroker *
+FE_Datastore::getObjectBroker(void)
+{
+  return theObjectBroker;
+}
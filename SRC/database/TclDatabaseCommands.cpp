@@ -46,6 +46,7 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <CheckpointDatastore.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -123,6 +124,26 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
       return TCL_ERROR;
     } 
     
+    return TCL_OK;
+
+  // a single binary file of checkpoints
+  } else if (strcmp(argv[1],"Checkpoint") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING database Checkpoint fileName? ";
+      return TCL_ERROR;
+    }    
+
+    // delete the old database
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    theDatabase = new CheckpointDatastore(argv[2], theDomain, theBroker);
+    // check we instantiated a database .. if not ran out of memory
+    if (theDatabase == 0) {
+      opserr << "WARNING ran out of memory - database Checkpoint " << argv[2] << endln;
+      return TCL_ERROR;
+    } 
+    
     return TCL_OK;
   } else {
 
@@ -173,7 +194,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
     }
   }
   opserr << "WARNING No database type exists ";
-  opserr << "for database of type:" << argv[1] << "valid database type File\n";
+  opserr << "for database of type:" << argv[1] << "valid database type File, Checkpoint\n";
 
   return TCL_ERROR;
 }    
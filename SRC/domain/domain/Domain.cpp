@@ -56,6 +56,7 @@
 
 #include <MapOfTaggedObjects.h>
 #include <MapOfTaggedObjectsIter.h>
+#include <VectorOfTaggedObjects.h>
 
 #include <SingleDomEleIter.h>
 #include <SingleDomNodIter.h>
@@ -81,6 +82,7 @@
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <NodalStateStore.h>
 
 //
 // global variables
@@ -94,7 +96,8 @@ int           ops_Creep = 0;
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), structuralChangeFlag(false), lastStructuralGeoTag(0),
+ theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
@@ -103,12 +106,17 @@ Domain::Domain()
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), theEleResults(0), theEleThreadSafe(0),
+ numEleThreadSafe(0), numEleArray(0), sizeEleArray(0), eleArrayStamp(-1),
+ theNodArray(0), theNodResults(0),
+ numNodArray(0), sizeNodArray(0), nodArrayStamp(-1),
+ theNodalStateStore(0)
 {
   
     // init the arrays for storing the domain components
-    theElements = new MapOfTaggedObjects();
-    theNodes    = new MapOfTaggedObjects();
+    theElements = new VectorOfTaggedObjects();
+    theNodes    = new VectorOfTaggedObjects();
     theSPs      = new MapOfTaggedObjects();
     thePCs      = new MapOfTaggedObjects();
     theMPs      = new MapOfTaggedObjects();    
@@ -150,7 +158,8 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
 	       int numLoadPatterns)
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), structuralChangeFlag(false), lastStructuralGeoTag(0),
+ theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0),
@@ -158,11 +167,16 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0), paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), theEleResults(0), theEleThreadSafe(0),
+ numEleThreadSafe(0), numEleArray(0), sizeEleArray(0), eleArrayStamp(-1),
+ theNodArray(0), theNodResults(0),
+ numNodArray(0), sizeNodArray(0), nodArrayStamp(-1),
+ theNodalStateStore(0)
 {
     // init the arrays for storing the domain components
-    theElements = new MapOfTaggedObjects();
-    theNodes    = new MapOfTaggedObjects();
+    theElements = new VectorOfTaggedObjects();
+    theNodes    = new VectorOfTaggedObjects();
     theSPs      = new MapOfTaggedObjects();
     thePCs      = new MapOfTaggedObjects();
     theMPs      = new MapOfTaggedObjects();    
@@ -206,7 +220,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 	       TaggedObjectStorage &theLoadPatternsStorage)
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), structuralChangeFlag(false), lastStructuralGeoTag(0),
+ theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
@@ -219,7 +234,12 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), theEleResults(0), theEleThreadSafe(0),
+ numEleThreadSafe(0), numEleArray(0), sizeEleArray(0), eleArrayStamp(-1),
+ theNodArray(0), theNodResults(0),
+ numNodArray(0), sizeNodArray(0), nodArrayStamp(-1),
+ theNodalStateStore(0)
 {
     // init the arrays for storing the domain components
     thePCs      = new MapOfTaggedObjects();
@@ -270,7 +290,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 Domain::Domain(TaggedObjectStorage &theStorage)
 :theRecorders(0), numRecorders(0),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
- hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
+ hasDomainChangedFlag(false), structuralChangeFlag(false), lastStructuralGeoTag(0),
+ theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
@@ -278,7 +299,12 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), theEleResults(0), theEleThreadSafe(0),
+ numEleThreadSafe(0), numEleArray(0), sizeEleArray(0), eleArrayStamp(-1),
+ theNodArray(0), theNodResults(0),
+ numNodArray(0), sizeNodArray(0), nodArrayStamp(-1),
+ theNodalStateStore(0)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -394,6 +420,23 @@ Domain::~Domain()
 
   if (theModalDampingFactors != 0)
     delete theModalDampingFactors;
+
+  if (theEleArray != 0)
+    delete [] theEleArray;
+
+  if (theEleResults != 0)
+    delete [] theEleResults;
+  if (theEleThreadSafe != 0)
+    delete [] theEleThreadSafe;
+
+  if (theNodArray != 0)
+    delete [] theNodArray;
+
+  if (theNodResults != 0)
+    delete [] theNodResults;
+
+  if (theNodalStateStore != 0)
+    delete theNodalStateStore;
   
   int i;
   for (i=0; i<numRecorders; i++) 
@@ -961,7 +1004,10 @@ Domain::addElementalLoad(ElementalLoad *load, int pattern)
 
 
     // load->setDomain(this); // done in LoadPattern::addElementalLoad()
+    // an elemental load leaves the equations as they are
+    bool structural = structuralChangeFlag;
     this->domainChange();
+    structuralChangeFlag = structural;
     return result;
 }
 
@@ -981,9 +1027,12 @@ Domain::clearAll(void) {
   while ((thePattern = thePatterns()) != 0)
     thePattern->clearAll();
 
-  // clean out the containers
+  // clean out the containers; the nodes are deleted while still in the
+  // store, whose arrays are then freed without handing them back
   theElements->clearAll();
   theNodes->clearAll();
+  if (theNodalStateStore != 0)
+    theNodalStateStore->freeStorage();
   theSPs->clearAll();
   thePCs->clearAll();
   theMPs->clearAll();
@@ -1033,6 +1082,10 @@ Domain::clearAll(void) {
   
   // rest the flag to be as initial
   hasDomainChangedFlag = false;
+  structuralChangeFlag = false;
+  lastStructuralGeoTag = 0;
+  removedEleTags.clear();
+  removedEleGeoTags.clear();
   nodeGraphBuiltFlag = false;
   eleGraphBuiltFlag = false;
   
@@ -1054,6 +1107,12 @@ Domain::clearAll(void) {
   if (theElementGraph != 0)
     delete theElementGraph;
   theElementGraph = 0;
+
+  // the element and node arrays hold pointers to deleted components
+  numEleArray = 0;
+  eleArrayStamp = -1;
+  numNodArray = 0;
+  nodArrayStamp = -1;
   
   dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; dbMPs =0; dbLPs = 0; dbParam = 0;
 }
@@ -1069,8 +1128,14 @@ Domain::removeElement(int tag)
   if (mc == 0) 
       return 0;
 
-  // otherwise mark the domain as having changed
+  // otherwise mark the domain as having changed; a removal on its own
+  // leaves the equations as they are, so it is recorded with the
+  // GeoTag it will take effect at for the analysis to patch its model
+  bool structural = structuralChangeFlag;
   this->domainChange();
+  structuralChangeFlag = structural;
+  removedEleTags.push_back(tag);
+  removedEleGeoTags.push_back(currentGeoTag+1);
   
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
@@ -1098,6 +1163,11 @@ Domain::removeNode(int tag)
   // perform a downward cast to a Node (safe as only Node added to
   // this container and return the result of the cast
   Node *result = (Node *)mc;
+
+  // the caller may delete the node, so it cannot be left in the store;
+  // the store is rebuilt for the remaining nodes on the next pass
+  if (theNodalStateStore != 0)
+    theNodalStateStore->clearAll();
   // result->setDomain(0);
   
 
@@ -2006,20 +2076,59 @@ int
 Domain::commit(void)
 {
     // 
-    // first invoke commit on all nodes and elements in the domain
+    // first invoke commit on all nodes and elements in the domain; the
+    // passes run over contiguous snapshots of the storage, all nodes
+    // before any element, and with more than one thread each pass is
+    // shared among the threads
     //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0) {
-      nodePtr->commitState();
+    int numNod = this->buildNodArray();
+    int numEle = this->buildEleArray();
+    int chunkSize = numEle/(4*numThreads);
+    if (chunkSize < 1)
+      chunkSize = 1;
+
+    // with the nodal state in a store the nodes are done in one bulk
+    // copy, leaving no nodes for the threaded pass
+    int numNodPass = numNod;
+    if (theNodalStateStore != 0 && theNodalStateStore->getNumNodes() == numNod) {
+      int res = theNodalStateStore->commitState();
+      for (int i=0; i<numNod; i++)
+	theNodResults[i] = res;
+      numNodPass = 0;
     }
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-      elePtr->commitState();
+    // with more than one thread only the elements whose class reports
+    // isThreadSafe(), as flagged when the element array was built, are
+    // done in the threaded pass; the others may share scratch objects
+    // with other elements and follow serially
+    bool threaded = (numThreads > 1);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(numThreads) if (threaded)
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (int i=0; i<numNodPass; i++)
+	theNodResults[i] = theNodArray[i]->commitState();
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, chunkSize)
+#endif
+      for (int i=0; i<numEle; i++)
+	if (threaded == false || theEleThreadSafe[i] == true)
+	  theEleResults[i] = theEleArray[i]->commitState();
     }
 
+    if (threaded == true) {
+      for (int i=0; i<numEle; i++)
+	if (theEleThreadSafe[i] == false)
+	  theEleResults[i] = theEleArray[i]->commitState();
+    }
+
+    this->checkPassResults("commit", "commitState");
+
     // set the new committed time in the domain
     committedTime = currentTime;
     dT = 0.0;
@@ -2040,18 +2149,54 @@ Domain::revertToLastCommit(void)
     // 
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     //
-    
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0)
-	nodePtr->revertToLastCommit();
-    
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-	elePtr->revertToLastCommit();
+    int numNod = this->buildNodArray();
+    int numEle = this->buildEleArray();
+    int chunkSize = numEle/(4*numThreads);
+    if (chunkSize < 1)
+      chunkSize = 1;
+
+    // with the nodal state in a store the nodes are done in one bulk
+    // copy, leaving no nodes for the threaded pass
+    int numNodPass = numNod;
+    if (theNodalStateStore != 0 && theNodalStateStore->getNumNodes() == numNod) {
+      int res = theNodalStateStore->revertToLastCommit();
+      for (int i=0; i<numNod; i++)
+	theNodResults[i] = res;
+      numNodPass = 0;
+    }
+
+    // with more than one thread only the elements whose class reports
+    // isThreadSafe(), as flagged when the element array was built, are
+    // done in the threaded pass; the others may share scratch objects
+    // with other elements and follow serially
+    bool threaded = (numThreads > 1);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(numThreads) if (threaded)
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (int i=0; i<numNodPass; i++)
+	theNodResults[i] = theNodArray[i]->revertToLastCommit();
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, chunkSize)
+#endif
+      for (int i=0; i<numEle; i++)
+	if (threaded == false || theEleThreadSafe[i] == true)
+	  theEleResults[i] = theEleArray[i]->revertToLastCommit();
     }
 
+    if (threaded == true) {
+      for (int i=0; i<numEle; i++)
+	if (theEleThreadSafe[i] == false)
+	  theEleResults[i] = theEleArray[i]->revertToLastCommit();
+    }
+
+    this->checkPassResults("revertToLastCommit", "revertToLastCommit");
+
     // set the current time and load factor in the domain to last committed
     currentTime = committedTime;
     dT = 0.0;
@@ -2107,6 +2252,55 @@ Domain::update(void)
 
   int ok = 0;
 
+#ifdef _OPENMP
+  if (numThreads > 1) {
+
+    int numEle = this->buildEleArray();
+    int chunkSize = numEle/(4*numThreads);
+    if (chunkSize < 1)
+      chunkSize = 1;
+
+    // only elements whose class reports isThreadSafe(), as flagged when
+    // the element array was built, are updated concurrently; the others
+    // may share scratch objects with other elements of their class and
+    // are updated serially afterwards
+    int numSafe = numEleThreadSafe;
+
+    // invoke update on the ele's in chunks; each thread sets its own
+    // active element and the error code is stored per element so the
+    // result does not depend on the order the chunks complete in
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, chunkSize) if (numSafe > 1)
+    for (int i=0; i<numEle; i++) {
+      if (theEleThreadSafe[i] == true) {
+	Element *theEle = theEleArray[i];
+	ops_TheActiveElement = theEle;
+	theEleResults[i] = theEle->update();
+      }
+    }
+
+    for (int i=0; i<numEle; i++) {
+      if (theEleThreadSafe[i] == false) {
+	Element *theEle = theEleArray[i];
+	ops_TheActiveElement = theEle;
+	theEleResults[i] = theEle->update();
+      }
+    }
+
+    for (int i=0; i<numEle; i++) {
+      if (theEleResults[i] != 0) {
+	if (ok == 0)
+	  opserr << "Domain::update - element " << theEleArray[i]->getTag() << " failed in update\n";
+	ok += theEleResults[i];
+      }
+    }
+
+    if (ok != 0)
+      opserr << "Domain::update - domain failed in update\n";
+
+    return ok;
+  }
+#endif
+
   // invoke update on all the ele's
   ElementIter &theEles = this->getElements();
   Element *theEle;
@@ -2123,6 +2317,189 @@ Domain::update(void)
 }
 
 
+void
+Domain::setNumThreads(int num)
+{
+  if (num < 1)
+    num = 1;
+
+#ifndef _OPENMP
+  if (num > 1)
+    opserr << "WARNING Domain::setNumThreads - not built with OpenMP, element passes remain serial\n";
+#endif
+
+  // the thread safety flags are only set when the element array is
+  // built with more than one thread, so have it rebuilt
+  if (num != numThreads)
+    eleArrayStamp = -1;
+
+  numThreads = num;
+}
+
+
+int
+Domain::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+
+void
+Domain::setNodalStateStore(bool onOff)
+{
+  if (onOff == true) {
+    if (theNodalStateStore == 0)
+      theNodalStateStore = new NodalStateStore();
+  } else if (theNodalStateStore != 0) {
+    delete theNodalStateStore;
+    theNodalStateStore = 0;
+  }
+
+  // force the node array, and with it the store, to be rebuilt
+  nodArrayStamp = -1;
+}
+
+
+NodalStateStore *
+Domain::getNodalStateStore(void)
+{
+  return theNodalStateStore;
+}
+
+
+int
+Domain::buildEleArray(void)
+{
+  int numEle = theElements->getNumComponents();
+
+  // reuse the array if the domain has not changed since it was built
+  if (hasDomainChangedFlag == false && eleArrayStamp == currentGeoTag &&
+      numEleArray == numEle)
+    return numEleArray;
+
+  if (numEle > sizeEleArray) {
+    if (theEleArray != 0)
+      delete [] theEleArray;
+    if (theEleResults != 0)
+      delete [] theEleResults;
+    if (theEleThreadSafe != 0)
+      delete [] theEleThreadSafe;
+    theEleArray = new Element *[numEle];
+    theEleResults = new int[numEle];
+    theEleThreadSafe = new bool[numEle];
+    sizeEleArray = numEle;
+  }
+
+  ElementIter &theEles = this->getElements();
+  Element *theEle;
+  numEleArray = 0;
+  while ((theEle = theEles()) != 0 && numEleArray < numEle)
+    theEleArray[numEleArray++] = theEle;
+
+  // the flags are only read by the threaded passes; finding them here,
+  // once per rebuild, keeps the isThreadSafe() calls (which may visit
+  // every material of an element) out of each pass
+  numEleThreadSafe = 0;
+  if (numThreads > 1)
+    numEleThreadSafe = this->markThreadSafeElements(numEleArray);
+
+  eleArrayStamp = currentGeoTag;
+
+  return numEleArray;
+}
+
+
+// markThreadSafeElements():
+//	sets theEleThreadSafe for the first numEle elements of the element
+//	array from Element::isThreadSafe(), which is false unless a class
+//	opts in, and returns the number that may be run concurrently; it
+//	is invoked by buildEleArray() when the array is rebuilt.
+int
+Domain::markThreadSafeElements(int numEle)
+{
+  int numSafe = 0;
+  for (int i=0; i<numEle; i++) {
+    theEleThreadSafe[i] = theEleArray[i]->isThreadSafe();
+    if (theEleThreadSafe[i] == true)
+      numSafe++;
+  }
+
+  return numSafe;
+}
+
+
+int
+Domain::buildNodArray(void)
+{
+  int numNod = theNodes->getNumComponents();
+
+  // reuse the array if the domain has not changed since it was built
+  if (hasDomainChangedFlag == false && nodArrayStamp == currentGeoTag &&
+      numNodArray == numNod)
+    return numNodArray;
+
+  if (numNod > sizeNodArray) {
+    if (theNodArray != 0)
+      delete [] theNodArray;
+    if (theNodResults != 0)
+      delete [] theNodResults;
+    theNodArray = new Node *[numNod];
+    theNodResults = new int[numNod];
+    sizeNodArray = numNod;
+  }
+
+  NodeIter &theNods = this->getNodes();
+  Node *theNod;
+  numNodArray = 0;
+  while ((theNod = theNods()) != 0 && numNodArray < numNod)
+    theNodArray[numNodArray++] = theNod;
+
+  // move the state of the current nodes into the store
+  if (theNodalStateStore != 0 &&
+      theNodalStateStore->setNodes(theNodArray, numNodArray) < 0) {
+    opserr << "WARNING Domain::buildNodArray - failed to build the nodal state store, nodes keep their own storage\n";
+    theNodalStateStore->clearAll();
+  }
+
+  nodArrayStamp = currentGeoTag;
+
+  return numNodArray;
+}
+
+
+int
+Domain::checkPassResults(const char *method, const char *componentMethod)
+{
+  // the results are stored per component and scanned in storage order, so
+  // the component reported does not depend on how the pass was scheduled
+  int numFailed = 0;
+  int result = 0;
+
+  for (int i=0; i<numNodArray; i++) {
+    if (theNodResults[i] != 0) {
+      if (numFailed == 0)
+	opserr << "WARNING Domain::" << method << " - node " << theNodArray[i]->getTag() << " failed in " << componentMethod << endln;
+      numFailed++;
+      result += theNodResults[i];
+    }
+  }
+
+  for (int i=0; i<numEleArray; i++) {
+    if (theEleResults[i] != 0) {
+      if (numFailed == 0)
+	opserr << "WARNING Domain::" << method << " - element " << theEleArray[i]->getTag() << " failed in " << componentMethod << endln;
+      numFailed++;
+      result += theEleResults[i];
+    }
+  }
+
+  if (numFailed > 1)
+    opserr << "WARNING Domain::" << method << " - " << numFailed << " components failed\n";
+
+  return result;
+}
+
+
 int
 Domain::update(double newTime, double dT)
 {
@@ -2297,6 +2674,11 @@ void
 Domain::setDomainChangeStamp(int newStamp)
 {
     currentGeoTag = newStamp;
+
+    // nothing before the new stamp can be patched
+    lastStructuralGeoTag = newStamp;
+    removedEleTags.clear();
+    removedEleGeoTags.clear();
 }
 
 
@@ -2304,6 +2686,7 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    structuralChangeFlag = true;
 }
 
 
@@ -2326,6 +2709,14 @@ Domain::hasDomainChanged(void)
 	currentGeoTag++;
 	nodeGraphBuiltFlag = false;
 	eleGraphBuiltFlag = false;
+
+	// removals recorded before a structural change are of no use
+	if (structuralChangeFlag == true) {
+	    lastStructuralGeoTag = currentGeoTag;
+	    removedEleTags.clear();
+	    removedEleGeoTags.clear();
+	}
+	structuralChangeFlag = false;
     }
 
     // return the integer so user can determine if domain has changed 
@@ -2334,6 +2725,30 @@ Domain::hasDomainChanged(void)
 }
 
 
+// bool getRemovedElements(int sinceStamp, ID &eleTags);
+//	Returns true if the only changes to the domain since the stamp
+//	sinceStamp was returned by hasDomainChanged() are element
+//	removals, the tags of the removed elements being placed in eleTags.
+//	Used by the analysis to patch its model instead of rebuilding it.
+
+bool
+Domain::getRemovedElements(int sinceStamp, ID &eleTags)
+{
+    eleTags.resize(0);
+
+    if (hasDomainChangedFlag == true || sinceStamp <= 0 ||
+	sinceStamp < lastStructuralGeoTag || sinceStamp > currentGeoTag)
+	return false;
+
+    int numRemoved = 0;
+    for (size_t i = 0; i < removedEleTags.size(); i++)
+	if (removedEleGeoTags[i] > sinceStamp)
+	    eleTags[numRemoved++] = removedEleTags[i];
+
+    return true;
+}
+
+
 void
 Domain::Print(OPS_Stream &s, int flag) 
 {
@@ -3529,6 +3944,9 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
     // this way if restoring froma a database and domain has not changed for the analysis
     // the analysis will not have to to do a domainChanged() operation
     currentGeoTag = domainData(0);
+    lastStructuralGeoTag = currentGeoTag;
+    removedEleTags.clear();
+    removedEleGeoTags.clear();
 
     lastGeoSendTag = currentGeoTag;
     hasDomainChangedFlag = false;
@@ -38,6 +38,7 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <vector>
 
 class Element;
 class Node;
@@ -66,6 +67,7 @@ class SingleDomAllSP_Iter;
 class SingleDomParamIter;
 
 class MeshRegion;
+class NodalStateStore;
 class Recorder;
 class Graph;
 class NodeGraph;
@@ -192,6 +194,15 @@ class Domain
     virtual  int  update(double newTime, double dT);
     virtual  int  updateParameter(int tag, int value);
     virtual  int  updateParameter(int tag, double value);    
+
+    // methods to set the number of threads used in the element passes
+    virtual  void setNumThreads(int numThreads);
+    virtual  int  getNumThreads(void) const;
+
+    // methods to hold the nodal response in a NodalStateStore, so that
+    // the nodes are committed and reverted as bulk copies
+    virtual  void setNodalStateStore(bool onOff);
+    virtual  NodalStateStore *getNodalStateStore(void);
     
     virtual  int  analysisStep(double dT);
     virtual  int  eigenAnalysis(int numMode, bool generalized, bool findSmallest);
@@ -212,6 +223,7 @@ class Domain
     virtual bool getDomainChangeFlag(void);    
     virtual void domainChange(void);    
     virtual void setDomainChangeStamp(int newStamp);
+    virtual bool getRemovedElements(int sinceStamp, ID &eleTags);
 
 
     // methods for output
@@ -248,6 +260,9 @@ class Domain
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    virtual int buildEleArray(void);
+    virtual int markThreadSafeElements(int numEle);
+    virtual int buildNodArray(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -258,6 +273,10 @@ class Domain
     double dT;                        // difference between committed and current time
     int	   currentGeoTag;             // an integer used to mark if domain has changed
     bool   hasDomainChangedFlag;      // a bool flag used to indicate if GeoTag needs to be ++
+    bool   structuralChangeFlag;      // a change other than an element removal since GeoTag ++
+    int    lastStructuralGeoTag;      // GeoTag of the last change other than element removals
+    std::vector<int> removedEleTags;  // elements removed since lastStructuralGeoTag and
+    std::vector<int> removedEleGeoTags; // the GeoTag at which each removal took effect
     int    theDbTag;                   // the Domains unique database tag == 0
     int    lastGeoSendTag;            // the value of currentGeoTag when sendSelf was last invoked
     int dbEle, dbNod, dbSPs, dbPCs, dbMPs, dbLPs, dbParam; // database tags for storing info
@@ -309,6 +328,25 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // contiguous copies of the element and node pointers used by the
+    // threaded passes, rebuilt when the domain changes
+    int numThreads;
+    Element **theEleArray;
+    int *theEleResults;
+    bool *theEleThreadSafe;
+    int numEleThreadSafe;
+    int numEleArray;
+    int sizeEleArray;
+    int eleArrayStamp;
+    Node **theNodArray;
+    int *theNodResults;
+    int numNodArray;
+    int sizeNodArray;
+    int nodArrayStamp;
+    NodalStateStore *theNodalStateStore; // 0 unless enabled
+
+    int checkPassResults(const char *method, const char *componentMethod);
 };
 
 #endif
@@ -0,0 +1,285 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/node/NodalStateStore.cpp,v $
+                                                                        
+// Written: 10/26
+//
+// Description: This file contains the implementation of NodalStateStore.
+//
+// What: "@(#) NodalStateStore.cpp, revA"
+
+#include <NodalStateStore.h>
+#include <Node.h>
+#include <OPS_Globals.h>
+#include <string.h>
+#include <stdint.h>
+
+// number of doubles in a 64 byte cache line
+#define STORE_ALIGN 8
+
+// shared by all stores, so that a stamp identifies one layout of one store
+int NodalStateStore::nextLayoutStamp = 0;
+
+NodalStateStore::NodalStateStore()
+  :theNodes(0), theLocs(0), numNodes(0), numDOF(0), blockSize(0),
+   disp(0), vel(0), accel(0), theData(0),
+   rotNodes(0), numRotNodes(0), layoutStamp(++nextLayoutStamp)
+{
+
+}
+
+NodalStateStore::~NodalStateStore()
+{
+  this->clearAll();
+}
+
+int
+NodalStateStore::setNodes(Node **nodes, int num)
+{
+  this->clearAll();
+
+  if (num <= 0 || nodes == 0)
+    return 0;
+
+  // count the dof and the nodes that may carry a finite rotation
+  int nDOF = 0;
+  int nRot = 0;
+  for (int i=0; i<num; i++) {
+    int ndf = nodes[i]->getNumberDOF();
+    nDOF += ndf;
+    if (ndf >= 6)
+      nRot++;
+  }
+
+  if (nDOF == 0)
+    return 0;
+
+  // round the block size up to a whole cache line; 8 blocks in all and
+  // an extra line so the first block can be aligned
+  int size = ((nDOF + STORE_ALIGN - 1)/STORE_ALIGN)*STORE_ALIGN;
+
+  theData = new double[8*size + STORE_ALIGN];
+  theNodes = new Node *[num];
+  theLocs = new int[num];
+  if (nRot != 0)
+    rotNodes = new Node *[nRot];
+
+  if (theData == 0 || theNodes == 0 || theLocs == 0 || (nRot != 0 && rotNodes == 0)) {
+    opserr << "WARNING NodalStateStore::setNodes() - out of memory for " << nDOF << " dof\n";
+    if (theData != 0)
+      delete [] theData;
+    if (theNodes != 0)
+      delete [] theNodes;
+    if (theLocs != 0)
+      delete [] theLocs;
+    if (rotNodes != 0)
+      delete [] rotNodes;
+    theData = 0;
+    theNodes = 0;
+    theLocs = 0;
+    rotNodes = 0;
+    return -1;
+  }
+
+  double *aligned = theData;
+  size_t misalign = ((uintptr_t)theData) % (STORE_ALIGN*sizeof(double));
+  if (misalign != 0)
+    aligned += (STORE_ALIGN*sizeof(double) - misalign)/sizeof(double);
+
+  numDOF = nDOF;
+  blockSize = size;
+  disp = aligned;
+  vel = &disp[4*blockSize];
+  accel = &vel[2*blockSize];
+
+  // zero the whole lot, the padding at the end of each block included
+  for (int i=0; i<8*blockSize; i++)
+    disp[i] = 0.0;
+
+  // hand each node its slot in the arrays
+  int loc = 0;
+  for (int i=0; i<num; i++) {
+    Node *theNode = nodes[i];
+    if (theNode->setStateStorage(this, &disp[loc], &vel[loc], &accel[loc], blockSize) < 0) {
+      opserr << "WARNING NodalStateStore::setNodes() - failed to move node " << theNode->getTag() << " into the store\n";
+      this->clearAll();
+      return -1;
+    }
+    theLocs[numNodes] = loc;
+    theNodes[numNodes++] = theNode;
+    if (theNode->getNumberDOF() >= 6)
+      rotNodes[numRotNodes++] = theNode;
+    loc += theNode->getNumberDOF();
+  }
+
+  layoutStamp = ++nextLayoutStamp;
+
+  return 0;
+}
+
+void
+NodalStateStore::clearAll(void)
+{
+  // give the nodes their own storage back before the arrays go
+  for (int i=0; i<numNodes; i++)
+    theNodes[i]->releaseStateStorage();
+
+  this->freeStorage();
+}
+
+void
+NodalStateStore::freeStorage(void)
+{
+  if (theNodes != 0)
+    delete [] theNodes;
+  if (theLocs != 0)
+    delete [] theLocs;
+  if (rotNodes != 0)
+    delete [] rotNodes;
+  if (theData != 0)
+    delete [] theData;
+
+  theNodes = 0;
+  theLocs = 0;
+  rotNodes = 0;
+  theData = 0;
+  disp = 0;
+  vel = 0;
+  accel = 0;
+  numNodes = 0;
+  numRotNodes = 0;
+  numDOF = 0;
+  blockSize = 0;
+  layoutStamp = ++nextLayoutStamp;
+}
+
+int
+NodalStateStore::getNumNodes(void) const
+{
+  return numNodes;
+}
+
+int
+NodalStateStore::getNumDOF(void) const
+{
+  return numDOF;
+}
+
+int
+NodalStateStore::getBlockSize(void) const
+{
+  return blockSize;
+}
+
+Node *
+NodalStateStore::getNode(int i)
+{
+  if (i < 0 || i >= numNodes)
+    return 0;
+  return theNodes[i];
+}
+
+int
+NodalStateStore::getNodeLocation(int i) const
+{
+  if (i < 0 || i >= numNodes)
+    return -1;
+  return theLocs[i];
+}
+
+int
+NodalStateStore::getLayoutStamp(void) const
+{
+  return layoutStamp;
+}
+
+int
+NodalStateStore::commitState(void)
+{
+  if (numDOF == 0)
+    return 0;
+
+  size_t nBytes = numDOF*sizeof(double);
+
+  // commit = trial, incr = incrDelta = 0
+  memcpy(&disp[blockSize], disp, nBytes);
+  memset(&disp[2*blockSize], 0, 2*blockSize*sizeof(double));
+  memcpy(&vel[blockSize], vel, nBytes);
+  memcpy(&accel[blockSize], accel, nBytes);
+
+  for (int i=0; i<numRotNodes; i++)
+    rotNodes[i]->commitRotation();
+
+  return 0;
+}
+
+int
+NodalStateStore::revertToLastCommit(void)
+{
+  if (numDOF == 0)
+    return 0;
+
+  size_t nBytes = numDOF*sizeof(double);
+
+  // trial = commit, incr = incrDelta = 0
+  memcpy(disp, &disp[blockSize], nBytes);
+  memset(&disp[2*blockSize], 0, 2*blockSize*sizeof(double));
+  memcpy(vel, &vel[blockSize], nBytes);
+  memcpy(accel, &accel[blockSize], nBytes);
+
+  for (int i=0; i<numRotNodes; i++)
+    rotNodes[i]->revertRotation();
+
+  return 0;
+}
+
+int
+NodalStateStore::revertToStart(void)
+{
+  // the nodes also reset loads, rotations and sensitivities, so this
+  // is left to them; it is not on the time stepping path
+  int res = 0;
+  for (int i=0; i<numNodes; i++)
+    if (theNodes[i]->revertToStart() < 0)
+      res = -1;
+
+  return res;
+}
+
+double *
+NodalStateStore::getDisp(void)
+{
+  return disp;
+}
+
+double *
+NodalStateStore::getVel(void)
+{
+  return vel;
+}
+
+double *
+NodalStateStore::getAccel(void)
+{
+  return accel;
+}
@@ -0,0 +1,104 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/node/NodalStateStore.h,v $
+                                                                        
+// Written: 10/26
+//
+// Description: This file contains the class definition for
+// NodalStateStore. A NodalStateStore holds the displacement, velocity
+// and acceleration arrays of a set of nodes in a few contiguous arrays,
+// one per response quantity, indexed by the position of a node's dofs
+// in the store. The nodes keep their Vector objects, which are set to
+// point into the arrays, so that committing or reverting the state of
+// all the nodes is a bulk copy over each array, and the AnalysisModel
+// can set the trial response in one pass over them.
+//
+// What: "@(#) NodalStateStore.h, revA"
+
+#ifndef NodalStateStore_h
+#define NodalStateStore_h
+
+class Node;
+
+class NodalStateStore
+{
+  public:
+    NodalStateStore();
+    ~NodalStateStore();
+
+    // move the state of the nodes into the store; any nodes already in
+    // the store are first given their own storage back
+    int setNodes(Node **theNodes, int numNodes);
+    void clearAll(void);
+
+    // free the arrays without giving the nodes their storage back; only
+    // for when the nodes in the store have already been deleted
+    void freeStorage(void);
+
+    int getNumNodes(void) const;
+    int getNumDOF(void) const;
+    int getBlockSize(void) const;
+
+    // the i'th node in the store and the position of its first dof in
+    // the arrays; the layout stamp changes whenever the nodes in the
+    // store, and so these positions, change
+    Node *getNode(int i);
+    int getNodeLocation(int i) const;
+    int getLayoutStamp(void) const;
+
+    // commit, revert and zero the state of all nodes in the store
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+
+    // the arrays; the trial, committed, incremental and incremental
+    // delta displacements are in blocks of getBlockSize() values, in
+    // that order, in the displacement array, and the trial and committed
+    // values in the velocity and acceleration arrays. The first
+    // getNumDOF() values of each block are used, and each block starts
+    // on a 64 byte boundary
+    double *getDisp(void);
+    double *getVel(void);
+    double *getAccel(void);
+
+  private:
+    NodalStateStore(const NodalStateStore &);
+    NodalStateStore &operator=(const NodalStateStore &);
+
+    Node **theNodes;         // the nodes in the store
+    int *theLocs;            // position of the first dof of each node
+    int numNodes;
+    int numDOF;              // total number of dof in the store
+    int blockSize;           // numDOF rounded up to a whole cache line
+
+    double *disp, *vel, *accel;
+    double *theData;         // single allocation holding the arrays
+
+    Node **rotNodes;         // the nodes that may track a finite rotation
+    int numRotNodes;
+
+    int layoutStamp;
+    static int nextLayoutStamp;
+};
+
+#endif
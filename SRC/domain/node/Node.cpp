@@ -227,7 +227,8 @@ Node::Node(int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0), 
  incrDeltaDisp(0),
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), stateStride(0), theStateStore(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  rotation(nullptr),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0), displayLocation(0), temperature(0)
@@ -251,7 +252,8 @@ Node::Node(int tag, int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), stateStride(0), theStateStore(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  rotation(nullptr),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0), displayLocation(0), temperature(0)
@@ -275,7 +277,8 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), stateStride(0), theStateStore(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  rotation(nullptr),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0), displayLocation(0), temperature(0)
@@ -308,7 +311,8 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), stateStride(0), theStateStore(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  rotation(nullptr),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0), displayLocation(0), temperature(0)
@@ -343,7 +347,8 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), stateStride(0), theStateStore(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  rotation(nullptr),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0), displayLocation(0), temperature(0)
@@ -379,7 +384,8 @@ Node::Node(const Node &otherNode, bool copyMass)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), stateStride(0), theStateStore(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  rotation(nullptr),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
    reaction(0), displayLocation(0), temperature(0)
@@ -408,8 +414,9 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for displacement\n";
       exit(-1);
     }
-    for (int i=0; i<4*numberDOF; i++)
-      disp[i] = otherNode.disp[i];
+    for (int j=0; j<4; j++)
+      for (int i=0; i<numberDOF; i++)
+	disp[i+j*numberDOF] = otherNode.disp[i+j*otherNode.stateStride];
   }    
   
   if (otherNode.commitVel != 0) {
@@ -417,8 +424,9 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for velocity\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
-      vel[i] = otherNode.vel[i];
+    for (int j=0; j<2; j++)
+      for (int i=0; i<numberDOF; i++)
+	vel[i+j*numberDOF] = otherNode.vel[i+j*otherNode.stateStride];
   }    
   
   if (otherNode.commitAccel != 0) {
@@ -426,8 +434,9 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for acceleration\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
-      accel[i] = otherNode.accel[i];
+    for (int j=0; j<2; j++)
+      for (int i=0; i<numberDOF; i++)
+	accel[i+j*numberDOF] = otherNode.accel[i+j*otherNode.stateStride];
   }    
   
   
@@ -502,14 +511,17 @@ Node::~Node()
     if (unbalLoad != 0)
 	delete unbalLoad;
     
-    if (disp != 0)
+    // the arrays belong to the NodalStateStore if the node is in one
+    if (theStateStore == 0) {
+      if (disp != 0)
 	delete [] disp;
 
-    if (vel != 0)
+      if (vel != 0)
 	delete [] vel;
 
-    if (accel != 0)
+      if (accel != 0)
 	delete [] accel;
+    }
 
     if (mass != 0)
 	delete mass;
@@ -739,8 +751,8 @@ Node::setTrialDisp(double value, int dof)
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
     double tDisp = value;
-    disp[dof+2*numberDOF] = tDisp - disp[dof+numberDOF];
-    disp[dof+3*numberDOF] = tDisp - disp[dof];	
+    disp[dof+2*stateStride] = tDisp - disp[dof+stateStride];
+    disp[dof+3*stateStride] = tDisp - disp[dof];	
     disp[dof] = tDisp;
 
     return 0;
@@ -770,8 +782,8 @@ Node::setTrialDisp(const Vector &newTrialDisp)
     // as we are sure of size and this way is quicker
     for (int i=0; i<numberDOF; i++) {
         double tDisp = newTrialDisp(i);
-	disp[i+2*numberDOF] = tDisp - disp[i+numberDOF];
-	disp[i+3*numberDOF] = tDisp - disp[i];	
+	disp[i+2*stateStride] = tDisp - disp[i+stateStride];
+	disp[i+3*stateStride] = tDisp - disp[i];	
 	disp[i] = tDisp;
     }
 
@@ -838,7 +850,7 @@ Node::incrTrialDisp(const Vector &incrDispl)
     }    
 
     if (rotation != nullptr && this->getNumberDOF() >= 6)
-      rotation[1] = rotation[1]*Versor::from_vector(&disp[3*numberDOF+3]);
+      rotation[1] = rotation[1]*Versor::from_vector(&disp[3*stateStride+3]);
 
 
     // create a copy if no trial exists and add committed
@@ -850,8 +862,8 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
 	  disp[i] = incrDispI;
-	  disp[i+2*numberDOF] = incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  disp[i+2*stateStride] = incrDispI;
+	  disp[i+3*stateStride] = incrDispI;
 	}
 	return 0;
     }
@@ -860,8 +872,8 @@ Node::incrTrialDisp(const Vector &incrDispl)
     for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
 	  disp[i] += incrDispI;
-	  disp[i+2*numberDOF] += incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  disp[i+2*stateStride] += incrDispI;
+	  disp[i+3*stateStride] = incrDispI;
     }
 
     return 0;
@@ -1095,22 +1107,22 @@ Node::commitState()
     // check disp exists, if does set commit = trial, incr = 0.0
     if (trialDisp != 0) {
       for (int i=0; i<numberDOF; i++) {
-	disp[i+numberDOF] = disp[i];  
-        disp[i+2*numberDOF] = 0.0;
-        disp[i+3*numberDOF] = 0.0;
+	disp[i+stateStride] = disp[i];  
+        disp[i+2*stateStride] = 0.0;
+        disp[i+3*stateStride] = 0.0;
       }
     }		    
     
     // check vel exists, if does set commit = trial    
     if (trialVel != 0) {
       for (int i=0; i<numberDOF; i++)
-	vel[i+numberDOF] = vel[i];
+	vel[i+stateStride] = vel[i];
     }
     
     // check accel exists, if does set commit = trial        
     if (trialAccel != 0) {
       for (int i=0; i<numberDOF; i++)
-	accel[i+numberDOF] = accel[i];
+	accel[i+stateStride] = accel[i];
     }
 
     if (rotation != nullptr)
@@ -1127,22 +1139,22 @@ Node::revertToLastCommit()
     // check disp exists, if does set trial = last commit, incr = 0
     if (disp != 0) {
       for (int i=0 ; i<numberDOF; i++) {
-	disp[i] = disp[i+numberDOF];
-	disp[i+2*numberDOF] = 0.0;
-	disp[i+3*numberDOF] = 0.0;
+	disp[i] = disp[i+stateStride];
+	disp[i+2*stateStride] = 0.0;
+	disp[i+3*stateStride] = 0.0;
       }
     }
     
     // check vel exists, if does set trial = last commit
     if (vel != 0) {
       for (int i=0 ; i<numberDOF; i++)
-	vel[i] = vel[numberDOF+i];
+	vel[i] = vel[stateStride+i];
     }
 
     // check accel exists, if does set trial = last commit
     if (accel != 0) {    
       for (int i=0 ; i<numberDOF; i++)
-	accel[i] = accel[numberDOF+i];
+	accel[i] = accel[stateStride+i];
     }
 
     if (rotation != nullptr)
@@ -1157,20 +1169,23 @@ Node::revertToStart()
 {
     // check disp exists, if does set all to zero
     if (disp != 0) {
-      for (int i=0 ; i<4*numberDOF; i++)
-	disp[i] = 0.0;
+      for (int j=0; j<4; j++)
+	for (int i=0 ; i<numberDOF; i++)
+	  disp[i+j*stateStride] = 0.0;
     }
 
     // check vel exists, if does set all to zero
     if (vel != 0) {
-      for (int i=0 ; i<2*numberDOF; i++)
-	vel[i] = 0.0;
+      for (int j=0; j<2; j++)
+	for (int i=0 ; i<numberDOF; i++)
+	  vel[i+j*stateStride] = 0.0;
     }
 
     // check accel exists, if does set all to zero
     if (accel != 0) {    
-      for (int i=0 ; i<2*numberDOF; i++)
-	accel[i] = 0.0;
+      for (int j=0; j<2; j++)
+	for (int i=0 ; i<numberDOF; i++)
+	  accel[i+j*stateStride] = 0.0;
     }
     
     if (unbalLoad != 0) 
@@ -1201,6 +1216,107 @@ Node::revertToStart()
 }
 
 
+// setStateStorage(), releaseStateStorage():
+// methods used by a NodalStateStore to move the response arrays of the
+// node into, and back out of, arrays that it holds for all its nodes.
+// The current response values are copied over and the Vector objects
+// reset to point into the new arrays.
+
+int
+Node::setStateStorage(NodalStateStore *theStore, double *newDisp,
+		      double *newVel, double *newAccel, int stride)
+{
+  if (theStore == 0 || newDisp == 0 || newVel == 0 || newAccel == 0 || stride < numberDOF) {
+    opserr << "WARNING Node::setStateStorage() - invalid arrays for node: " << this->getTag() << endln;
+    return -1;
+  }
+
+  for (int i=0; i<numberDOF; i++) {
+    for (int j=0; j<4; j++)
+      newDisp[i+j*stride] = (disp != 0) ? disp[i+j*stateStride] : 0.0;
+    for (int j=0; j<2; j++) {
+      newVel[i+j*stride] = (vel != 0) ? vel[i+j*stateStride] : 0.0;
+      newAccel[i+j*stride] = (accel != 0) ? accel[i+j*stateStride] : 0.0;
+    }
+  }
+
+  if (theStateStore == 0) {
+    if (disp != 0)
+      delete [] disp;
+    if (vel != 0)
+      delete [] vel;
+    if (accel != 0)
+      delete [] accel;
+  }
+
+  disp = newDisp;
+  vel = newVel;
+  accel = newAccel;
+  stateStride = stride;
+  theStateStore = theStore;
+
+  this->setStateVectors();
+
+  return 0;
+}
+
+int
+Node::releaseStateStorage(void)
+{
+  if (theStateStore == 0)
+    return 0;
+
+  double *newDisp = new double[4*numberDOF];
+  double *newVel = new double[2*numberDOF];
+  double *newAccel = new double[2*numberDOF];
+
+  for (int i=0; i<numberDOF; i++) {
+    for (int j=0; j<4; j++)
+      newDisp[i+j*numberDOF] = disp[i+j*stateStride];
+    for (int j=0; j<2; j++) {
+      newVel[i+j*numberDOF] = vel[i+j*stateStride];
+      newAccel[i+j*numberDOF] = accel[i+j*stateStride];
+    }
+  }
+
+  disp = newDisp;
+  vel = newVel;
+  accel = newAccel;
+  stateStride = numberDOF;
+  theStateStore = 0;
+
+  this->setStateVectors();
+
+  return 0;
+}
+
+NodalStateStore *
+Node::getStateStore(void)
+{
+  return theStateStore;
+}
+
+// commitRotation(), revertRotation():
+// the finite rotation is not held in the store arrays, so a store
+// commits and reverts it through these for nodes with 6 or more dof.
+
+int
+Node::commitRotation(void)
+{
+  if (rotation != nullptr)
+    rotation[0] = rotation[1];
+  return 0;
+}
+
+int
+Node::revertRotation(void)
+{
+  if (rotation != nullptr)
+    rotation[1] = rotation[0];
+  return 0;
+}
+
+
 const Matrix &
 Node::getMass(void) 
 {
@@ -1603,7 +1719,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 
       // set the trial quantities equal to committed
       for (int i=0; i<numberDOF; i++)
-	disp[i] = disp[i+numberDOF];  // set trial equal committed
+	disp[i] = disp[i+stateStride];  // set trial equal committed
 
     } else if (commitDisp != 0) {
       // if going back to initial we will just zero the vectors
@@ -1625,7 +1741,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 
       // set the trial quantity
       for (int i=0; i<numberDOF; i++)
-	vel[i] = vel[i+numberDOF];  // set trial equal committed
+	vel[i] = vel[i+stateStride];  // set trial equal committed
     }
 
     if (data(4) == 0) {
@@ -1641,7 +1757,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
       
       // set the trial values
       for (int i=0; i<numberDOF; i++)
-	accel[i] = accel[i+numberDOF];  // set trial equal committed
+	accel[i] = accel[i+stateStride];  // set trial equal committed
     }
 
     if (data(5) == 0) {
@@ -1824,6 +1940,7 @@ Node::createDisp(void)
   }
   for (int i=0; i<4*numberDOF; i++)
     disp[i] = 0.0;
+  stateStride = numberDOF;
     
   commitDisp = new Vector(&disp[numberDOF], numberDOF); 
   trialDisp = new Vector(disp, numberDOF);
@@ -1851,6 +1968,7 @@ Node::createVel(void)
     }
     for (int i=0; i<2*numberDOF; i++)
       vel[i] = 0.0;
+    stateStride = numberDOF;
     
     commitVel = new Vector(&vel[numberDOF], numberDOF); 
     trialVel = new Vector(vel, numberDOF);
@@ -1875,6 +1993,7 @@ Node::createAccel(void)
     }
     for (int i=0; i<2*numberDOF; i++)
 	accel[i] = 0.0;
+    stateStride = numberDOF;
     
     commitAccel = new Vector(&accel[numberDOF], numberDOF);
     trialAccel = new Vector(accel, numberDOF);
@@ -1887,6 +2006,42 @@ Node::createAccel(void)
     return 0;
 }
 
+// setStateVectors():
+// private method to point the Vector objects for the response quantities
+// at the disp, vel and accel arrays, creating them if needed.
+
+void
+Node::setStateVectors(void)
+{
+  if (trialDisp == 0) {
+    trialDisp = new Vector(disp, numberDOF);
+    commitDisp = new Vector(&disp[stateStride], numberDOF);
+    incrDisp = new Vector(&disp[2*stateStride], numberDOF);
+    incrDeltaDisp = new Vector(&disp[3*stateStride], numberDOF);
+  } else {
+    trialDisp->setData(disp, numberDOF);
+    commitDisp->setData(&disp[stateStride], numberDOF);
+    incrDisp->setData(&disp[2*stateStride], numberDOF);
+    incrDeltaDisp->setData(&disp[3*stateStride], numberDOF);
+  }
+
+  if (trialVel == 0) {
+    trialVel = new Vector(vel, numberDOF);
+    commitVel = new Vector(&vel[stateStride], numberDOF);
+  } else {
+    trialVel->setData(vel, numberDOF);
+    commitVel->setData(&vel[stateStride], numberDOF);
+  }
+
+  if (trialAccel == 0) {
+    trialAccel = new Vector(accel, numberDOF);
+    commitAccel = new Vector(&accel[stateStride], numberDOF);
+  } else {
+    trialAccel->setData(accel, numberDOF);
+    commitAccel->setData(&accel[stateStride], numberDOF);
+  }
+}
+
 
 // AddingSensitivity:BEGIN ///////////////////////////////////////
 
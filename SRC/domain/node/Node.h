@@ -50,6 +50,7 @@ namespace OpenSees {struct Versor;}
 using OpenSees::Versor;
 
 class DOF_Group;
+class NodalStateStore;
 class NodalThermalAction; //L.Jiang [ SIF ]
 
 class Node : public DomainComponent
@@ -112,6 +113,16 @@ class Node : public DomainComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // public methods used by a NodalStateStore holding the response
+    // arrays; the arrays hold the trial, committed, ... values for
+    // each quantity in blocks of stride values
+    int setStateStorage(NodalStateStore *theStore, double *theDisp,
+			double *theVel, double *theAccel, int stride);
+    int releaseStateStorage(void);
+    NodalStateStore *getStateStore(void);
+    int commitRotation(void);
+    int revertRotation(void);
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void);
     virtual int setMass(const Matrix &theMass);
@@ -179,6 +190,7 @@ class Node : public DomainComponent
     int createDisp(void);
     int createVel(void);
     int createAccel(void); 
+    void setStateVectors(void);
 
     // private method to set up global matrices
     int setGlobalMatrices();
@@ -196,6 +208,8 @@ class Node : public DomainComponent
     
     double *disp, *vel, *accel; // double arrays holding the displ, 
                                 // vel and accel values
+    int stateStride;                  // offset between the trial, committed, ..
+    NodalStateStore *theStateStore;   // store owning the arrays, 0 if node owns them
 
     int dbTag1, dbTag2, dbTag3, dbTag4; // needed for database
     Matrix *R;                          // nodal participation matrix
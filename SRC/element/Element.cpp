@@ -43,13 +43,10 @@
 #include <Matrix.h>
 #include <Node.h>
 #include <Domain.h>
+#include <FE_Workspace.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element  *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -122,65 +119,10 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
 
   // check that memory has been allocated to store compute/return
   // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
+  // the damping matrix & residual force calculations use the objects
+  // of the thread's FE_Workspace with the size of the element
+  if (index == -1)
+    index = this->getNumDOF();
 
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
@@ -215,7 +157,7 @@ Element::getDamp(void)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index); 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -240,7 +182,7 @@ Element::getMass(void)
   }
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index); 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -252,9 +194,9 @@ Element::getResistingForceIncInertia(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index); 
+  Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::Element_Vector2, index);
+  Vector *theVector2 = &FE_Workspace::getWorkspace().getVector(FE_Workspace::Element_Vector1, index);
 
   //
   // perform: R = P(U) - Pext(t);
@@ -319,9 +261,9 @@ Element::getRayleighDampingForces(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index); 
+  Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::Element_Vector2, index);
+  Vector *theVector2 = &FE_Workspace::getWorkspace().getVector(FE_Workspace::Element_Vector1, index);
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -415,6 +357,17 @@ Element::isSubdomain(void)
     return false;
 }
 
+// isThreadSafe():
+//	returns true if update(), getTangentStiff(), getResistingForce(),
+//	commitState() and revertToLastCommit() may be invoked on different
+//	elements of the class at the same time, i.e. neither the class nor
+//	its materials keep shared scratch matrices or vectors.
+bool
+Element::isThreadSafe(void)
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -512,7 +465,7 @@ Element::getResistingForceSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::Element_Vector1, index);
   theVector->Zero();
 
   return *theVector;
@@ -531,7 +484,7 @@ Element::getTangentStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index);
   theMatrix->Zero();
 
   return *theMatrix;
@@ -551,7 +504,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index);
   theMatrix->Zero();
 
   return *theMatrix;
@@ -570,7 +523,7 @@ Element::getCommittedStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index);
   theMatrix->Zero();
 
   return *theMatrix;
@@ -583,7 +536,7 @@ Element::getMassSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index);
   theMatrix->Zero();
 
   return *theMatrix;
@@ -614,7 +567,7 @@ Element::getDampSensitivity(int gradIndex)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index); 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
@@ -773,7 +726,7 @@ Element::getGeometricTangentStiff()
 	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
     }
     
-    Matrix *theMatrix = theMatrices[index];
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::Element_Matrix, index);
     theMatrix->Zero();
     
     return *theMatrix;
@@ -67,6 +67,7 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void);
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -133,12 +134,7 @@ protected:
     Matrix **previousK;
     int numPreviousK;
 
-    int index, nodeIndex;
-
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    int index, nodeIndex; // index: size of the FE_Workspace objects, -1 until set
 
     bool is_this_element_active;
 
@@ -447,6 +447,12 @@ SSPbrick::update(void)
 	return 0;
 }
 
+bool
+SSPbrick::isThreadSafe(void)
+{
+	return theMaterial->isThreadSafe();
+}
+
 const Matrix &
 SSPbrick::getTangentStiff(void)
 // this function computes the tangent stiffness matrix for the element
@@ -557,7 +563,7 @@ SSPbrick::addInertiaLoadToUnbalance(const Vector &accel)
 	const Vector &Raccel7 = theNodes[6]->getRV(accel);
 	const Vector &Raccel8 = theNodes[7]->getRV(accel);
 
-	static double ra[24];
+	static thread_local double ra[24];
 	ra[0] =  Raccel1(0);
 	ra[1] =  Raccel1(1);
 	ra[2] =  Raccel1(2);
@@ -701,7 +707,7 @@ SSPbrick::getResistingForceIncInertia()
   const Vector &accel7 = theNodes[6]->getTrialAccel();
   const Vector &accel8 = theNodes[7]->getTrialAccel();
   
-  static double a[24];
+  static thread_local double a[24];
   a[0] =  accel1(0);
   a[1] =  accel1(1);
   a[2] =  accel1(2);
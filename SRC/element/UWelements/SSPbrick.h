@@ -67,6 +67,7 @@ class SSPbrick : public Element
 	int revertToLastCommit(void);
 	int revertToStart(void);
 	int update(void);
+	bool isThreadSafe(void);
 
 	// public methods to obtain stiffness, mass, damping, and residual info
 	const Matrix &getTangentStiff(void);
@@ -428,6 +428,12 @@ SSPquad::update(void)
 	return 0;
 }
 
+bool
+SSPquad::isThreadSafe(void)
+{
+	return theMaterial->isThreadSafe();
+}
+
 const Matrix &
 SSPquad::getTangentStiff(void)
 // this function computes the tangent stiffness matrix for the element
@@ -532,7 +538,7 @@ SSPquad::addInertiaLoadToUnbalance(const Vector &accel)
     	return -1;
 	}
 
-	static double ra[8];
+	static thread_local double ra[8];
 	ra[0] = Raccel1(0);
 	ra[1] = Raccel1(1);
 	ra[2] = Raccel2(0);
@@ -628,7 +634,7 @@ SSPquad::getResistingForceIncInertia()
 	const Vector &accel3 = theNodes[2]->getTrialAccel();
 	const Vector &accel4 = theNodes[3]->getTrialAccel();
 	
-	static double a[8];
+	static thread_local double a[8];
 	a[0] = accel1(0);
 	a[1] = accel1(1);
 	a[2] = accel2(0);
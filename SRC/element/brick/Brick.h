@@ -96,6 +96,9 @@ class Brick : public Element {
     // update
     int update(void);
 
+    // true if the materials are thread safe
+    bool isThreadSafe(void);
+
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
 	
@@ -151,9 +154,9 @@ class Brick : public Element {
     // static attributes
     //
 
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
     static Matrix damping ;
 
     //quadrature data
@@ -163,7 +166,7 @@ class Brick : public Element {
     static const double wg[8] ;
   
     //local nodal coordinates, three coordinates for each of four nodes
-    static double xl[3][8] ; 
+    static thread_local double xl[3][8] ; 
 
     //
     // private methods
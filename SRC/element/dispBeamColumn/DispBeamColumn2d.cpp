@@ -51,9 +51,9 @@
 #include <map>
 #include <ElementIter.h>
 
-Matrix DispBeamColumn2d::K(6,6);
-Vector DispBeamColumn2d::P(6);
-double DispBeamColumn2d::workArea[100];
+thread_local Matrix DispBeamColumn2d::K(6,6);
+thread_local Vector DispBeamColumn2d::P(6);
+thread_local double DispBeamColumn2d::workArea[100];
 
 void* OPS_DispBeamColumn2d()
 {
@@ -756,10 +756,27 @@ DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial)
   }
 }
 
+bool
+DispBeamColumn2d::isThreadSafe(void)
+{
+  // the damping objects are not audited
+  if (theDamping != 0)
+    return false;
+
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 const Matrix&
 DispBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   this->getBasicStiff(kb);
 
@@ -820,7 +837,7 @@ DispBeamColumn2d::getTangentStiff()
 const Matrix&
 DispBeamColumn2d::getInitialStiff()
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
   this->getBasicStiff(kb, 1);
   if(theDamping) kb *= theDamping->getStiffnessMultiplier();
 
@@ -845,7 +862,7 @@ DispBeamColumn2d::getMass()
     K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(6,6);
+    static thread_local Matrix ml(6,6);
     double m = rho*L/420.0;
     ml(0,0) = ml(3,3) = m*140.0;
     ml(0,3) = ml(3,0) = m*70.0;
@@ -985,7 +1002,7 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m*Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -1092,7 +1109,7 @@ DispBeamColumn2d::getResistingForceIncInertia()
     P(4) += m*accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -76,6 +76,7 @@ class DispBeamColumn2d : public Element
 
     // public methods to obtain stiffness, mass, damping and residual information    
     int update(void);
+    bool isThreadSafe(void);
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);
@@ -124,8 +125,8 @@ class DispBeamColumn2d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
@@ -139,7 +140,7 @@ class DispBeamColumn2d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[];
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
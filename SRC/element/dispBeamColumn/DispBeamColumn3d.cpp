@@ -49,9 +49,9 @@
 #include <elementAPI.h>
 #include <string>
 
-Matrix DispBeamColumn3d::K(12,12);
-Vector DispBeamColumn3d::P(12);
-double DispBeamColumn3d::workArea[200];
+thread_local Matrix DispBeamColumn3d::K(12,12);
+thread_local Vector DispBeamColumn3d::P(12);
+thread_local double DispBeamColumn3d::workArea[200];
 
 void* OPS_DispBeamColumn3d()
 {
@@ -616,10 +616,27 @@ DispBeamColumn3d::update(void)
   return 0;
 }
 
+bool
+DispBeamColumn3d::isThreadSafe(void)
+{
+  // the damping objects are not audited
+  if (theDamping != 0)
+    return false;
+
+  if (crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 const Matrix&
 DispBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -848,7 +865,7 @@ DispBeamColumn3d::getBasicStiff(Matrix &kb, int initial)
 const Matrix&
 DispBeamColumn3d::getInitialStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
 
   this->getBasicStiff(kb, 1);
 
@@ -873,7 +890,7 @@ DispBeamColumn3d::getMass()
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static thread_local Matrix ml(12,12);
     double m = rho*L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
     ml(0,6) = ml(6,0) = m*70.0;
@@ -1037,7 +1054,7 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
 
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -1151,7 +1168,7 @@ DispBeamColumn3d::getResistingForceIncInertia()
     P(8) += m*accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -55,9 +55,9 @@
 
 #include <map>
 
-Matrix ElasticBeam2d::K(6,6);
-Vector ElasticBeam2d::P(6);
-Matrix ElasticBeam2d::kb(3,3);
+thread_local Matrix ElasticBeam2d::K(6,6);
+thread_local Vector ElasticBeam2d::P(6);
+thread_local Matrix ElasticBeam2d::kb(3,3);
 
 void *OPS_ElasticBeam2d(const ID &info) {
     /*!
@@ -664,6 +664,16 @@ ElasticBeam2d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam2d::isThreadSafe(void)
+{
+  // the damping objects are not audited
+  if (theDamping != 0)
+    return false;
+
+  return theCoordTransf->isThreadSafe();
+}
+
 const Matrix &
 ElasticBeam2d::getTangentStiff(void)
 {
@@ -753,7 +763,7 @@ ElasticBeam2d::getMass(void)
             K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            static thread_local Matrix ml(6,6);
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -982,7 +992,7 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -1026,7 +1036,7 @@ ElasticBeam2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -51,9 +51,9 @@
 #include <string>
 #include <elementAPI.h>
 
-Matrix ElasticBeam3d::K(12,12);
-Vector ElasticBeam3d::P(12);
-Matrix ElasticBeam3d::kb(6,6);
+thread_local Matrix ElasticBeam3d::K(12,12);
+thread_local Vector ElasticBeam3d::P(12);
+thread_local Matrix ElasticBeam3d::kb(6,6);
 
 void* OPS_ElasticBeam3d(void)
 {
@@ -658,6 +658,16 @@ ElasticBeam3d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam3d::isThreadSafe(void)
+{
+  // the damping objects are not audited
+  if (theDamping != 0)
+    return false;
+
+  return theCoordTransf->isThreadSafe();
+}
+
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
@@ -800,7 +810,7 @@ ElasticBeam3d::getMass(void)
             K(8,8) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(12,12);
+            static thread_local Matrix ml(12,12);
             double m = rho*L/420.0;
             ml(0,0) = ml(6,6) = m*140.0;
             ml(0,6) = ml(6,0) = m*70.0;
@@ -1032,7 +1042,7 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m * Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -1077,7 +1087,7 @@ ElasticBeam3d::getResistingForceIncInertia()
     P(8) += m * accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
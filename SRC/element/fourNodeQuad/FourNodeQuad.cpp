@@ -280,10 +280,10 @@ void *OPS_FourNodeQuad(const ID &info) {
     return 0;
 }
 
-double FourNodeQuad::matrixData[64];
-Matrix FourNodeQuad::K(matrixData, 8, 8);
-Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
+thread_local double FourNodeQuad::matrixData[64];
+thread_local Matrix FourNodeQuad::K(matrixData, 8, 8);
+thread_local Vector FourNodeQuad::P(8);
+thread_local double FourNodeQuad::shp[3][4];
 double FourNodeQuad::pts[4][2];
 double FourNodeQuad::wts[4];
 
@@ -580,7 +580,7 @@ FourNodeQuad::update()
 	const Vector &disp3 = theNodes[2]->getTrialDisp();
 	const Vector &disp4 = theNodes[3]->getTrialDisp();
 	
-	static double u[2][4];
+	static thread_local double u[2][4];
 
 	u[0][0] = disp1(0);
 	u[1][0] = disp1(1);
@@ -591,7 +591,7 @@ FourNodeQuad::update()
 	u[0][3] = disp4(0);
 	u[1][3] = disp4(1);
 
-	static Vector eps(3);
+	static thread_local Vector eps(3);
 
 	int ret = 0;
 
@@ -619,10 +619,25 @@ FourNodeQuad::update()
 }
 
 
+bool
+FourNodeQuad::isThreadSafe()
+{
+  for (int i = 0; i < 4; i++) {
+    // the damping objects are not audited
+    if (theDamping[i] != 0)
+      return false;
+    if (theMaterial[i]->isThreadSafe() == false)
+      return false;
+  }
+
+  return true;
+}
+
+
 const Matrix&
 FourNodeQuad::getTangentStiff()
 {
-  static Matrix D(3,3);
+  static thread_local Matrix D(3,3);
 
 	K.Zero();
 
@@ -683,7 +698,7 @@ FourNodeQuad::getTangentStiff()
 const Matrix&
 FourNodeQuad::getInitialStiff()
 {
-  static Matrix D(3,3);
+  static thread_local Matrix D(3,3);
   if (Ki != 0)
     return *Ki;
 
@@ -741,7 +756,7 @@ FourNodeQuad::getMass()
 	K.Zero();
 
 	int i;
-	static double rhoi[4];
+	static thread_local double rhoi[4];
 	double sum = 0.0;
 	for (i = 0; i < 4; i++) {
 	  if (rho == 0)
@@ -813,7 +828,7 @@ int
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     if (rho == 0)
@@ -838,7 +853,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
   
-  static double ra[8];
+  static thread_local double ra[8];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -863,7 +878,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector&
 FourNodeQuad::getResistingForce()
 {
-  static Vector sigma(3);
+  static thread_local Vector sigma(3);
 	P.Zero();
 
 	double dvol;
@@ -923,7 +938,7 @@ const Vector&
 FourNodeQuad::getResistingForceIncInertia()
 {
 	int i;
-	static double rhoi[4];
+	static thread_local double rhoi[4];
 	double sum = 0.0;
 	for (i = 0; i < 4; i++) {
 	  if (rho == 0)
@@ -949,7 +964,7 @@ FourNodeQuad::getResistingForceIncInertia()
 	const Vector &accel3 = theNodes[2]->getTrialAccel();
 	const Vector &accel4 = theNodes[3]->getTrialAccel();
 	
-	static double a[8];
+	static thread_local double a[8];
 
 	a[0] = accel1(0);
 	a[1] = accel1(1);
@@ -72,6 +72,7 @@ class FourNodeQuad : public Element
     int revertToLastCommit(void);
     int revertToStart(void);
     int update(void);
+    bool isThreadSafe(void);
 
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getTangentStiff(void);
@@ -117,9 +118,9 @@ class FourNodeQuad : public Element
 
     Node *theNodes[4];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local double matrixData[64];  // array data for matrix
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
     Vector Q;		        // Applied nodal loads
     double b[2];		// Body forces
 
@@ -132,7 +133,7 @@ class FourNodeQuad : public Element
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
     double rho;
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shp[3][4];	// Stores shape functions and derivatives (overwritten)
     static double pts[4][2];	// Stores quadrature points
     static double wts[4];		// Stores quadrature weights
 
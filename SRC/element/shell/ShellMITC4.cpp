@@ -206,9 +206,9 @@ OPS_ShellMITC4(const ID& info)
 
 
 //static data
-Matrix  ShellMITC4::stiff(24,24) ;
-Vector  ShellMITC4::resid(24) ;
-Matrix  ShellMITC4::mass(24,24) ;
+thread_local Matrix  ShellMITC4::stiff(24,24) ;
+thread_local Vector  ShellMITC4::resid(24) ;
+thread_local Matrix  ShellMITC4::mass(24,24) ;
 
 //quadrature data
 const double  ShellMITC4::root3 = sqrt(3.0) ;
@@ -810,6 +810,20 @@ ShellMITC4::setParameter(const char **argv, int argc, Parameter &param)
   return res;
 }
 
+//return true if the sections are thread safe
+bool  ShellMITC4::isThreadSafe( )
+{
+  for ( int i = 0; i < 4; i++ ) {
+    // the damping objects are not audited
+    if ( theDamping[i] != 0 )
+      return false ;
+    if ( materialPointers[i]->isThreadSafe() == false )
+      return false ;
+  }
+
+  return true ;
+}
+
 //return stiffness matrix 
 const Matrix&  ShellMITC4::getTangentStiff( ) 
 {
@@ -840,47 +854,47 @@ const Matrix&  ShellMITC4::getInitialStiff( )
 
   double volume = 0.0 ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  static thread_local double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  static thread_local double dvol[ngauss] ; //volume element
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  static thread_local double shp[3][numnodes] ;  //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
-  static Matrix J0(2,2) ;  //Jacobian at center
+  static thread_local Matrix J0(2,2) ;  //Jacobian at center
  
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  static thread_local Matrix J0inv(2,2) ; //inverse of Jacobian at center
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    static thread_local Matrix Bbend(3,3) ;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    static thread_local Matrix Bshear(2,3) ; // shear B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    static thread_local Matrix Bmembrane(3,2) ; // membrane B matrix
 
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    static thread_local double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    static thread_local double BdrillK[ndf] ;  
 
     double *drillPointer ;
 
-    static double saveB[nstress][ndf][numnodes] ;
+    static thread_local double saveB[nstress][ndf][numnodes] ;
 
   //-------------------------------------------------------
 
@@ -1156,7 +1170,7 @@ int
 ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int tangFlag = 1 ;
-  static Vector r(24);
+  static thread_local Vector r(24);
 
   int i;
 
@@ -1206,7 +1220,7 @@ const Vector&  ShellMITC4::getResistingForce( )
 //get residual with inertia terms
 const Vector&  ShellMITC4::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
   int tang_flag = 0 ; //don't get the tangent
 
   //do tangent and residual here 
@@ -1251,9 +1265,9 @@ ShellMITC4::formInertiaTerms( int tangFlag )
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
 
   int i, j, k, p;
@@ -1382,29 +1396,29 @@ ShellMITC4::formResidAndTangent( int tang_flag )
   
   double volume = 0.0 ;
 
-  static double xsj ;  // determinant jacaobian matrix 
+  static thread_local double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  static thread_local double dvol[ngauss] ; //volume element
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  static thread_local double shp[3][numnodes] ;  //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  static thread_local Vector residJ(ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress resultants
+  static thread_local Vector stress(nstress) ;  //stress resultants
 
-  static Vector dampingStress(nstress); // damping stress resultants
+  static thread_local Vector dampingStress(nstress); // damping stress resultants
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
-  static Matrix J0(2,2) ;  //Jacobian at center
+  static thread_local Matrix J0(2,2) ;  //Jacobian at center
  
-  static Matrix J0inv(2,2) ; //inverse of Jacobian at center
+  static thread_local Matrix J0inv(2,2) ; //inverse of Jacobian at center
 
   double epsDrill = 0.0 ;  //drilling "strain"
 
@@ -1412,29 +1426,29 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    static thread_local Matrix Bbend(3,3) ;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    static thread_local Matrix Bshear(2,3) ; // shear B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    static thread_local Matrix Bmembrane(3,2) ; // membrane B matrix
 
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    static thread_local double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    static thread_local double BdrillK[ndf] ;  
 
     double *drillPointer ;
 
-    static double saveB[nstress][ndf][numnodes] ;
+    static thread_local double saveB[nstress][ndf][numnodes] ;
 
   //------------------------------------------------------- 
 
@@ -1574,7 +1588,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
 
       //nodal "displacements" 
       const Vector &ul_tmp = nodePointers[j]->getTrialDisp( ) ;
-      static Vector ul(6); ul.Zero();
+      static thread_local Vector ul(6); ul.Zero();
 
       ul(0) = ul_tmp(0) - init_disp[j][0];
       ul(1) = ul_tmp(1) - init_disp[j][1];
@@ -1718,7 +1732,7 @@ ShellMITC4::formResidAndTangent( int tang_flag )
       const int massIndex = nShape - 1 ;
       double temp, rhoH;
       //If defined, apply self-weight
-      static Vector momentum(ndf) ;
+      static thread_local Vector momentum(ndf) ;
       double ddvol = 0;
       for ( i = 0; i < numberGauss; i++ ) {
 
@@ -1768,11 +1782,11 @@ ShellMITC4::computeBasis( )
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  static thread_local Vector temp(3) ;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  static thread_local Vector v1(3) ;
+  static thread_local Vector v2(3) ;
+  static thread_local Vector v3(3) ;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1856,11 +1870,11 @@ ShellMITC4::updateBasis( )
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  static thread_local Vector temp(3) ;
 
-  static Vector v1(3) ;
-  static Vector v2(3) ;
-  static Vector v3(3) ;
+  static thread_local Vector v1(3) ;
+  static thread_local Vector v2(3) ;
+  static thread_local Vector v3(3) ;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1947,10 +1961,10 @@ ShellMITC4::computeBdrill( int node, const double shp[3][4] )
 {
 
   //static Matrix Bdrill(1,6) ;
-  static double Bdrill[6] ;
-  static double B1 ;
-  static double B2 ;
-  static double B6 ;
+  static thread_local double Bdrill[6] ;
+  static thread_local double B1 ;
+  static thread_local double B2 ;
+  static thread_local double B6 ;
 
 
 //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
@@ -2005,17 +2019,17 @@ ShellMITC4::assembleB( const Matrix &Bmembrane,
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
 
-    static Matrix B(8,6) ;
+    static thread_local Matrix B(8,6) ;
 
-    static Matrix BmembraneShell(3,3) ; 
+    static thread_local Matrix BmembraneShell(3,3) ; 
     
-    static Matrix BbendShell(3,3) ; 
+    static thread_local Matrix BbendShell(3,3) ; 
 
-    static Matrix BshearShell(2,6) ;
+    static thread_local Matrix BshearShell(2,6) ;
  
-    static Matrix Gmem(2,3) ;
+    static thread_local Matrix Gmem(2,3) ;
 
-    static Matrix Gshear(3,6) ;
+    static thread_local Matrix Gshear(3,6) ;
 
     int p, q ;
     int pp ;
@@ -2122,7 +2136,7 @@ const Matrix&
 ShellMITC4::computeBmembrane( int node, const double shp[3][4] ) 
 {
 
-  static Matrix Bmembrane(3,2) ;
+  static thread_local Matrix Bmembrane(3,2) ;
 
 //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -2153,7 +2167,7 @@ const Matrix&
 ShellMITC4::computeBbend( int node, const double shp[3][4] )
 {
 
-    static Matrix Bbend(3,2) ;
+    static thread_local Matrix Bbend(3,2) ;
 
 //---Bbend Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -2196,8 +2210,8 @@ ShellMITC4::shape2d( double ss, double tt,
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static double xs[2][2] ;
-  static double sx[2][2] ;
+  static thread_local double xs[2][2] ;
+  static thread_local double sx[2][2] ;
 
   for ( i = 0; i < 4; i++ ) {
       shp[2][i] = ( 0.5 + s[i]*ss )*( 0.5 + t[i]*tt ) ;
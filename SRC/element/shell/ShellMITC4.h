@@ -92,6 +92,9 @@ class ShellMITC4 : public Element {
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
 	
+    //true if the sections are thread safe
+    bool isThreadSafe( ) ;
+
     //return stiffness matrix 
     const Matrix &getTangentStiff( ) ;
     const Matrix &getInitialStiff( );
@@ -125,9 +128,9 @@ class ShellMITC4 : public Element {
   private : 
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
     static Matrix damping ;
 
     //quadrature data
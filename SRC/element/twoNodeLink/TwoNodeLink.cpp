@@ -35,6 +35,7 @@
 #include <Information.h>
 #include <ElementResponse.h>
 #include <UniaxialMaterial.h>
+#include <FE_Workspace.h>
 
 #include <float.h>
 #include <math.h>
@@ -44,16 +45,6 @@
 #include <elementAPI.h>
 #include <vector>
 
-// initialize the class wide variables
-Matrix TwoNodeLink::TwoNodeLinkM2(2,2);
-Matrix TwoNodeLink::TwoNodeLinkM4(4,4);
-Matrix TwoNodeLink::TwoNodeLinkM6(6,6);
-Matrix TwoNodeLink::TwoNodeLinkM12(12,12);
-Vector TwoNodeLink::TwoNodeLinkV2(2);
-Vector TwoNodeLink::TwoNodeLinkV4(4);
-Vector TwoNodeLink::TwoNodeLinkV6(6);
-Vector TwoNodeLink::TwoNodeLinkV12(12);
-
 void* OPS_TwoNodeLink()
 {
     int ndm = OPS_GetNDM();
@@ -261,7 +252,7 @@ TwoNodeLink::TwoNodeLink(int tag, int dim, int Nd1, int Nd2,
     theMaterials(0), numDIR(direction.Size()), dir(0), trans(3,3),
     x(_x), y(_y), Mratio(Mr), shearDistI(sdI), addRayleigh(addRay),
     mass(m), L(0.0), onP0(true), ub(0), ubdot(0), qb(0), ul(0),
-    Tgl(0,0), Tlb(0,0), theMatrix(0), theVector(0), theLoad(0)
+    Tgl(0,0), Tlb(0,0), theLoad(0)
 {
     // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 2)  {
@@ -413,7 +404,7 @@ TwoNodeLink::TwoNodeLink()
     theMaterials(0), numDIR(0), dir(0), trans(3,3), x(3), y(3),
     Mratio(0), shearDistI(0), addRayleigh(0), mass(0.0), L(0.0),
     onP0(false), ub(0), ubdot(0), qb(0), ul(0), Tgl(0,0), Tlb(0,0),
-    theMatrix(0), theVector(0), theLoad(0)
+    theLoad(0)
 {
     // ensure the connectedExternalNode ID is of correct size
     if (connectedExternalNodes.Size() != 2)  {
@@ -485,8 +476,6 @@ void TwoNodeLink::setDomain(Domain *theDomain)
     
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &TwoNodeLinkM2;
-    theVector = &TwoNodeLinkV2;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -522,35 +511,25 @@ void TwoNodeLink::setDomain(Domain *theDomain)
     // call the base class method
     this->DomainComponent::setDomain(theDomain);
     
-    // now set the number of dof for element and set matrix and vector pointer
+    // now set the number of dof for element
     if (numDIM == 1 && dofNd1 == 1)  {
         numDOF = 2;
-        theMatrix = &TwoNodeLinkM2;
-        theVector = &TwoNodeLinkV2;
         elemType  = D1N2;
     }
     else if (numDIM == 2 && dofNd1 == 2)  {
         numDOF = 4;
-        theMatrix = &TwoNodeLinkM4;
-        theVector = &TwoNodeLinkV4;
         elemType  = D2N4;
     }
     else if (numDIM == 2 && dofNd1 == 3)  {
         numDOF = 6;
-        theMatrix = &TwoNodeLinkM6;
-        theVector = &TwoNodeLinkV6;
         elemType  = D2N6;
     }
     else if (numDIM == 3 && dofNd1 == 3)  {
         numDOF = 6;
-        theMatrix = &TwoNodeLinkM6;
-        theVector = &TwoNodeLinkV6;
         elemType  = D3N6;
     }
     else if (numDIM == 3 && dofNd1 == 6)  {
         numDOF = 12;
-        theMatrix = &TwoNodeLinkM12;
-        theVector = &TwoNodeLinkV12;
         elemType  = D3N12;
     }
     else  {
@@ -666,8 +645,19 @@ int TwoNodeLink::update()
 }
 
 
+bool TwoNodeLink::isThreadSafe()
+{
+    for (int i=0; i<numDIR; i++)
+        if (theMaterials[i]->isThreadSafe() == false)
+            return false;
+    
+    return true;
+}
+
+
 const Matrix& TwoNodeLink::getTangentStiff()
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::TwoNodeLink_Tangent, numDOF);
     // zero the matrix
     theMatrix->Zero();
     
@@ -698,6 +688,7 @@ const Matrix& TwoNodeLink::getTangentStiff()
 
 const Matrix& TwoNodeLink::getInitialStiff()
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::TwoNodeLink_Tangent, numDOF);
     // zero the matrix
     theMatrix->Zero();
     
@@ -723,6 +714,7 @@ const Matrix& TwoNodeLink::getInitialStiff()
 
 const Matrix& TwoNodeLink::getDamp()
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::TwoNodeLink_Tangent, numDOF);
     // zero the matrix
     theMatrix->Zero();
     
@@ -755,6 +747,7 @@ const Matrix& TwoNodeLink::getDamp()
 
 const Matrix& TwoNodeLink::getMass()
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::TwoNodeLink_Tangent, numDOF);
     // zero the matrix
     theMatrix->Zero();
     
@@ -820,6 +813,7 @@ int TwoNodeLink::addInertiaLoadToUnbalance(const Vector &accel)
 
 const Vector& TwoNodeLink::getResistingForce()
 {
+    Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::TwoNodeLink_Residual, numDOF);
     // zero the residual
     theVector->Zero();
     
@@ -844,6 +838,7 @@ const Vector& TwoNodeLink::getResistingForce()
 
 const Vector& TwoNodeLink::getResistingForceIncInertia()
 {
+    Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::TwoNodeLink_Residual, numDOF);
     // this already includes damping force from materials
     this->getResistingForce();
     
@@ -1180,6 +1175,7 @@ void TwoNodeLink::Print(OPS_Stream &s, int flag)
 Response* TwoNodeLink::setResponse(const char **argv, int argc,
     OPS_Stream &output)
 {
+    Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::TwoNodeLink_Residual, numDOF);
     Response *theResponse = 0;
     
     output.tag("ElementOutput");
@@ -1288,6 +1284,7 @@ Response* TwoNodeLink::setResponse(const char **argv, int argc,
 
 int TwoNodeLink::getResponse(int responseID, Information &eleInfo)
 {
+    Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::TwoNodeLink_Residual, numDOF);
     Vector defoAndForce(numDIR*2);
     Vector &theVec = *(eleInfo.theVector);
     ID &theID = *(eleInfo.theID);    
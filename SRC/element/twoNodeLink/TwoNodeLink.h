@@ -66,6 +66,7 @@ public:
     int revertToLastCommit();
     int revertToStart();
     int update();
+    bool isThreadSafe();
     
     // public methods to obtain stiffness,
     // mass, damping and residual information
@@ -133,19 +134,7 @@ private:
     Matrix Tgl;         // transformation matrix from global to local system
     Matrix Tlb;         // transformation matrix from local to basic system
     
-    Matrix *theMatrix;  // pointer to objects matrix (a class wide Matrix)
-    Vector *theVector;  // pointer to objects vector (a class wide Vector)
     Vector *theLoad;    // pointer to the load vector
-    
-    // static data - single copy for all objects of the class
-    static Matrix TwoNodeLinkM2;   // class wide matrix for 2*2
-    static Matrix TwoNodeLinkM4;   // class wide matrix for 4*4
-    static Matrix TwoNodeLinkM6;   // class wide matrix for 6*6
-    static Matrix TwoNodeLinkM12;  // class wide matrix for 12*12
-    static Vector TwoNodeLinkV2;   // class wide Vector for size 2
-    static Vector TwoNodeLinkV4;   // class wide Vector for size 4
-    static Vector TwoNodeLinkV6;   // class wide Vector for size 6
-    static Vector TwoNodeLinkV12;  // class wide Vector for size 12
 };
 
 #endif
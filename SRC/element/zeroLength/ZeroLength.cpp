@@ -39,6 +39,7 @@
 #include <FEM_ObjectBroker.h>
 #include <UniaxialMaterial.h>
 #include <Renderer.h>
+#include <FE_Workspace.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -48,16 +49,6 @@
 #include <elementAPI.h>
 #include <vector>
 
-// initialise the class wide variables
-Matrix ZeroLength::ZeroLengthM2(2,2);
-Matrix ZeroLength::ZeroLengthM4(4,4);
-Matrix ZeroLength::ZeroLengthM6(6,6);
-Matrix ZeroLength::ZeroLengthM12(12,12);
-Vector ZeroLength::ZeroLengthV2(2);
-Vector ZeroLength::ZeroLengthV4(4);
-Vector ZeroLength::ZeroLengthV6(6);
-Vector ZeroLength::ZeroLengthV12(12);
-
 void* OPS_ZeroLength()
 {
     int ndm = OPS_GetNDM();
@@ -280,7 +271,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-  theMatrix(0), theVector(0),
   numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0),
   theDamping(0), fd(0)
 {
@@ -325,7 +315,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(2),
-  theMatrix(0), theVector(0),
   numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0),
   theDamping(0), fd(0)
 {
@@ -378,7 +367,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-  theMatrix(0), theVector(0),
   numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0),
   theDamping(0), fd(0)
 {
@@ -440,7 +428,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-  theMatrix(0), theVector(0),
   numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0),
   theDamping(0), fd(0)
 {
@@ -487,7 +474,6 @@ ZeroLength::ZeroLength(void)
   :Element(0,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(0), numDOF(0), transformation(3,3),
-  theMatrix(0), theVector(0),
   numMaterials1d(0), theMaterial1d(0),
   dir1d(0), t1d(0), d0(0), v0(0),
   theDamping(0), fd(0)
@@ -586,8 +572,6 @@ ZeroLength::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &ZeroLengthM2;
-    theVector = &ZeroLengthV2;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -637,35 +621,25 @@ ZeroLength::setDomain(Domain *theDomain)
     // call the base class method
     this->DomainComponent::setDomain(theDomain);
     
-    // set the number of dof for element and set matrix and vector pointer
+    // set the number of dof for element
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &ZeroLengthM2;
-	theVector = &ZeroLengthV2;
 	elemType  = D1N2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &ZeroLengthM4;
-	theVector = &ZeroLengthV4;
 	elemType  = D2N4;
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
 	elemType  = D2N6;
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
 	elemType  = D3N6;
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &ZeroLengthM12;
-	theVector = &ZeroLengthV12;
 	elemType  = D3N12;
     }
     else {
@@ -834,9 +808,28 @@ ZeroLength::update(void)
     return ret;
 }
 
+bool
+ZeroLength::isThreadSafe(void)
+{
+    // the damping objects are not audited
+    if (theDamping != 0)
+      return false;
+
+    int numMaterials = numMaterials1d;
+    if (useRayleighDamping == 2)
+      numMaterials *= 2;
+
+    for (int mat=0; mat<numMaterials; mat++)
+      if (theMaterial1d[mat]->isThreadSafe() == false)
+	return false;
+
+    return true;
+}
+
 const Matrix &
 ZeroLength::getTangentStiff(void)
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::ZeroLength_Tangent, numDOF);
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
@@ -875,6 +868,7 @@ ZeroLength::getTangentStiff(void)
 const Matrix &
 ZeroLength::getInitialStiff(void)
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::ZeroLength_Tangent, numDOF);
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
@@ -913,6 +907,7 @@ ZeroLength::getInitialStiff(void)
 const Matrix &
 ZeroLength::getDamp(void)
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::ZeroLength_Tangent, numDOF);
     // damp is a reference to the matrix holding the damping matrix
     Matrix& damp = *theMatrix;
 
@@ -971,6 +966,7 @@ ZeroLength::getDamp(void)
 const Matrix &
 ZeroLength::getMass(void)
 {
+  Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::ZeroLength_Tangent, numDOF);
   // no mass 
   theMatrix->Zero();    
   return *theMatrix; 
@@ -1002,6 +998,7 @@ ZeroLength::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ZeroLength::getResistingForce()
 {
+  Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::ZeroLength_Residual, numDOF);
   double force;
   
   // zero the residual
@@ -1050,6 +1047,7 @@ ZeroLength::getDampingForce()
 const Vector &
 ZeroLength::getResistingForceIncInertia()
 {	
+  Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::ZeroLength_Residual, numDOF);
   // this already includes damping forces from materials
   this->getResistingForce();
   
@@ -1358,6 +1356,7 @@ ZeroLength::displaySelf(Renderer &theViewer, int displayMode, float fact, const
 void
 ZeroLength::Print(OPS_Stream &s, int flag)
 {
+    Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::ZeroLength_Residual, numDOF);
     // compute the strain and axial force in the member
     double strain=0.0;
     double force =0.0;
@@ -1572,6 +1571,7 @@ ZeroLength::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ZeroLength::getResponse(int responseID, Information &eleInformation)
 {
+    Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::ZeroLength_Residual, numDOF);
     const Vector& disp1 = theNodes[0]->getTrialDisp();
     const Vector& disp2 = theNodes[1]->getTrialDisp();
     const Vector  diff  = disp2-disp1;
@@ -1710,6 +1710,7 @@ ZeroLength::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 ZeroLength::getResistingForceSensitivity(int gradIndex)
 {
+  Vector *theVector = &FE_Workspace::getWorkspace().getVector(FE_Workspace::ZeroLength_Residual, numDOF);
   // Recompute strains to be safe
   this->update();
 
@@ -1756,6 +1757,7 @@ ZeroLength::commitSensitivity(int gradIndex, int numGrads)
 const Matrix &
 ZeroLength::getTangentStiffSensitivity(int gradIndex)
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::ZeroLength_Tangent, numDOF);
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
@@ -1793,6 +1795,7 @@ ZeroLength::getTangentStiffSensitivity(int gradIndex)
 const Matrix &
 ZeroLength::getInitialStiffSensitivity(int gradIndex)
 {
+    Matrix *theMatrix = &FE_Workspace::getWorkspace().getMatrix(FE_Workspace::ZeroLength_Tangent, numDOF);
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
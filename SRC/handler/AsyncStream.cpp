@@ -0,0 +1,558 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/AsyncStream.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the class implementation for AsyncStream.
+
+#include <AsyncStream.h>
+#include <Vector.h>
+#include <classTags.h>
+
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//
+// the buffer shared by all AsyncStreams: a ring of doubles holding the
+// data of each pending write and a queue of the pending writes; a single
+// writer thread takes the writes off the queue in the order they were made
+//
+
+struct AsyncWrite {
+  OPS_Stream *theStream;
+  int offset;
+  int size;
+};
+
+class AsyncWriteQueue
+{
+ public:
+  AsyncWriteQueue();
+
+  int resize(int numValues);
+  int push(OPS_Stream *theStream, const double *data, int size);
+  void drain(void);
+
+  int capacity;
+
+ private:
+  void run(void);
+
+  double *buffer;
+  int head, numUsed;
+  std::deque<AsyncWrite> pending;
+  bool writing;
+  bool started;
+
+  std::mutex theMutex;
+  std::condition_variable notEmpty;
+  std::condition_variable notFull;
+  std::condition_variable drained;
+};
+
+// the queue is never deleted: recorders held by a static domain may
+// still drain it during program exit
+static AsyncWriteQueue *theQueue = 0;
+
+static AsyncWriteQueue &
+getQueue(void)
+{
+  if (theQueue == 0)
+    theQueue = new AsyncWriteQueue();
+  return *theQueue;
+}
+
+AsyncWriteQueue::AsyncWriteQueue()
+  :capacity(0), buffer(0), head(0), numUsed(0), writing(false), started(false)
+{
+
+}
+
+int
+AsyncWriteQueue::resize(int numValues)
+{
+  if (numValues < 0)
+    numValues = 0;
+
+  this->drain();
+
+  std::lock_guard<std::mutex> lock(theMutex);
+  if (buffer != 0)
+    delete [] buffer;
+  buffer = 0;
+  if (numValues > 0)
+    buffer = new double[numValues];
+  capacity = numValues;
+  head = 0;
+
+  return 0;
+}
+
+int
+AsyncWriteQueue::push(OPS_Stream *theStream, const double *data, int size)
+{
+  std::unique_lock<std::mutex> lock(theMutex);
+
+  // data that can never fit is left to the caller to write
+  if (capacity == 0 || size > capacity)
+    return -1;
+
+  if (started == false) {
+    std::thread theWriter(&AsyncWriteQueue::run, this);
+    theWriter.detach();
+    started = true;
+  }
+
+  // back-pressure: wait for the writer to make room
+  notFull.wait(lock, [&]{return numUsed + size <= capacity && 
+	(int)pending.size() < capacity;});
+
+  AsyncWrite theWrite;
+  theWrite.theStream = theStream;
+  theWrite.offset = (head + numUsed) % capacity;
+  theWrite.size = size;
+
+  int first = capacity - theWrite.offset;
+  if (first > size)
+    first = size;
+  for (int i = 0; i < first; i++)
+    buffer[theWrite.offset + i] = data[i];
+  for (int i = first; i < size; i++)
+    buffer[i - first] = data[i];
+
+  numUsed += size;
+  pending.push_back(theWrite);
+
+  lock.unlock();
+  notEmpty.notify_one();
+
+  return 0;
+}
+
+void
+AsyncWriteQueue::drain(void)
+{
+  std::unique_lock<std::mutex> lock(theMutex);
+  drained.wait(lock, [&]{return pending.empty() && writing == false;});
+}
+
+void
+AsyncWriteQueue::run(void)
+{
+  Vector data;
+
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (true) {
+    notEmpty.wait(lock, [&]{return !pending.empty();});
+
+    // copy the data out so the buffer space can be reused at once
+    AsyncWrite theWrite = pending.front();
+    pending.pop_front();
+    if (data.Size() != theWrite.size)
+      data.resize(theWrite.size);
+    for (int i = 0; i < theWrite.size; i++)
+      data(i) = buffer[(theWrite.offset + i) % capacity];
+    head = (theWrite.offset + theWrite.size) % capacity;
+    numUsed -= theWrite.size;
+    writing = true;
+
+    lock.unlock();
+    notFull.notify_all();
+
+    theWrite.theStream->write(data);
+
+    lock.lock();
+    writing = false;
+    if (pending.empty())
+      drained.notify_all();
+  }
+}
+
+
+AsyncStream::AsyncStream(OPS_Stream *theOutputStream)
+  :OPS_Stream(theOutputStream->getClassTag()), theStream(theOutputStream)
+{
+
+}
+
+AsyncStream::~AsyncStream()
+{
+  AsyncStream::drain();
+  delete theStream;
+}
+
+int
+AsyncStream::setBufferSize(int numValues)
+{
+  return getQueue().resize(numValues);
+}
+
+int
+AsyncStream::getBufferSize(void)
+{
+  if (theQueue == 0)
+    return 0;
+  return theQueue->capacity;
+}
+
+int
+AsyncStream::drain(void)
+{
+  if (theQueue != 0)
+    theQueue->drain();
+  return 0;
+}
+
+OPS_Stream *
+AsyncStream::wrap(OPS_Stream *theStream)
+{
+  if (theStream == 0 || getBufferSize() == 0)
+    return theStream;
+
+  // streams sharing a channel, database or the console with the main
+  // thread are left to write synchronously
+  switch (theStream->getClassTag()) {
+  case OPS_STREAM_TAGS_FileStream:
+  case OPS_STREAM_TAGS_XmlFileStream:
+  case OPS_STREAM_TAGS_DataFileStream:
+  case OPS_STREAM_TAGS_DataFileStreamAdd:
+  case OPS_STREAM_TAGS_BinaryFileStream:
+    return new AsyncStream(theStream);
+
+  default:
+    return theStream;
+  }
+}
+
+int
+AsyncStream::write(Vector &data)
+{
+  int size = data.Size();
+  double *dataPtr = size > 0 ? &data(0) : 0;
+
+  if (getQueue().push(theStream, dataPtr, size) == 0)
+    return 0;
+
+  // too large for the buffer: write it once the pending writes are done
+  AsyncStream::drain();
+  return theStream->write(data);
+}
+
+int
+AsyncStream::flush()
+{
+  AsyncStream::drain();
+  return theStream->flush();
+}
+
+int
+AsyncStream::open(void)
+{
+  AsyncStream::drain();
+  return theStream->open();
+}
+
+int
+AsyncStream::close(openMode nextOpen)
+{
+  AsyncStream::drain();
+  return theStream->close(nextOpen);
+}
+
+int
+AsyncStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  AsyncStream::drain();
+  return theStream->setFile(fileName, mode, echo);
+}
+
+int
+AsyncStream::setPrecision(int prec)
+{
+  AsyncStream::drain();
+  return theStream->setPrecision(prec);
+}
+
+int
+AsyncStream::setFloatField(floatField field)
+{
+  AsyncStream::drain();
+  return theStream->setFloatField(field);
+}
+
+int
+AsyncStream::precision(int prec)
+{
+  AsyncStream::drain();
+  return theStream->precision(prec);
+}
+
+int
+AsyncStream::width(int w)
+{
+  AsyncStream::drain();
+  return theStream->width(w);
+}
+
+int
+AsyncStream::tag(const char *tagName)
+{
+  AsyncStream::drain();
+  return theStream->tag(tagName);
+}
+
+int
+AsyncStream::tag(const char *tagName, const char *value)
+{
+  AsyncStream::drain();
+  return theStream->tag(tagName, value);
+}
+
+int
+AsyncStream::endTag()
+{
+  AsyncStream::drain();
+  return theStream->endTag();
+}
+
+int
+AsyncStream::attr(const char *name, int value)
+{
+  AsyncStream::drain();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, double value)
+{
+  AsyncStream::drain();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, const char *value)
+{
+  AsyncStream::drain();
+  return theStream->attr(name, value);
+}
+
+OPS_Stream &
+AsyncStream::write(const char *s, int n)
+{
+  AsyncStream::drain();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const unsigned char *s, int n)
+{
+  AsyncStream::drain();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const signed char *s, int n)
+{
+  AsyncStream::drain();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const void *s, int n)
+{
+  AsyncStream::drain();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const double *s, int n)
+{
+  AsyncStream::drain();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(char c)
+{
+  AsyncStream::drain();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned char c)
+{
+  AsyncStream::drain();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(signed char c)
+{
+  AsyncStream::drain();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const char *s)
+{
+  AsyncStream::drain();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const unsigned char *s)
+{
+  AsyncStream::drain();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const signed char *s)
+{
+  AsyncStream::drain();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const void *p)
+{
+  AsyncStream::drain();
+  *theStream << p;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(int n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned int n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(long n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned long n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(short n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned short n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(bool b)
+{
+  AsyncStream::drain();
+  *theStream << b;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(double n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(float n)
+{
+  AsyncStream::drain();
+  *theStream << n;
+  return *this;
+}
+
+void
+AsyncStream::setAddCommon(int flag)
+{
+  AsyncStream::drain();
+  theStream->setAddCommon(flag);
+}
+
+int
+AsyncStream::setOrder(const ID &order)
+{
+  AsyncStream::drain();
+  return theStream->setOrder(order);
+}
+
+int
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  // sent as the wrapped stream, the receiving side writes synchronously
+  AsyncStream::drain();
+  return theStream->sendSelf(commitTag, theChannel);
+}
+
+int
+AsyncStream::recvSelf(int commitTag, Channel &theChannel, 
+		      FEM_ObjectBroker &theBroker)
+{
+  AsyncStream::drain();
+  return theStream->recvSelf(commitTag, theChannel, theBroker);
+}
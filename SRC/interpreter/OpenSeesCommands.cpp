@@ -47,6 +47,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <NDMaterial.h>
 #include <SectionForceDeformation.h>
 #include <SectionRepres.h>
+#include <MaterialArena.h>
 #include <TimeSeries.h>
 #include <CrdTransf.h>
 #include <Damping.h>
@@ -80,6 +81,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <ArpackSOE.h>
+#include <BlockLanczosSOE.h>
 #include <LoadControl.h>
 #include <CTestPFEM.h>
 #include <PFEMIntegrator.h>
@@ -101,6 +103,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <RegulaFalsiLineSearch.h>
 #include <NewtonLineSearch.h>
 #include <FileDatastore.h>
+#include <CheckpointDatastore.h>
 #include <Mesh.h>
 #ifdef _MUMPS
 #include <MumpsSolver.h>
@@ -316,6 +319,10 @@ OpenSeesCommands::eigen(int typeSolver, double shift,
 	    FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	    theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+	} else if (typeSolver == EigenSOE_TAGS_BlockLanczosSOE) {
+
+	    theEigenSOE = new BlockLanczosSOE(shift);
+
 	} else {
 
 	    theEigenSOE = new ArpackSOE(shift);
@@ -936,6 +943,7 @@ OpenSeesCommands::wipeAnalysis()
     thePFEMAnalysis = 0;
     theTest = 0;
 
+    OPS_wipeExplicitDynamicsAnalysis();
 }
 
 void
@@ -1002,6 +1010,8 @@ OpenSeesCommands::wipe()
     // wipe CyclicModel
     OPS_clearAllCyclicModel();
 
+    // free the material memory now the materials are gone
+    MaterialArena::release();
 }
 
 void
@@ -1014,6 +1024,16 @@ OpenSeesCommands::setFileDatabase(const char* filename)
     }
 }
 
+void
+OpenSeesCommands::setCheckpointDatabase(const char* filename)
+{
+    if (theDatabase != 0) delete theDatabase;
+    theDatabase = new CheckpointDatastore(filename, *theDomain, theBroker);
+    if (theDatabase == 0) {
+	opserr << "WARNING ran out of memory - database Checkpoint " << filename << endln;
+    }
+}
+
 /////////////////////////////
 //// OpenSees APIs  /// /////
 /////////////////////////////
@@ -1462,6 +1482,10 @@ int OPS_System()
 
 	theSOE = (LinearSOE*)OPS_UmfpackGenLinSolver();
 
+    } else if (strcmp(type, "AMG") == 0) {
+
+	theSOE = (LinearSOE*)OPS_AMGLinSolver();
+
     } else if (strcmp(type,"FullGeneral") == 0) {
 	// now must determine the type of solver to create from rest of args
 	theSOE = (LinearSOE*)OPS_FullGenLinLapackSolver();
@@ -1913,6 +1937,41 @@ int OPS_Analysis() {
              (strcmp(type, "VariableTransient") == 0)) {
     if (cmds != 0) {
       cmds->setVariableAnalysis(suppressWarnings);
+
+      // optional error control: -errorControl absTol relTol <-shrink f> <-grow f>
+      bool errorControl = false;
+      double tols[2] = {0.0, 0.0};
+      double minFactor = 0.2, maxFactor = 2.0;
+      int numdata = 1;
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+        const char* opt = OPS_GetString();
+        if (strcmp(opt, "-errorControl") == 0) {
+          numdata = 2;
+          if (OPS_GetNumRemainingInputArgs() < 2 ||
+              OPS_GetDoubleInput(&numdata, tols) < 0) {
+            opserr << "WARNING analysis VariableTransient -errorControl absTol? relTol?\n";
+            return -1;
+          }
+          errorControl = true;
+        } else if (strcmp(opt, "-shrink") == 0) {
+          numdata = 1;
+          if (OPS_GetNumRemainingInputArgs() > 0 &&
+              OPS_GetDoubleInput(&numdata, &minFactor) < 0) {
+            opserr << "WARNING analysis VariableTransient -shrink factor?\n";
+            return -1;
+          }
+        } else if (strcmp(opt, "-grow") == 0) {
+          numdata = 1;
+          if (OPS_GetNumRemainingInputArgs() > 0 &&
+              OPS_GetDoubleInput(&numdata, &maxFactor) < 0) {
+            opserr << "WARNING analysis VariableTransient -grow factor?\n";
+            return -1;
+          }
+        }
+      }
+      if (errorControl) {
+        cmds->getVariableAnalysis()->setErrorControl(tols[0], tols[1], minFactor, maxFactor);
+      }
     }
 
   } else {
@@ -2110,6 +2169,10 @@ int OPS_eigenAnalysis()
         typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
     }
 
+	else if ((strcmp(type,"blockLanczos") == 0) ||
+		 (strcmp(type,"-blockLanczos") == 0))
+	    typeSolver = EigenSOE_TAGS_BlockLanczosSOE;
+
     else {
         opserr << "eigen - unknown option specified " << type
                 << endln;
@@ -2493,6 +2556,8 @@ void* OPS_KrylovNewton()
     int incrementTangent = CURRENT_TANGENT;
     int iterateTangent = CURRENT_TANGENT;
     int maxDim = 3;
+    double reuseRate = 0.0;
+    int reuseSteps = 0;
     while (OPS_GetNumRemainingInputArgs() > 0) {
 	const char* flag = OPS_GetString();
 
@@ -2528,6 +2593,20 @@ void* OPS_KrylovNewton()
 		opserr<< "WARNING KrylovNewton failed to read maxDim\n";
 		return 0;
 	    }
+	} else if (strcmp(flag,"-reuse") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    int numdata = 1;
+	    if (OPS_GetDoubleInput(&numdata, &reuseRate) < 0) {
+		opserr<< "WARNING KrylovNewton failed to read reuse rate\n";
+		return 0;
+	    }
+	    if (OPS_GetNumRemainingInputArgs() > 0) {
+		int numRemaining = OPS_GetNumRemainingInputArgs();
+		if (OPS_GetIntInput(&numdata, &reuseSteps) < 0) {
+		    if (OPS_GetNumRemainingInputArgs() < numRemaining)
+			OPS_ResetCurrentInputArg(-1);
+		    reuseSteps = 0;
+		}
+	    }
 	}
     }
 
@@ -2540,7 +2619,11 @@ void* OPS_KrylovNewton()
     Accelerator *theAccel;
     theAccel = new KrylovAccelerator(maxDim, iterateTangent);
 
-    return new AcceleratedNewton(*theTest, theAccel, incrementTangent);
+    AcceleratedNewton *theAlgo = new AcceleratedNewton(*theTest, theAccel, incrementTangent);
+    if (reuseRate > 0.0)
+	theAlgo->setTangentReuse(reuseRate, reuseSteps);
+
+    return theAlgo;
 }
 
 void* OPS_RaphsonNewton()
@@ -2950,8 +3033,21 @@ int OPS_Database()
 
 	return 0;
     }
+
+    // a single binary file of checkpoints
+    if (strcmp(type,"Checkpoint") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING database Checkpoint fileName? ";
+	    return -1;
+	}
+
+	const char* filename = OPS_GetString();
+	cmds->setCheckpointDatabase(filename);
+
+	return 0;
+    }
     opserr << "WARNING No database type exists ";
-    opserr << "for database of type:" << type << "valid database type File\n";
+    opserr << "for database of type:" << type << "valid database type File, Checkpoint\n";
 
     return -1;
 }
@@ -3471,7 +3567,13 @@ int OPS_numFact()
 	return -1;
     }
 
+    // numFact <-saved>
     double value = theAlgorithm->getNumFactorizations();
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* flag = OPS_GetString();
+	if (strcmp(flag, "-saved") == 0)
+	    value = theAlgorithm->getNumFactorizationsSaved();
+    }
     int numdata = 1;
     if (OPS_SetDoubleOutput(&numdata, &value, true) < 0) {
 	opserr << "WARNING failed to set output\n";
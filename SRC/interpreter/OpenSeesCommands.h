@@ -145,6 +145,7 @@ public:
     EigenSOE** getEigenSOEPointer() {return &theEigenSOE;}
 
     void setFileDatabase(const char* filename);
+    void setCheckpointDatabase(const char* filename);
     FE_Datastore* getDatabase() {return theDatabase;}
 
     Timer* getTimer() {return &theTimer;}
@@ -342,6 +343,9 @@ int OPS_calculateNodalReactions();
 int OPS_rayleighDamping();
 int OPS_setTime();
 int OPS_setCreep();
+int OPS_setDomainThreads();
+int OPS_setNodalStateStore();
+int OPS_setRecorderAsync();
 int OPS_removeObject();
 int OPS_addNodalMass();
 int OPS_buildModel();
@@ -482,6 +486,10 @@ int OPS_ShallowFoundationGen();
 int OPS_Pressure_Constraint();
 int OPS_DomainModalProperties();
 int OPS_ResponseSpectrumAnalysis();
+int OPS_ModalTransientAnalysis();
+int OPS_MultiRecordAnalysis();
+int OPS_ExplicitDynamicsAnalysis();
+void OPS_wipeExplicitDynamicsAnalysis();
 
 void* OPS_TimeSeriesIntegrator();
 
@@ -490,6 +498,7 @@ void* OPS_BandSPDLinLapack();
 void* OPS_SuperLUSolver();
 void* OPS_ProfileSPDLinDirectSolver();
 void* OPS_UmfpackGenLinSolver();
+void* OPS_AMGLinSolver();
 void* OPS_DiagonalDirectSolver();
 void* OPS_SProfileSPDLinSolver();
 void* OPS_PFEMSolver();
@@ -52,6 +52,7 @@
 #include <RigidBeam.h>
 #include <RigidDiaphragm.h>
 #include <vector>
+#include <AsyncStream.h>
 #include <TriMesh.h>
 #include <TetMesh.h>
 #include <Damping.h>
@@ -203,6 +204,70 @@ int OPS_setCreep()
     return 0;
 }
 
+int OPS_setDomainThreads()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING illegal command - setDomainThreads numThreads? \n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    int numThreads;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &numThreads) < 0) {
+	opserr << "WARNING reading number of threads - setDomainThreads numThreads? \n";
+	return -1;
+    }
+
+    theDomain->setNumThreads(numThreads);
+
+    return 0;
+}
+
+int OPS_setNodalStateStore()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING illegal command - setNodalStateStore flag? \n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    int flag;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &flag) < 0) {
+	opserr << "WARNING reading flag - setNodalStateStore flag? \n";
+	return -1;
+    }
+
+    theDomain->setNodalStateStore(flag != 0);
+
+    return 0;
+}
+
+int OPS_setRecorderAsync()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING illegal command - setRecorderAsync bufferSize? \n";
+	return -1;
+    }
+
+    int bufferSize;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &bufferSize) < 0) {
+	opserr << "WARNING reading buffer size - setRecorderAsync bufferSize? \n";
+	return -1;
+    }
+
+    // applies to recorders created after this command
+    AsyncStream::setBufferSize(bufferSize);
+
+    return 0;
+}
+
 int OPS_setTime()
 {
     if (OPS_GetNumRemainingInputArgs() < 1) {
@@ -77,6 +77,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <SectionRepres.h>
 #include <TimeSeries.h>
 #include <NDMaterial.h>
+#include <MaterialArena.h>
 #include <LoadPattern.h>
 #include <CrdTransf.h>
 #include <Damping.h>
@@ -88,6 +89,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <ArpackSOE.h>
+#include <BlockLanczosSOE.h>
 #include <iostream>
 #include <ProfileSPDLinSOE.h>
 
@@ -432,6 +434,8 @@ void PythonAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
 	    FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	    theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+	} else if(typeSolver == EigenSOE_TAGS_BlockLanczosSOE) {
+	    theEigenSOE = new BlockLanczosSOE(shift);
 	} else {
 	    theEigenSOE = new ArpackSOE(shift);    
 	}
@@ -756,6 +760,9 @@ PyObject *ops_wipeModel(PyObject *self, PyObject *args)
 
     // wipe BeamIntegration
     OPS_clearAllBeamIntegrationRule();
+
+    // free the material memory now the materials are gone
+    MaterialArena::release();
     
     ops_Dt = 0.0;
 
@@ -1157,6 +1164,8 @@ PyObject *ops_eigenAnalysis(PyObject *self, PyObject *args)
 	} else if(type=="fullGenLapack"||type=="-fullGenLapack"||
 		  type=="fullGenLapackEigen"||type=="-fullGenLapackEigen") {
 	    typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
+	} else if(type=="blockLanczos"||type=="-blockLanczos") {
+	    typeSolver = EigenSOE_TAGS_BlockLanczosSOE;
 	} else {
 	    PyErr_SetString(PyExc_RuntimeError,"eigen - unknown option specified");
 	    return NULL;
@@ -477,6 +477,30 @@ static int Tcl_ops_setCreep(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_setDomainThreads(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_setDomainThreads() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
+static int Tcl_ops_setNodalStateStore(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_setNodalStateStore() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
+static int Tcl_ops_setRecorderAsync(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_setRecorderAsync() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
 static int Tcl_ops_eleResponse(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1719,6 +1743,9 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"nodeEigenvector", &Tcl_ops_nodeEigenvector);
     addCommand(interp,"getTime", &Tcl_ops_getTime);
     addCommand(interp,"setCreep", &Tcl_ops_setCreep);
+    addCommand(interp,"setDomainThreads", &Tcl_ops_setDomainThreads);
+    addCommand(interp,"setNodalStateStore", &Tcl_ops_setNodalStateStore);
+    addCommand(interp,"setRecorderAsync", &Tcl_ops_setRecorderAsync);
     addCommand(interp,"eleResponse", &Tcl_ops_eleResponse);
     addCommand(interp,"sp", &Tcl_ops_SP);
     addCommand(interp,"fixX", &Tcl_ops_fixX);
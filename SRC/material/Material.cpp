@@ -32,6 +32,7 @@
 // What: "@(#) MaterialModel.C, revA"
 
 #include <Material.h>
+#include <MaterialArena.h>
 
 Material::Material(int tag, int clasTag)
 :TaggedObject(tag), MovableObject(clasTag)
@@ -65,3 +66,15 @@ Material::getResponseSensitivity(int responseID, int gradIndex,
 {
   return -1;
 }
+
+void *
+Material::operator new(size_t size)
+{
+  return MaterialArena::allocate(size);
+}
+
+void
+Material::operator delete(void *ptr, size_t size)
+{
+  MaterialArena::deallocate(ptr, size);
+}
@@ -39,6 +39,7 @@
 
 #include <DomainComponent.h>
 #include <MovableObject.h>
+#include <stddef.h>
 
 class OPS_Stream;
 class Information;
@@ -59,6 +60,11 @@ class Material : public TaggedObject, public MovableObject
     // method for this material to update itself according to its new parameters
     virtual void update(void) {return;}
 
+    // the objects of all material classes are allocated from the
+    // MaterialArena, so the copies made by getCopy() lie close together
+    static void *operator new(size_t size);
+    static void  operator delete(void *ptr, size_t size);
+
   protected:
     
   private:
@@ -0,0 +1,351 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/material/MaterialArena.cpp,v $
+                                                                        
+// Written: 10/26
+//
+// Description: This file contains the class implementation for
+// MaterialArena.
+//
+// What: "@(#) MaterialArena.cpp, revA"
+
+#include <MaterialArena.h>
+#include <new>
+#include <mutex>
+#include <atomic>
+
+#define ARENA_ALIGN       16             // alignment and size granularity
+#define ARENA_MAX_SIZE    1024           // larger objects go to ::operator new
+#define ARENA_NUM_SIZES   (ARENA_MAX_SIZE/ARENA_ALIGN)
+#define ARENA_CHUNK_SIZE  (256*1024)
+#define ARENA_CACHE_LIMIT 1024           // free blocks of a size a thread keeps
+#define ARENA_CACHE_BATCH 64             // blocks a thread takes from the shared lists
+
+// a freed block, linked into the free list for its size
+struct ArenaBlock {
+  ArenaBlock *next;
+};
+
+// the part of the arena used by one thread: its free lists and the
+// rest of the chunk it is carving blocks from. Plain data, so that it
+// is usable at any time in the life of the thread, including by the
+// static destructors that delete materials at exit
+struct ArenaCache {
+  ArenaBlock *freeBlocks[ARENA_NUM_SIZES];
+  int numFree[ARENA_NUM_SIZES];
+  char *chunkNext;
+  char *chunkEnd;
+  unsigned long generation;   // arena generation the cache belongs to
+  int state;                  // 0 unused, 1 in use, 2 thread has exited
+  std::atomic<long> numLive;  // allocations less deallocations by the thread
+  ArenaCache *nextCache;      // the caches of the running threads
+};
+
+static thread_local ArenaCache theCache;
+
+// the shared state, guarded by the mutex; a thread only takes the lock
+// for a new chunk, to take blocks from or hand its surplus to the
+// shared free lists, and in release(). The shared lists also hold the
+// free blocks of the threads that have exited. The generation is
+// incremented by release() so the caches of all threads drop their
+// pointers into the chunks
+static std::mutex arenaMutex;
+static ArenaBlock *sharedBlocks[ARENA_NUM_SIZES];
+static char **theChunks = 0;
+static size_t numChunks = 0;
+static size_t sizeChunks = 0;
+static std::atomic<unsigned long> arenaGeneration(1);
+static ArenaCache *theCaches = 0;
+static long sharedLive = 0;   // count of the exited threads and of the calls without a cache
+
+// hands the free lists of a thread to the arena when the thread exits
+struct ArenaCacheGuard {
+  ~ArenaCacheGuard();
+};
+
+static void
+resetCache(ArenaCache &cache, unsigned long generation)
+{
+  for (int i=0; i<ARENA_NUM_SIZES; i++) {
+    cache.freeBlocks[i] = 0;
+    cache.numFree[i] = 0;
+  }
+  cache.chunkNext = 0;
+  cache.chunkEnd = 0;
+  cache.generation = generation;
+}
+
+// the cache of the calling thread, 0 once the thread has exited
+static ArenaCache *
+getCache(void)
+{
+  if (theCache.state == 2)
+    return 0;
+
+  if (theCache.state == 0) {
+    static thread_local ArenaCacheGuard theGuard;
+    (void)theGuard;
+    theCache.state = 1;
+    resetCache(theCache, arenaGeneration.load(std::memory_order_acquire));
+
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    theCache.nextCache = theCaches;
+    theCaches = &theCache;
+  } else {
+    unsigned long generation = arenaGeneration.load(std::memory_order_acquire);
+    if (theCache.generation != generation)
+      resetCache(theCache, generation);
+  }
+
+  return &theCache;
+}
+
+ArenaCacheGuard::~ArenaCacheGuard()
+{
+  std::lock_guard<std::mutex> lock(arenaMutex);
+
+  if (theCache.generation == arenaGeneration.load(std::memory_order_relaxed)) {
+    for (int i=0; i<ARENA_NUM_SIZES; i++) {
+      ArenaBlock *theBlock = theCache.freeBlocks[i];
+      while (theBlock != 0) {
+	ArenaBlock *next = theBlock->next;
+	theBlock->next = sharedBlocks[i];
+	sharedBlocks[i] = theBlock;
+	theBlock = next;
+      }
+    }
+  }
+
+  // the count of the thread is kept, the cache is removed from the list
+  sharedLive += theCache.numLive.load(std::memory_order_relaxed);
+  theCache.numLive.store(0, std::memory_order_relaxed);
+  ArenaCache **theLink = &theCaches;
+  while (*theLink != 0 && *theLink != &theCache)
+    theLink = &(*theLink)->nextCache;
+  if (*theLink != 0)
+    *theLink = theCache.nextCache;
+
+  resetCache(theCache, 0);
+  theCache.state = 2;
+}
+
+// the number of objects allocated and not yet deleted; called with the
+// lock held
+static long
+countLive(void)
+{
+  long count = sharedLive;
+  for (ArenaCache *cache = theCaches; cache != 0; cache = cache->nextCache)
+    count += cache->numLive.load(std::memory_order_relaxed);
+
+  return count;
+}
+
+// only the thread owning the cache changes its count
+static void
+addLive(ArenaCache *cache, long num)
+{
+  cache->numLive.store(cache->numLive.load(std::memory_order_relaxed) + num,
+		       std::memory_order_relaxed);
+}
+
+// a block of the size class, from the shared free list, with a batch
+// more moved to the thread's list, or from a new chunk; called with the
+// lock held
+static void *
+allocateShared(size_t sizeIndex, ArenaCache *cache)
+{
+  ArenaBlock *theBlock = sharedBlocks[sizeIndex];
+  if (theBlock != 0) {
+    sharedBlocks[sizeIndex] = theBlock->next;
+    if (cache != 0) {
+      for (int i=0; i<ARENA_CACHE_BATCH && sharedBlocks[sizeIndex] != 0; i++) {
+	ArenaBlock *theFree = sharedBlocks[sizeIndex];
+	sharedBlocks[sizeIndex] = theFree->next;
+	theFree->next = cache->freeBlocks[sizeIndex];
+	cache->freeBlocks[sizeIndex] = theFree;
+	cache->numFree[sizeIndex]++;
+      }
+    }
+    return theBlock;
+  }
+
+  if (numChunks == sizeChunks) {
+    size_t newSize = (sizeChunks == 0) ? 16 : 2*sizeChunks;
+    char **newChunks = new char *[newSize];
+    for (size_t i=0; i<numChunks; i++)
+      newChunks[i] = theChunks[i];
+    if (theChunks != 0)
+      delete [] theChunks;
+    theChunks = newChunks;
+    sizeChunks = newSize;
+  }
+  char *theChunk = static_cast<char *>(::operator new(ARENA_CHUNK_SIZE));
+  theChunks[numChunks++] = theChunk;
+
+  // the rest of the chunk is carved up by the thread asking for it, or
+  // given to the free list if the thread has exited
+  size_t blockSize = (sizeIndex + 1)*ARENA_ALIGN;
+  if (cache != 0) {
+    cache->chunkNext = theChunk + blockSize;
+    cache->chunkEnd = theChunk + ARENA_CHUNK_SIZE;
+  } else {
+    for (char *next = theChunk + blockSize; next + blockSize <= theChunk + ARENA_CHUNK_SIZE; next += blockSize) {
+      ArenaBlock *theFree = reinterpret_cast<ArenaBlock *>(next);
+      theFree->next = sharedBlocks[sizeIndex];
+      sharedBlocks[sizeIndex] = theFree;
+    }
+  }
+
+  return theChunk;
+}
+
+void *
+MaterialArena::allocate(size_t size)
+{
+  if (size == 0)
+    size = 1;
+
+  if (size > ARENA_MAX_SIZE)
+    return ::operator new(size);
+
+  size_t sizeIndex = (size - 1)/ARENA_ALIGN;
+  size_t blockSize = (sizeIndex + 1)*ARENA_ALIGN;
+
+  ArenaCache *cache = getCache();
+  if (cache != 0) {
+    addLive(cache, 1);
+
+    // reuse a block of the same size freed by this thread, otherwise
+    // take it from the end of the chunk the thread is carving up
+    ArenaBlock *theBlock = cache->freeBlocks[sizeIndex];
+    if (theBlock != 0) {
+      cache->freeBlocks[sizeIndex] = theBlock->next;
+      cache->numFree[sizeIndex]--;
+      return theBlock;
+    }
+
+    if (cache->chunkNext != 0 && cache->chunkNext + blockSize <= cache->chunkEnd) {
+      void *result = cache->chunkNext;
+      cache->chunkNext += blockSize;
+      return result;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(arenaMutex);
+  if (cache == 0)
+    sharedLive++;
+  return allocateShared(sizeIndex, cache);
+}
+
+void
+MaterialArena::deallocate(void *ptr, size_t size)
+{
+  if (ptr == 0)
+    return;
+
+  if (size == 0)
+    size = 1;
+
+  if (size > ARENA_MAX_SIZE) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  size_t sizeIndex = (size - 1)/ARENA_ALIGN;
+  ArenaBlock *theBlock = static_cast<ArenaBlock *>(ptr);
+
+  // the block goes on the free list of the thread deleting the object;
+  // a thread holding too many hands them over for the others to use
+  ArenaCache *cache = getCache();
+  if (cache != 0) {
+    addLive(cache, -1);
+    theBlock->next = cache->freeBlocks[sizeIndex];
+    cache->freeBlocks[sizeIndex] = theBlock;
+    if (++cache->numFree[sizeIndex] <= ARENA_CACHE_LIMIT)
+      return;
+
+    ArenaBlock *theLast = theBlock;
+    while (theLast->next != 0)
+      theLast = theLast->next;
+
+    std::lock_guard<std::mutex> lock(arenaMutex);
+    theLast->next = sharedBlocks[sizeIndex];
+    sharedBlocks[sizeIndex] = theBlock;
+    cache->freeBlocks[sizeIndex] = 0;
+    cache->numFree[sizeIndex] = 0;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(arenaMutex);
+  sharedLive--;
+  theBlock->next = sharedBlocks[sizeIndex];
+  sharedBlocks[sizeIndex] = theBlock;
+}
+
+int
+MaterialArena::release(void)
+{
+  std::lock_guard<std::mutex> lock(arenaMutex);
+
+  if (countLive() != 0)
+    return -1;
+
+  for (size_t i=0; i<numChunks; i++)
+    ::operator delete(theChunks[i]);
+
+  if (theChunks != 0)
+    delete [] theChunks;
+
+  for (int i=0; i<ARENA_NUM_SIZES; i++)
+    sharedBlocks[i] = 0;
+
+  theChunks = 0;
+  numChunks = 0;
+  sizeChunks = 0;
+
+  // the thread caches point into the chunks just freed
+  arenaGeneration.fetch_add(1, std::memory_order_release);
+
+  return 0;
+}
+
+size_t
+MaterialArena::getNumLive(void)
+{
+  std::lock_guard<std::mutex> lock(arenaMutex);
+  return (size_t)countLive();
+}
+
+size_t
+MaterialArena::getNumChunks(void)
+{
+  std::lock_guard<std::mutex> lock(arenaMutex);
+  return numChunks;
+}
+
+size_t
+MaterialArena::getMaxSize(void)
+{
+  return ARENA_MAX_SIZE;
+}
@@ -0,0 +1,71 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/material/MaterialArena.h,v $
+                                                                        
+// Written: 10/26
+//
+// Description: This file contains the class definition for
+// MaterialArena. The MaterialArena is the pool from which the objects
+// of all the Material classes (uniaxial, nD and section) are allocated,
+// through the operator new and delete of the Material base class. The
+// memory is carved out of large chunks, so the copies an element or
+// section makes of its materials lie next to each other, and blocks
+// freed when an object is deleted are kept on a free list for their
+// size to be reused. Objects larger than getMaxSize() bytes are passed
+// on to the global operator new and delete.
+//
+// Each thread carves blocks from its own chunk and keeps its own free
+// lists, so threads creating and deleting materials at the same time
+// do not wait on each other; a lock is only taken to get a new chunk.
+// The free lists of a thread are handed to the arena when it exits.
+//
+// The chunks are given back in one go by release(), called by the wipe
+// commands once the material registries have been cleared. It frees
+// nothing while any object allocated from the arena is still alive.
+//
+// What: "@(#) MaterialArena.h, revA"
+
+#ifndef MaterialArena_h
+#define MaterialArena_h
+
+#include <stddef.h>
+
+class MaterialArena
+{
+  public:
+    static void *allocate(size_t size);
+    static void  deallocate(void *ptr, size_t size);
+
+    // free all the chunks if no object from the arena is left,
+    // returns 0 if released, -1 otherwise
+    static int release(void);
+
+    static size_t getNumLive(void);   // number of objects allocated
+    static size_t getNumChunks(void); // number of chunks held
+    static size_t getMaxSize(void);   // largest object held in the arena
+
+  private:
+    MaterialArena();
+};
+
+#endif
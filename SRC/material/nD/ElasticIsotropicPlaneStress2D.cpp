@@ -27,8 +27,8 @@
 #include <ElasticIsotropicPlaneStress2D.h>           
 #include <Channel.h>
 
-Vector ElasticIsotropicPlaneStress2D::sigma(3);
-Matrix ElasticIsotropicPlaneStress2D::D(3,3);
+thread_local Vector ElasticIsotropicPlaneStress2D::sigma(3);
+thread_local Matrix ElasticIsotropicPlaneStress2D::D(3,3);
 
 ElasticIsotropicPlaneStress2D::ElasticIsotropicPlaneStress2D
 (int tag, double E, double nu, double rho) :
@@ -67,6 +67,7 @@ class ElasticIsotropicPlaneStress2D : public ElasticIsotropicMaterial
     int revertToStart (void);
     
     NDMaterial *getCopy (void);
+    bool isThreadSafe(void) {return true;}
     const char *getType (void) const;
     int getOrder (void) const;
 
@@ -77,8 +78,8 @@ class ElasticIsotropicPlaneStress2D : public ElasticIsotropicMaterial
   protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strains
 };
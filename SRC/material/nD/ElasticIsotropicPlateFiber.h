@@ -64,14 +64,15 @@ class ElasticIsotropicPlateFiber : public ElasticIsotropicMaterial
     int revertToStart (void);
     
     NDMaterial *getCopy (void);
+    bool isThreadSafe(void) {return true;}
     const char *getType (void) const;
     int getOrder (void) const;
     
   protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;		// Trial strains
 };
 
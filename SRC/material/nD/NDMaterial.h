@@ -79,6 +79,10 @@ class NDMaterial : public Material
     virtual NDMaterial *getCopy(void) = 0;
     virtual NDMaterial *getCopy(const char *code);
 
+    // true if different objects of the class may be used at the same
+    // time from different threads, i.e. the class keeps no shared scratch
+    virtual bool isThreadSafe(void) {return false;}
+
     virtual const char *getType(void) const = 0;
     virtual int getOrder(void) const {return 0;};  //??
 
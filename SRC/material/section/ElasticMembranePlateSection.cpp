@@ -41,8 +41,8 @@
 const double ElasticMembranePlateSection::five6 = 5.0/6.0 ; //shear correction
 
 //static vector and matrices
-Vector  ElasticMembranePlateSection::stress(8) ;
-Matrix  ElasticMembranePlateSection::tangent(8,8) ;
+thread_local Vector  ElasticMembranePlateSection::stress(8) ;
+thread_local Matrix  ElasticMembranePlateSection::tangent(8,8) ;
 ID      ElasticMembranePlateSection::array(8) ;
 
 void* OPS_ElasticMembranePlateSection()
@@ -66,6 +66,7 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
 
     //make a clone of this material
     SectionForceDeformation *getCopy( ) ;
+    bool isThreadSafe(void) {return true;}
 
     const char *getClassType(void) const {return "ElasticMembranePlate";};
 
@@ -124,9 +125,9 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
 
     Vector strain ;
 
-    static Vector stress ;
+    static thread_local Vector stress ;
 
-    static Matrix tangent ;
+    static thread_local Matrix tangent ;
 
     static ID array ;  
 
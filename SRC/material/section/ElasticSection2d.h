@@ -56,6 +56,7 @@ class ElasticSection2d: public SectionForceDeformation
   const Matrix &getInitialFlexibility(void);
   
   SectionForceDeformation *getCopy(void);
+  bool isThreadSafe(void) {return true;}
   const ID &getType(void);
   int getOrder(void) const;
   
@@ -83,8 +84,8 @@ class ElasticSection2d: public SectionForceDeformation
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
   
   int parameterID;
@@ -58,6 +58,7 @@ class ElasticSection3d : public SectionForceDeformation
   const Matrix &getInitialFlexibility(void);
   
   SectionForceDeformation *getCopy(void);
+  bool isThreadSafe(void) {return true;}
   const ID &getType(void);
   int getOrder(void) const;
   
@@ -82,8 +83,8 @@ class ElasticSection3d : public SectionForceDeformation
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
 
   int parameterID;
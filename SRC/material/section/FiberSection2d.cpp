@@ -29,6 +29,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 #include <math.h>
 
 #include <Channel.h>
@@ -75,6 +76,7 @@ void* OPS_FiberSection2d()
 FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers, bool compCentroid): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), ABar(0.0), yBar(0.0), computeCentroid(compCentroid),
   sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 
@@ -135,6 +137,7 @@ FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers, bool compCentro
 FiberSection2d::FiberSection2d(int tag, int num, bool compCentroid): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), ABar(0.0), yBar(0.0), computeCentroid(compCentroid),
   sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
@@ -179,6 +182,7 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si, bool compCentroid):
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), ABar(0.0), yBar(0.0), computeCentroid(compCentroid),
   sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
@@ -203,11 +207,11 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double fiberLocs[10000];
-  sectionIntegr->getFiberLocations(numFibers, fiberLocs);
+  std::vector<double> fiberLocs(numFibers);
+  sectionIntegr->getFiberLocations(numFibers, fiberLocs.data());
   
-  static double fiberArea[10000];
-  sectionIntegr->getFiberWeights(numFibers, fiberArea);
+  std::vector<double> fiberArea(numFibers);
+  sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
 
   for (int i = 0; i < numFibers; i++) {
 
@@ -244,6 +248,7 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 FiberSection2d::FiberSection2d():
   SectionForceDeformation(0, SEC_TAG_FiberSection2d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), ABar(0.0), yBar(0.0), computeCentroid(true),
   sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
@@ -325,6 +330,8 @@ FiberSection2d::addFiber(Fiber &newFiber)
   // Recompute centroid
   if (computeCentroid && ABar != 0.0)
     yBar = QzBar/ABar;
+
+  fiberDataCurrent = false;
   
   return 0;
 }
@@ -344,6 +351,9 @@ FiberSection2d::~FiberSection2d()
   if (matData != 0)
     delete [] matData;
 
+  if (fiberData != 0)
+    delete [] fiberData;
+
   if (s != 0)
     delete s;
 
@@ -361,50 +371,93 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
 
   e = deforms;
 
-  kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
-  sData[0] = 0.0; sData[1] = 0.0;
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   double d0 = deforms(0);
   double d1 = deforms(1);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  // determine the fiber strains
+  for (int i = 0; i < numFibers; i++)
+    fiberStrain[i] = d0 - fiberY[i]*d1;
+
+  // set the fiber material states
+  for (int i = 0; i < numFibers; i++)
+    res += theMaterials[i]->setTrial(fiberStrain[i], fiberStress[i], fiberTangent[i]);
+
+  this->formResultants();
+
+  return res;
+}
+
+void
+FiberSection2d::setFiberData(void)
+{
+  // make sure there is room for the fiber data
+  if (sizeFiberData < numFibers) {
+    if (fiberData != 0)
+      delete [] fiberData;
+    sizeFiberData = sizeFibers > numFibers ? sizeFibers : numFibers;
+    fiberData = new double [5*sizeFiberData];
+  }
+
+  fiberY       = fiberData;
+  fiberArea    = fiberData +   sizeFiberData;
+  fiberStrain  = fiberData + 2*sizeFiberData;
+  fiberStress  = fiberData + 3*sizeFiberData;
+  fiberTangent = fiberData + 4*sizeFiberData;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
+    sectionIntegr->getFiberLocations(numFibers, fiberY);
     sectionIntegr->getFiberWeights(numFibers, fiberArea);
   }  
   else {
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
+      fiberY[i] = matData[2*i];
       fiberArea[i] = matData[2*i+1];
     }
   }
-  
+
+  // locations relative to the centroid
+  for (int i = 0; i < numFibers; i++)
+    fiberY[i] -= yBar;
+
+  // the section integration may have its parameters changed, so its
+  // locations and weights are obtained each time they are needed
+  fiberDataCurrent = (sectionIntegr == 0);
+}
+
+void
+FiberSection2d::formResultants(void)
+{
+  double k0 = 0.0, k1 = 0.0, k3 = 0.0;
+  double s0 = 0.0, s1 = 0.0;
+
+#ifdef _OPENMP
+#pragma omp simd reduction(+:k0,k1,k3,s0,s1)
+#endif
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
-    double y = fiberLocs[i] - yBar;
+    double y = fiberY[i];
     double A = fiberArea[i];
 
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
-
-    double ks0 = tangent * A;
+    double ks0 = fiberTangent[i] * A;
     double ks1 = ks0 * -y;
-    kData[0] += ks0;
-    kData[1] += ks1;
-    kData[3] += ks1 * -y;
+    k0 += ks0;
+    k1 += ks1;
+    k3 += ks1 * -y;
 
-    double fs0 = stress * A;
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
+    double fs0 = fiberStress[i] * A;
+    s0 += fs0;
+    s1 += fs0 * -y;
   }
 
-  kData[2] = kData[1];
+  kData[0] = k0;
+  kData[1] = k1;
+  kData[2] = k1;
+  kData[3] = k3;
 
-  return res;
+  sData[0] = s0;
+  sData[1] = s1;
 }
 
 const Vector&
@@ -416,27 +469,16 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  static thread_local double kInitial[4];
+  static thread_local Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
-  
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);    
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];      
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
-    double y = fiberLocs[i] - yBar;
+    double y = fiberY[i];
     double A = fiberArea[i];
 
     double tangent = theMat->getInitialTangent();
@@ -524,6 +566,20 @@ FiberSection2d::getCopy(void)
   return theCopy;
 }
 
+bool
+FiberSection2d::isThreadSafe(void)
+{
+  // the fiber layout of a SectionIntegration is not audited
+  if (sectionIntegr != 0)
+    return false;
+
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 const ID&
 FiberSection2d::getType ()
 {
@@ -552,46 +608,21 @@ FiberSection2d::revertToLastCommit(void)
 {
   int err = 0;
 
-  kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
-  sData[0] = 0.0; sData[1] = 0.0;
-  
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
-
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
-    double y = fiberLocs[i] - yBar;
-    double A = fiberArea[i];
 
     // invoke revertToLast on the material
     err += theMat->revertToLastCommit();
 
-    // get material stress & tangent for this strain and determine ks and fs
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
-    double ks0 = tangent * A;
-    double ks1 = ks0 * -y;
-    kData[0] += ks0;
-    kData[1] += ks1;
-    kData[3] += ks1 * -y;
-
-    double fs0 = stress * A;
-    sData[0] = fs0;
-    sData[1] = fs0 * -y;
+    // get material stress & tangent for this strain
+    fiberTangent[i] = theMat->getTangent();
+    fiberStress[i] = theMat->getStress();
   }
 
-  kData[2] = kData[1];
+  this->formResultants();
 
   return err;
 }
@@ -602,46 +633,21 @@ FiberSection2d::revertToStart(void)
   // revert the fibers to start    
   int err = 0;
 
-  kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
-  sData[0] = 0.0; sData[1] = 0.0;
-  
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
-
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
-    double y = fiberLocs[i] - yBar;
-    double A = fiberArea[i];
 
-    // invoke revertToLast on the material
+    // invoke revertToStart on the material
     err += theMat->revertToStart();
 
-    // get material stress & tangent for this strain and determine ks and fs
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
-    double ks0 = tangent * A;
-    double ks1 = ks0 * -y;
-    kData[0] += ks0;
-    kData[1] += ks1;
-    kData[3] += ks1 * -y;
-
-    double fs0 = stress * A;
-    sData[0] = fs0;
-    sData[1] = fs0 * -y;
+    // get material stress & tangent for this strain
+    fiberTangent[i] = theMat->getTangent();
+    fiberStress[i] = theMat->getStress();
   }
 
-  kData[2] = kData[1];
+  this->formResultants();
 
   return err;
 }
@@ -855,11 +861,11 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
   computeCentroid = data(2) ? true : false;
 
   if (sectionIntegr != 0) {
-    static double fiberLocs[10000];
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
+    std::vector<double> fiberLocs(numFibers);
+    sectionIntegr->getFiberLocations(numFibers, fiberLocs.data());
     
-    static double fiberArea[10000];
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
+    std::vector<double> fiberArea(numFibers);
+    sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
     
     for (int i = 0; i < numFibers; i++) {
       ABar  += fiberArea[i];
@@ -882,6 +888,8 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
   else
     yBar = 0.0;
 
+  fiberDataCurrent = false;
+
   return res;
 }
 
@@ -944,10 +952,10 @@ FiberSection2d::setResponse(const char **argv, int argc,
   
   if (argc > 2 && strcmp(argv[0],"fiber") == 0) {
 
-    static double fiberLocs[10000];
+    std::vector<double> fiberLocs(numFibers);
     
     if (sectionIntegr != 0) {
-      sectionIntegr->getFiberLocations(numFibers, fiberLocs);
+      sectionIntegr->getFiberLocations(numFibers, fiberLocs.data());
     }  
     else {
       for (int i = 0; i < numFibers; i++) {
@@ -1297,12 +1305,12 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double tangent = 0.0;
   double sig_dAdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> fiberLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
+    sectionIntegr->getFiberLocations(numFibers, fiberLocs.data());
+    sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
   }  
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1311,12 +1319,12 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
-    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv);
+    sectionIntegr->getLocationsDeriv(numFibers, locsDeriv.data());  
+    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv.data());
   }
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1373,12 +1381,12 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
   double tangent = 0.0;
   double dtangentdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> fiberLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
+    sectionIntegr->getFiberLocations(numFibers, fiberLocs.data());
+    sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
   }  
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1387,12 +1395,12 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
-    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv);
+    sectionIntegr->getLocationsDeriv(numFibers, locsDeriv.data());  
+    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv.data());
   }
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1431,21 +1439,21 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double fiberLocs[10000];
+  std::vector<double> fiberLocs(numFibers);
 
   if (sectionIntegr != 0)
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
+    sectionIntegr->getFiberLocations(numFibers, fiberLocs.data());
   else {
     for (int i = 0; i < numFibers; i++)
       fiberLocs[i] = matData[2*i];
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  std::vector<double> locsDeriv(numFibers);
+  std::vector<double> areaDeriv(numFibers);
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
-    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv);
+    sectionIntegr->getLocationsDeriv(numFibers, locsDeriv.data());  
+    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv.data());
   }
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1474,10 +1482,10 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 //by SAJalali
 double FiberSection2d::getEnergy() const
 {
-	static double fiberArea[10000];
+	std::vector<double> fiberArea(numFibers);
 
 	if (sectionIntegr != 0) {
-		sectionIntegr->getFiberWeights(numFibers, fiberArea);
+		sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
 	}
 	else {
 		for (int i = 0; i < numFibers; i++) {
@@ -67,6 +67,7 @@ class FiberSection2d : public SectionForceDeformation
     int   revertToStart(void);
  
     SectionForceDeformation *getCopy(void);
+    bool isThreadSafe(void);
     const ID &getType (void);
     int getOrder (void) const;
     
@@ -99,6 +100,16 @@ class FiberSection2d : public SectionForceDeformation
     int numFibers, sizeFibers;       // number of fibers in the section
     UniaxialMaterial **theMaterials; // array of pointers to materials
     double   *matData;               // data for the materials [yloc and area]
+
+    // fiber data stored as separate contiguous arrays, all carved out
+    // of fiberData; locations are relative to the section centroid
+    void setFiberData(void);
+    void formResultants(void);
+    double   *fiberData;
+    int      sizeFiberData;
+    bool     fiberDataCurrent;
+    double   *fiberY, *fiberArea;
+    double   *fiberStrain, *fiberStress, *fiberTangent;
     double   kData[4];               // data for ks matrix 
     double   sData[2];               // data for s vector 
     
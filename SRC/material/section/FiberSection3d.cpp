@@ -46,6 +46,7 @@
 #include <SectionIntegration.h>
 #include <elementAPI.h>
 #include <string.h>
+#include <vector>
 
 ID FiberSection3d::code(4);
 
@@ -115,6 +116,7 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers,
 			       UniaxialMaterial &torsion, bool compCentroid): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
   sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
@@ -185,6 +187,7 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers,
 FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial &torsion, bool compCentroid): 
     SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
     numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
+    fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
     QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
     sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
@@ -237,6 +240,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 			       bool compCentroid):
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
   sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
@@ -261,18 +265,14 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-  
-  static double fiberArea[10000];
-  sectionIntegr->getFiberWeights(numFibers, fiberArea);
+  // with the centroid at the origin the fiber data holds the locations
+  this->setFiberData();
   
   for (int i = 0; i < numFibers; i++) {
 
     Abar  += fiberArea[i];
-    QzBar += yLocs[i]*fiberArea[i];
-    QyBar += zLocs[i]*fiberArea[i];
+    QzBar += fiberY[i]*fiberArea[i];
+    QyBar += fiberZ[i]*fiberArea[i];
 
     theMaterials[i] = mats[i]->getCopy();
     
@@ -310,6 +310,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 FiberSection3d::FiberSection3d():
   SectionForceDeformation(0, SEC_TAG_FiberSection3d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
+  fiberData(0), sizeFiberData(0), fiberDataCurrent(false),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(true),
   sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
@@ -397,6 +398,8 @@ FiberSection3d::addFiber(Fiber &newFiber)
     yBar = QzBar/Abar;
     zBar = QyBar/Abar;
   }
+
+  fiberDataCurrent = false;
   
   return 0;
 }
@@ -417,6 +420,9 @@ FiberSection3d::~FiberSection3d()
   if (matData != 0)
     delete [] matData;
 
+  if (fiberData != 0)
+    delete [] fiberData;
+
   if (s != 0)
     delete s;
 
@@ -435,106 +441,140 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 {
   int res = 0;
   e = deforms;
- 
-  for (int i = 0; i < 4; i++)
-    sData[i] = 0.0;
-  for (int i = 0; i < 16; i++)
-    kData[i] = 0.0;
+
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   double d0 = deforms(0);
   double d1 = deforms(1);
   double d2 = deforms(2);
   double d3 = deforms(3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  // determine the fiber strains
+  for (int i = 0; i < numFibers; i++)
+    fiberStrain[i] = d0 - fiberY[i]*d1 + fiberZ[i]*d2;
+
+  // set the fiber material states
+  for (int i = 0; i < numFibers; i++)
+    res += theMaterials[i]->setTrial(fiberStrain[i], fiberStress[i], fiberTangent[i]);
+
+  this->formResultants();
  
+  if (theTorsion != 0) {
+    double stress, tangent;
+    res += theTorsion->setTrial(d3, stress, tangent);
+    sData[3] = stress;
+    kData[15] = tangent;
+  }
+
+  return res;
+}
+
+void
+FiberSection3d::setFiberData(void)
+{
+  // make sure there is room for the fiber data
+  if (sizeFiberData < numFibers) {
+    if (fiberData != 0)
+      delete [] fiberData;
+    sizeFiberData = sizeFibers > numFibers ? sizeFibers : numFibers;
+    fiberData = new double [6*sizeFiberData];
+  }
+
+  fiberY       = fiberData;
+  fiberZ       = fiberData +   sizeFiberData;
+  fiberArea    = fiberData + 2*sizeFiberData;
+  fiberStrain  = fiberData + 3*sizeFiberData;
+  fiberStress  = fiberData + 4*sizeFiberData;
+  fiberTangent = fiberData + 5*sizeFiberData;
+
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
+    sectionIntegr->getFiberLocations(numFibers, fiberY, fiberZ);
     sectionIntegr->getFiberWeights(numFibers, fiberArea);
   }  
   else {
-	
     for (int i = 0; i < numFibers; i++) {
-		
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
+      fiberY[i] = matData[3*i];
+      fiberZ[i] = matData[3*i+1];
       fiberArea[i] = matData[3*i+2];
     }
   }
- 
-  double tangent, stress;
+
+  // locations relative to the centroid
   for (int i = 0; i < numFibers; i++) {
-    double y = yLocs[i] - yBar;
-    double z = zLocs[i] - zBar;
-    double A = fiberArea[i];
+    fiberY[i] -= yBar;
+    fiberZ[i] -= zBar;
+  }
 
-    // determine material strain and set it
-    double strain = d0 - y*d1 + z*d2;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
+  // the section integration may have its parameters changed, so its
+  // locations and weights are obtained each time they are needed
+  fiberDataCurrent = (sectionIntegr == 0);
+}
 
-    double value = tangent * A;
-    double vas1 = -y*value;
-    double vas2 = z*value;
-    double vas1as2 = vas1*z;
+void
+FiberSection3d::formResultants(void)
+{
+  double k0 = 0.0, k1 = 0.0, k2 = 0.0, k5 = 0.0, k6 = 0.0, k10 = 0.0;
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0;
 
-    kData[0] += value;
-    kData[1] += vas1;
-    kData[2] += vas2;
-    
-    kData[5] += vas1 * -y;
-    kData[6] += vas1as2;
-    
-    kData[10] += vas2 * z; 
+#ifdef _OPENMP
+#pragma omp simd reduction(+:k0,k1,k2,k5,k6,k10,s0,s1,s2)
+#endif
+  for (int i = 0; i < numFibers; i++) {
+    double y = fiberY[i];
+    double z = fiberZ[i];
+    double A = fiberArea[i];
 
-    double fs0 = stress * A;
+    double value = fiberTangent[i] * A;
+    double vas1 = -y*value;
+    double vas2 = z*value;
 
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
-    sData[2] += fs0 * z;
+    k0 += value;
+    k1 += vas1;
+    k2 += vas2;
+    k5 += vas1 * -y;
+    k6 += vas1 * z;
+    k10 += vas2 * z;
+
+    double fs0 = fiberStress[i] * A;
+    s0 += fs0;
+    s1 += fs0 * -y;
+    s2 += fs0 * z;
   }
 
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
- 
-  if (theTorsion != 0) {
-    res += theTorsion->setTrial(d3, stress, tangent);
-    sData[3] = stress;
-    kData[15] = tangent;
-  }
+  for (int i = 0; i < 16; i++)
+    kData[i] = 0.0;
 
-  return res;
+  kData[0] = k0;
+  kData[1] = k1;
+  kData[2] = k2;
+  kData[4] = k1;
+  kData[5] = k5;
+  kData[6] = k6;
+  kData[8] = k2;
+  kData[9] = k6;
+  kData[10] = k10;
+
+  sData[0] = s0;
+  sData[1] = s1;
+  sData[2] = s2;
+  sData[3] = 0.0;
 }
 
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  static thread_local double kInitialData[16];
+  static thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
-
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   for (int i = 0; i < numFibers; i++) {
-    double y = yLocs[i] - yBar;
-    double z = zLocs[i] - zBar;
+    double y = fiberY[i];
+    double z = fiberZ[i];
     double A = fiberArea[i];
 
     double tangent = theMaterials[i]->getInitialTangent();
@@ -649,6 +689,23 @@ FiberSection3d::getCopy(void)
   return theCopy;
 }
 
+bool
+FiberSection3d::isThreadSafe(void)
+{
+  // the fiber layout of a SectionIntegration is not audited
+  if (sectionIntegr != 0)
+    return false;
+
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isThreadSafe() == false)
+      return false;
+
+  if (theTorsion != 0 && theTorsion->isThreadSafe() == false)
+    return false;
+
+  return true;
+}
+
 const ID&
 FiberSection3d::getType ()
 {
@@ -680,69 +737,26 @@ FiberSection3d::revertToLastCommit(void)
 {
   int err = 0;
 
-  kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
-  kData[4] = 0.0; kData[5] = 0.0; kData[6] = 0.0; kData[7] = 0.0;
-  kData[8] = 0.0; 
-  kData[15] = 0.0;
-  sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
-
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
-
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
-    double y = yLocs[i] - yBar;
-    double z = zLocs[i] - zBar;
-    double A = fiberArea[i];
 
     // invoke revertToLast on the material
     err += theMat->revertToLastCommit();
 
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
-
-    double value = tangent * A;
-    double vas1 = -y*value;
-    double vas2 = z*value;
-    double vas1as2 = vas1*z;
-
-    kData[0] += value;
-    kData[1] += vas1;
-    kData[2] += vas2;
-    
-    kData[5] += vas1 * -y;
-    kData[6] += vas1as2;
-    
-    kData[10] += vas2 * z; 
-
-    double fs0 = stress * A;
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
-    sData[2] += fs0 * z;
+    fiberTangent[i] = theMat->getTangent();
+    fiberStress[i] = theMat->getStress();
   }
 
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
+  this->formResultants();
 
   if (theTorsion != 0) {
     err += theTorsion->revertToLastCommit();
     kData[15] = theTorsion->getTangent();
-  } else
-    kData[15] = 0.0;
+    sData[3] = theTorsion->getStress();
+  }
 
   return err;
 }
@@ -753,71 +767,25 @@ FiberSection3d::revertToStart(void)
   // revert the fibers to start    
   int err = 0;
 
-  kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
-  kData[4] = 0.0; kData[5] = 0.0; kData[6] = 0.0; kData[7] = 0.0;
-  kData[8] = 0.0;
-  kData[15] = 0.0; 
-  sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
-
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
-
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
   for (int i = 0; i < numFibers; i++) {
     UniaxialMaterial *theMat = theMaterials[i];
-    double y = yLocs[i] - yBar;
-    double z = zLocs[i] - zBar;
-    double A = fiberArea[i];
 
     // invoke revertToStart on the material
     err += theMat->revertToStart();
 
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
-
-    double value = tangent * A;
-    double vas1 = -y*value;
-    double vas2 = z*value;
-    double vas1as2 = vas1*z;
-
-    kData[0] += value;
-    kData[1] += vas1;
-    kData[2] += vas2;
-    
-    kData[5] += vas1 * -y;
-    kData[6] += vas1as2;
-    
-    kData[10] += vas2 * z; 
-
-    double fs0 = stress * A;
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
-    sData[2] += fs0 * z;
+    fiberTangent[i] = theMat->getTangent();
+    fiberStress[i] = theMat->getStress();
   }
 
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
+  this->formResultants();
 
   if (theTorsion != 0) {
     err += theTorsion->revertToStart();
     kData[15] = theTorsion->getTangent();
     sData[3] = theTorsion->getStress();
-  } else {
-    kData[15] = 0.0;
-    sData[3] = 0.0;
   }
 
   return err;
@@ -1061,12 +1029,12 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
     computeCentroid = data(5) ? true : false;
 
     if (sectionIntegr != 0) {
-      static double yLocs[10000];
-      static double zLocs[10000];
-      sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
+      std::vector<double> yLocs(numFibers);
+      std::vector<double> zLocs(numFibers);
+      sectionIntegr->getFiberLocations(numFibers, yLocs.data(), zLocs.data());
       
-      static double fiberArea[10000];
-      sectionIntegr->getFiberWeights(numFibers, fiberArea);
+      std::vector<double> fiberArea(numFibers);
+      sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
       
       for (int i = 0; i < numFibers; i++) {
 	Abar  += fiberArea[i];
@@ -1095,6 +1063,8 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
     }
   }   
 
+  fiberDataCurrent = false;
+
   return res;
 }
 
@@ -1166,12 +1136,13 @@ FiberSection3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
   Response *theResponse = 0;
   
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
   
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
+    sectionIntegr->getFiberLocations(numFibers, yLocs.data(), zLocs.data());
+    sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
   }  
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1344,12 +1315,13 @@ FiberSection3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 FiberSection3d::getResponse(int responseID, Information &sectInfo)
 {
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  std::vector<double> yLocs(numFibers);
+  std::vector<double> zLocs(numFibers);
+  std::vector<double> fiberArea(numFibers);
   
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
+    sectionIntegr->getFiberLocations(numFibers, yLocs.data(), zLocs.data());
+    sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
   }  
   else {
     for (int i = 0; i < numFibers; i++) {
@@ -1507,41 +1479,21 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double sig_dAdh = 0;
   double tangent = 0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
-
-  if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
-    }
-  }
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  std::vector<double> dydh(numFibers, 0.0);
+  std::vector<double> dzdh(numFibers, 0.0);
+  std::vector<double> areaDeriv(numFibers, 0.0);
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
-    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv);
-  }
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      dydh[i] = 0.0;
-      dzdh[i] = 0.0;
-      areaDeriv[i] = 0.0;
-    }
+    sectionIntegr->getLocationsDeriv(numFibers, dydh.data(), dzdh.data());  
+    sectionIntegr->getWeightsDeriv(numFibers, areaDeriv.data());
   }
   
   for (int i = 0; i < numFibers; i++) {
-    y = yLocs[i] - yBar;
-    z = zLocs[i] - zBar;
+    y = fiberY[i];
+    z = fiberZ[i];
     A = fiberArea[i];
     
     dsigdh = theMaterials[i]->getStressSensitivity(gradIndex, conditional);
@@ -1616,37 +1568,22 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  if (fiberDataCurrent == false)
+    this->setFiberData();
 
-  if (sectionIntegr != 0)
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-    }
-  }
-
-  static double dydh[10000];
-  static double dzdh[10000];
+  std::vector<double> dydh(numFibers, 0.0);
+  std::vector<double> dzdh(numFibers, 0.0);
 
   if (sectionIntegr != 0)
-    sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
-  else {
-    for (int i = 0; i < numFibers; i++) {
-      dydh[i] = 0.0;
-      dzdh[i] = 0.0;
-    }
-  }
+    sectionIntegr->getLocationsDeriv(numFibers, dydh.data(), dzdh.data());  
 
   double y, z;
 
   double depsdh = 0;
 
   for (int i = 0; i < numFibers; i++) {
-    y = yLocs[i] - yBar;
-    z = zLocs[i] - zBar;
+    y = fiberY[i];
+    z = fiberZ[i];
 
     // determine material strain and set it
     depsdh = d0 - y*d1 + z*d2 - dydh[i]*e(1) + dzdh[i]*e(2);
@@ -1665,10 +1602,10 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 //by SAJalali
 double FiberSection3d::getEnergy() const
 {
-	static double fiberArea[10000];
+	std::vector<double> fiberArea(numFibers);
 
 	if (sectionIntegr != 0) {
-		sectionIntegr->getFiberWeights(numFibers, fiberArea);
+		sectionIntegr->getFiberWeights(numFibers, fiberArea.data());
 	}
 	else {
 		for (int i = 0; i < numFibers; i++) {
@@ -68,6 +68,7 @@ class FiberSection3d : public SectionForceDeformation
     int   revertToStart(void);
  
     SectionForceDeformation *getCopy(void);
+    bool isThreadSafe(void);
     const ID &getType (void);
     int getOrder (void) const;
     
@@ -99,9 +100,20 @@ class FiberSection3d : public SectionForceDeformation
   protected:
     
   private:
+    void setFiberData(void);         // fill the fiber arrays below
+    void formResultants(void);       // sum fiber stress/tangent into sData/kData
+
     int numFibers, sizeFibers;       // number of fibers in the section
     UniaxialMaterial **theMaterials; // array of pointers to materials
     double   *matData;               // data for the materials [yloc, zloc, area]
+
+    // fiber data stored as separate contiguous arrays, all carved out
+    // of fiberData; locations are relative to the section centroid
+    double   *fiberData;
+    int      sizeFiberData;
+    bool     fiberDataCurrent;
+    double   *fiberY, *fiberZ, *fiberArea;
+    double   *fiberStrain, *fiberStress, *fiberTangent;
     double   kData[16];              // data for ks matrix 
     double   sData[4];               // data for s vector 
 
@@ -94,6 +94,10 @@ class SectionForceDeformation : public Material
   virtual int revertToStart (void) = 0;
   
   virtual SectionForceDeformation *getCopy (void) = 0;
+
+  // true if different objects of the class may be used at the same
+  // time from different threads, i.e. the class keeps no shared scratch
+  virtual bool isThreadSafe(void) {return false;}
   virtual const ID &getType (void) = 0;
   virtual int getOrder (void) const = 0;
   
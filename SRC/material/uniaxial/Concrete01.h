@@ -62,6 +62,7 @@ class Concrete01 : public UniaxialMaterial
   int revertToStart(void);        
   
   UniaxialMaterial *getCopy(void);
+  bool isThreadSafe(void) {return true;}
   
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
@@ -57,6 +57,7 @@ class Concrete02 : public UniaxialMaterial
     const char *getClassType(void) const {return "Concrete02";};    
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) {return true;}
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     double getStrain(void);      
@@ -75,6 +75,10 @@ class UniaxialMaterial : public Material
     
     virtual UniaxialMaterial *getCopy (void) = 0;
     virtual UniaxialMaterial *getCopy(SectionForceDeformation *s);
+
+    // true if different objects of the class may be used at the same
+    // time from different threads, i.e. the class keeps no shared scratch
+    virtual bool isThreadSafe(void) {return false;}
     
     virtual Response *setResponse (const char **argv, int argc, 
 				   OPS_Stream &theOutputStream);
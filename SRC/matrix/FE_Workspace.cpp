@@ -0,0 +1,208 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/FE_Workspace.cpp,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the implementation of FE_Workspace.
+//
+// What: "@(#) FE_Workspace.C, revA"
+
+#include <FE_Workspace.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <string.h>
+
+// size of the blocks of double storage handed out by allocate()
+#define FE_WORKSPACE_BLOCK_SIZE 65536
+
+FE_Workspace &
+FE_Workspace::getWorkspace(void)
+{
+  static thread_local FE_Workspace theWorkspace;
+  return theWorkspace;
+}
+
+
+FE_Workspace::FE_Workspace()
+  :nextFree(0), numFree(0)
+{
+  for (int i=0; i<NumSlots; i++) {
+    scratchMatrix[i] = 0;
+    scratchVector[i] = 0;
+    scratchID[i] = 0;
+  }
+}
+
+
+FE_Workspace::~FE_Workspace()
+{
+  for (int i=0; i<NumSlots; i++) {
+    for (size_t j=0; j<theMatrices[i].size(); j++)
+      if (theMatrices[i][j] != 0)
+	delete theMatrices[i][j];
+    for (size_t j=0; j<theVectors[i].size(); j++)
+      if (theVectors[i][j] != 0)
+	delete theVectors[i][j];
+    if (scratchMatrix[i] != 0)
+      delete scratchMatrix[i];
+    if (scratchVector[i] != 0)
+      delete scratchVector[i];
+    if (scratchID[i] != 0)
+      delete scratchID[i];
+  }
+
+  for (size_t i=0; i<theBlocks.size(); i++)
+    delete [] theBlocks[i];
+}
+
+
+double *
+FE_Workspace::allocate(int size)
+{
+  // large requests get a block of their own
+  if (size > FE_WORKSPACE_BLOCK_SIZE/4) {
+    double *block = new double[size];
+    theBlocks.push_back(block);
+    memset(block, 0, size*sizeof(double));
+    return block;
+  }
+
+  if (size > numFree) {
+    nextFree = new double[FE_WORKSPACE_BLOCK_SIZE];
+    theBlocks.push_back(nextFree);
+    numFree = FE_WORKSPACE_BLOCK_SIZE;
+  }
+
+  double *result = nextFree;
+  nextFree += size;
+  numFree -= size;
+  memset(result, 0, size*sizeof(double));
+  return result;
+}
+
+
+Matrix &
+FE_Workspace::getMatrix(int slot, int size)
+{
+  std::vector<Matrix *> &matrices = theMatrices[slot];
+  if ((int)matrices.size() <= size)
+    matrices.resize(size+1, (Matrix *)0);
+
+  Matrix *theMatrix = matrices[size];
+  if (theMatrix == 0) {
+    theMatrix = new Matrix(this->allocate(size*size), size, size);
+    matrices[size] = theMatrix;
+  }
+
+  return *theMatrix;
+}
+
+
+Vector &
+FE_Workspace::getVector(int slot, int size)
+{
+  std::vector<Vector *> &vectors = theVectors[slot];
+  if ((int)vectors.size() <= size)
+    vectors.resize(size+1, (Vector *)0);
+
+  Vector *theVector = vectors[size];
+  if (theVector == 0) {
+    theVector = new Vector(this->allocate(size), size);
+    vectors[size] = theVector;
+  }
+
+  return *theVector;
+}
+
+
+Matrix &
+FE_Workspace::getScratchMatrix(int slot, int numRows, int numCols)
+{
+  std::vector<double> &data = scratchMatrixData[slot];
+  if ((int)data.size() < numRows*numCols || data.empty())
+    data.resize(numRows*numCols > 0 ? numRows*numCols : 1);
+
+  if (scratchMatrix[slot] == 0)
+    scratchMatrix[slot] = new Matrix(&data[0], numRows, numCols);
+  else
+    scratchMatrix[slot]->setData(&data[0], numRows, numCols);
+
+  return *scratchMatrix[slot];
+}
+
+
+Vector &
+FE_Workspace::getScratchVector(int slot, int size)
+{
+  std::vector<double> &data = scratchVectorData[slot];
+  if ((int)data.size() < size || data.empty())
+    data.resize(size > 0 ? size : 1);
+
+  if (scratchVector[slot] == 0)
+    scratchVector[slot] = new Vector(&data[0], size);
+  else
+    scratchVector[slot]->setData(&data[0], size);
+
+  return *scratchVector[slot];
+}
+
+
+ID &
+FE_Workspace::getScratchID(int slot, int size)
+{
+  std::vector<int> &data = scratchIDData[slot];
+  if ((int)data.size() < size || data.empty())
+    data.resize(size > 0 ? size : 1);
+
+  if (scratchID[slot] == 0)
+    scratchID[slot] = new ID(&data[0], size);
+  else
+    scratchID[slot]->setData(&data[0], size);
+
+  return *scratchID[slot];
+}
+
+
+double *
+FE_Workspace::getScratchData(int slot, int size)
+{
+  std::vector<double> &data = scratchData[slot];
+  if ((int)data.size() < size || data.empty())
+    data.resize(size > 0 ? size : 1);
+
+  return &data[0];
+}
+
+
+void **
+FE_Workspace::getScratchPointers(int slot, int size)
+{
+  std::vector<void *> &data = scratchPointers[slot];
+  if ((int)data.size() < size || data.empty())
+    data.resize(size > 0 ? size : 1, (void *)0);
+
+  return &data[0];
+}
@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/FE_Workspace.h,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the class definition for FE_Workspace.
+// An FE_Workspace holds the Matrix, Vector and scratch objects that the
+// FE_Element and DOF_Group classes (and their transformation, penalty and
+// lagrange subclasses) use to return their tangent and residual, and the
+// class wide objects an Element uses when their size is only known once
+// the element is created, e.g. by the number of dof at its nodes. There is
+// one FE_Workspace per thread, so these objects are shared by all objects
+// of a given size in that thread, as the class wide matrices and vectors
+// they replace were, while calls from different threads do not interfere.
+// The storage for the Matrix and Vector objects is carved out of large
+// blocks which are kept until the thread exits, so once the sizes in the
+// model have been seen no further memory is allocated.
+//
+// What: "@(#) FE_Workspace.h, revA"
+
+#ifndef FE_Workspace_h
+#define FE_Workspace_h
+
+#include <vector>
+
+class Matrix;
+class Vector;
+class ID;
+
+class FE_Workspace
+{
+  public:
+    // the objects are identified by the slot they are used for and size
+    enum Slot {
+      FE_Tangent, FE_Residual, FE_Temp,
+      TransformationFE_Tangent, TransformationFE_Residual,
+      TransformationFE_LocalK, TransformationFE_TtKT,
+      TransformationFE_Response, TransformationFE_Transformations,
+      TransformationFE_NumDOFs,
+      PenaltySP_Tangent, PenaltySP_Residual, MP_Response,
+      DOF_Tangent, DOF_Unbalance,
+      TransformationDOF_Tangent, TransformationDOF_Unbalance,
+      TransformationDOF_Temp, TransformationDOF_Disp,
+      Element_Matrix, Element_Vector1, Element_Vector2,
+      ZeroLength_Tangent, ZeroLength_Residual,
+      TwoNodeLink_Tangent, TwoNodeLink_Residual,
+      NumSlots
+    };
+
+    // the workspace of the calling thread
+    static FE_Workspace &getWorkspace(void);
+
+    // square Matrix and Vector objects, one for each slot and size;
+    // they are zeroed when first created only
+    Matrix &getMatrix(int slot, int size);
+    Vector &getVector(int slot, int size);
+
+    // Matrix, Vector and ID objects, one for each slot, whose data is
+    // set to scratch storage of the requested size; the contents are
+    // not preserved if the size grows
+    Matrix &getScratchMatrix(int slot, int numRows, int numCols);
+    Vector &getScratchVector(int slot, int size);
+    ID &getScratchID(int slot, int size);
+    double *getScratchData(int slot, int size);
+    void **getScratchPointers(int slot, int size);
+
+    ~FE_Workspace();
+
+  private:
+    FE_Workspace();
+    FE_Workspace(const FE_Workspace &);
+    FE_Workspace &operator=(const FE_Workspace &);
+
+    double *allocate(int size);
+
+    std::vector<Matrix *> theMatrices[NumSlots];
+    std::vector<Vector *> theVectors[NumSlots];
+
+    Matrix *scratchMatrix[NumSlots];
+    Vector *scratchVector[NumSlots];
+    ID *scratchID[NumSlots];
+    std::vector<double> scratchMatrixData[NumSlots];
+    std::vector<double> scratchVectorData[NumSlots];
+    std::vector<int> scratchIDData[NumSlots];
+    std::vector<double> scratchData[NumSlots];
+    std::vector<void *> scratchPointers[NumSlots];
+
+    std::vector<double *> theBlocks; // the arena of double storage
+    double *nextFree;
+    int numFree;
+};
+
+#endif
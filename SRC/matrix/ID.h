@@ -84,8 +84,10 @@ class ID
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class MemoryChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class CheckpointDatastore;
     
   private:
     static int ID_NOT_VALID_ENTRY;
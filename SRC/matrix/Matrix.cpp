@@ -34,21 +34,60 @@
 #include "Matrix.h"
 #include "Vector.h"
 #include "ID.h"
+#include "routines/gemmND.h"
 
 #include <stdlib.h>
 #include <iostream>
+#include <new>
+#include <vector>
 using std::nothrow;
 
 #define MATRIX_WORK_AREA 400
 #define INT_WORK_AREA 20
 
+// products with at least this many multiply-adds go to blas dgemm_
+#define MATRIX_BLAS_MIN 32768
+
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
+
+// work areas for Solve(), Invert() and the triple products, one set for
+// each thread; they grow as needed and are freed when the thread exits
+static thread_local std::vector<double> matrixWork;
+static thread_local std::vector<int> intWork;
+
+// the work areas of the calling thread holding at least size entries,
+// 0 if they could not be allocated
+static double *
+doubleWork(int size)
+{
+  if (size < MATRIX_WORK_AREA)
+    size = MATRIX_WORK_AREA;
+  if ((int)matrixWork.size() < size) {
+    try {
+      matrixWork.resize(size);
+    } catch (std::bad_alloc &) {
+      return 0;
+    }
+  }
+  return &matrixWork[0];
+}
+
+static int *
+integerWork(int size)
+{
+  if (size < INT_WORK_AREA)
+    size = INT_WORK_AREA;
+  if ((int)intWork.size() < size) {
+    try {
+      intWork.resize(size);
+    } catch (std::bad_alloc &) {
+      return 0;
+    }
+  }
+  return &intWork[0];
+}
 
 //double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
 
@@ -59,15 +98,6 @@ int    *Matrix::intWork =0;
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 }
 
 
@@ -75,16 +105,6 @@ Matrix::Matrix(int nRows,int nCols)
 :numRows(nRows), numCols(nCols), dataSize(0), data(0), fromFree(0)
 {
 
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
-
 #ifdef _G3DEBUG
     if (nRows < 0) {
       opserr << "WARNING: Matrix::Matrix(int,int): tried to init matrix ";
@@ -119,15 +139,6 @@ Matrix::Matrix(int nRows,int nCols)
 Matrix::Matrix(double *theData, int row, int col) 
 :numRows(row),numCols(col),dataSize(row*col),data(theData),fromFree(1)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
 #ifdef _G3DEBUG
     if (row < 0) {
@@ -148,15 +159,6 @@ Matrix::Matrix(double *theData, int row, int col)
 Matrix::Matrix(const Matrix &other)
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
     numRows = other.numRows;
     numCols = other.numCols;
@@ -342,6 +344,11 @@ extern "C" int  DGETRS(char *TRANS, unsigned int sizeT,
 
 extern "C" int  DGETRI(int *N, double *A, int *LDA, 
 			      int *iPiv, double *Work, int *WORKL, int *INFO);
+
+extern "C" void DGEMM(const char *TRANSA, const char *TRANSB, int *M, int *N, int *K,
+		      double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		      double *BETA, double *C, int *LDC);
+#define dgemm_ DGEMM
 //#endif
 #else
 extern "C" int dgesv_(int *N, int *NRHS, double *A, int *LDA, int *iPiv, 
@@ -360,6 +367,9 @@ extern "C" int dgerfs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
 		       double *X, int *LDX, double *FERR, double *BERR, 
 		       double *WORK, int *IWORK, int *INFO);
 
+extern "C" void dgemm_(const char *TRANSA, const char *TRANSB, int *M, int *N, int *K,
+		       double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		       double *BETA, double *C, int *LDC);
 #endif
 
 int
@@ -387,37 +397,15 @@ Matrix::Solve(const Vector &b, Vector &x) const
 #endif
     
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-        matrixWork = 0;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
+    if (doubleWork(dataSize) == 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-        intWork = 0;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    if (integerWork(n) == 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
 
     
@@ -433,9 +421,9 @@ Matrix::Solve(const Vector &b, Vector &x) const
     int ldA = n;
     int ldB = n;
     int info;
-    double *Aptr = matrixWork;
+    double *Aptr = &matrixWork[0];
     double *Xptr = x.theData;
-    int *iPIV = intWork;
+    int *iPIV = &intWork[0];
     
 
 #ifdef _WIN32
@@ -480,37 +468,15 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-        matrixWork = 0;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
+    if (doubleWork(dataSize) == 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-        intWork = 0;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    if (integerWork(n) == 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
     
     x = b;
@@ -524,10 +490,10 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     int ldA = n;
     int ldB = n;
     int info;
-    double *Aptr = matrixWork;
+    double *Aptr = &matrixWork[0];
     double *Xptr = x.data;
     
-    int *iPIV = intWork;
+    int *iPIV = &intWork[0];
     
 	info = -1;
 
@@ -577,37 +543,15 @@ Matrix::Invert(Matrix &theInverse) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-        matrixWork = 0;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
+    if (doubleWork(dataSize) == 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
 
     // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-        intWork = 0;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    if (integerWork(n) == 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
     
     // copy the data
@@ -618,11 +562,11 @@ Matrix::Invert(Matrix &theInverse) const
 
     int ldA = n;
     int info;
-    double *Wptr = matrixWork;
+    double *Wptr = &matrixWork[0];
     double *Aptr = theInverse.data;
-    int workSize = sizeDoubleWork;
+    int workSize = (int)matrixWork.size();
     
-    int *iPIV = intWork;
+    int *iPIV = &intWork[0];
     
 
 #ifdef _WIN32
@@ -793,6 +737,85 @@ Matrix::addMatrixTranspose(double factThis, const Matrix &other, double factOthe
 }
 
 
+//
+// fixed-size kernels for the shapes that dominate element assembly; each
+// returns true if it handled the product
+//
+
+static inline bool
+fixedMatrixProduct(double thisFact, double *a, int nr, int nk, int nc,
+		   const double *b, const double *c, double otherFact)
+{
+  using namespace OpenSees::gemmND;
+  if (nr != nk || nk != nc)
+    return false;
+
+  switch (nr) {
+  case  3: gemm< 3, 3, 3>(thisFact, a, b, c, otherFact); return true;
+  case  4: gemm< 4, 4, 4>(thisFact, a, b, c, otherFact); return true;
+  case  6: gemm< 6, 6, 6>(thisFact, a, b, c, otherFact); return true;
+  case 12: gemm<12,12,12>(thisFact, a, b, c, otherFact); return true;
+  case 24: gemm<24,24,24>(thisFact, a, b, c, otherFact); return true;
+  default: return false;
+  }
+}
+
+static inline bool
+fixedMatrixTransposeProduct(double thisFact, double *a, int nr, int nk, int nc,
+			    const double *b, const double *c, double otherFact)
+{
+  using namespace OpenSees::gemmND;
+  if (nr != nk || nk != nc)
+    return false;
+
+  switch (nr) {
+  case  3: gemtm< 3, 3, 3>(thisFact, a, b, c, otherFact); return true;
+  case  4: gemtm< 4, 4, 4>(thisFact, a, b, c, otherFact); return true;
+  case  6: gemtm< 6, 6, 6>(thisFact, a, b, c, otherFact); return true;
+  case 12: gemtm<12,12,12>(thisFact, a, b, c, otherFact); return true;
+  case 24: gemtm<24,24,24>(thisFact, a, b, c, otherFact); return true;
+  default: return false;
+  }
+}
+
+// this = thisFact*this + otherFact*T'BT with T(nk,nc), B(nk,nk)
+static inline bool
+fixedMatrixTripleProduct(double thisFact, double *a, int nk, int nc,
+			 const double *t, const double *b, double otherFact)
+{
+  using namespace OpenSees::gemmND;
+  switch (nk*100 + nc) {
+  case  303: gemtmm< 3, 3>(thisFact, a, t, b, otherFact); return true;
+  case  404: gemtmm< 4, 4>(thisFact, a, t, b, otherFact); return true;
+  case  606: gemtmm< 6, 6>(thisFact, a, t, b, otherFact); return true;
+  case 1212: gemtmm<12,12>(thisFact, a, t, b, otherFact); return true;
+  case 2424: gemtmm<24,24>(thisFact, a, t, b, otherFact); return true;
+  // basic to global system of 2d and 3d frame elements
+  case  306: gemtmm< 3, 6>(thisFact, a, t, b, otherFact); return true;
+  case  612: gemtmm< 6,12>(thisFact, a, t, b, otherFact); return true;
+  default:   return false;
+  }
+}
+
+// this = thisFact*this + otherFact*A'BC, all square
+static inline bool
+fixedMatrixTripleProduct(double thisFact, double *a, int nr, int nk, int nl, int nc,
+			 const double *at, const double *b, const double *c, double otherFact)
+{
+  using namespace OpenSees::gemmND;
+  if (nr != nk || nk != nl || nl != nc)
+    return false;
+
+  switch (nr) {
+  case  3: gemtmm< 3, 3, 3, 3>(thisFact, a, at, b, c, otherFact); return true;
+  case  6: gemtmm< 6, 6, 6, 6>(thisFact, a, at, b, c, otherFact); return true;
+  case 12: gemtmm<12,12,12,12>(thisFact, a, at, b, c, otherFact); return true;
+  case 24: gemtmm<24,24,24,24>(thisFact, a, at, b, c, otherFact); return true;
+  default: return false;
+  }
+}
+
+
 int
 Matrix::addMatrixProduct(double thisFact, 
 			 const Matrix &B, 
@@ -807,6 +830,16 @@ Matrix::addMatrixProduct(double thisFact,
       return -1;
     }
 #endif
+    if (fixedMatrixProduct(thisFact, data, numRows, B.numCols, numCols, B.data, C.data, otherFact))
+      return 0;
+
+    if (numRows*numCols*B.numCols >= MATRIX_BLAS_MIN) {
+      int nk = B.numCols;
+      dgemm_("N", "N", &numRows, &numCols, &nk, &otherFact, B.data, &numRows,
+	     C.data, &nk, &thisFact, data, &numRows);
+      return 0;
+    }
+
     // NOTE: looping as per blas3 dgemm_: j,k,i
     if (thisFact == 1.0) {
 
@@ -883,6 +916,16 @@ Matrix::addMatrixTransposeProduct(double thisFact,
   }
 #endif
 
+  if (fixedMatrixTransposeProduct(thisFact, data, numRows, C.numRows, numCols, B.data, C.data, otherFact))
+    return 0;
+
+  if (numRows*numCols*C.numRows >= MATRIX_BLAS_MIN) {
+    int nk = C.numRows;
+    dgemm_("T", "N", &numRows, &numCols, &nk, &otherFact, B.data, &nk,
+	   C.data, &nk, &thisFact, data, &numRows);
+    return 0;
+  }
+
   if (thisFact == 1.0) {
     int numMults = C.numRows;
     double *aijPtr = data;
@@ -949,17 +992,37 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 #endif
 
-    // cheack work area can hold the temporary matrix
+    // common element sizes use a stack temporary rather than matrixWork
     int dimB = B.numCols;
+    if (fixedMatrixTripleProduct(thisFact, data, dimB, numCols, T.data, B.data, otherFact))
+      return 0;
+
+    // cheack work area can hold the temporary matrix
     int sizeWork = dimB * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
-      this->addMatrix(thisFact, T^B*T, otherFact);
+    if (sizeWork > MATRIX_WORK_AREA && sizeWork > (int)matrixWork.size()) {
+      // too big for the work area, form B*T in a temporary with blas
+      double *work = new (nothrow) double[sizeWork];
+      if (work == 0) {
+	this->addMatrix(thisFact, T^B*T, otherFact);
+	return 0;
+      }
+      double zero = 0.0;
+      double one = 1.0;
+      dgemm_("N", "N", &dimB, &numCols, &dimB, &otherFact, B.data, &dimB,
+	     T.data, &dimB, &zero, work, &dimB);
+      dgemm_("T", "N", &numRows, &numCols, &dimB, &one, T.data, &dimB,
+	     work, &dimB, &thisFact, data, &numRows);
+      delete [] work;
       return 0;
     }
 
     // zero out the work area
-    double *matrixWorkPtr = matrixWork;
+    double *matrixWorkPtr = doubleWork(sizeWork);
+    if (matrixWorkPtr == 0) {
+      this->addMatrix(thisFact, T^B*T, otherFact);
+      return 0;
+    }
     for (int l=0; l<sizeWork; l++)
       *matrixWorkPtr++ = 0.0;
     
@@ -1048,16 +1111,38 @@ Matrix::addMatrixTripleProduct(double thisFact,
     }
 #endif
 
+    if (fixedMatrixTripleProduct(thisFact, data, numRows, B.numRows, B.numCols, numCols,
+				 A.data, B.data, C.data, otherFact))
+      return 0;
+
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
-      this->addMatrix(thisFact, A^B*C, otherFact);
+    if (sizeWork > MATRIX_WORK_AREA && sizeWork > (int)matrixWork.size()) {
+      // too big for the work area, form B*C in a temporary with blas
+      double *work = new (nothrow) double[sizeWork];
+      if (work == 0) {
+	this->addMatrix(thisFact, A^B*C, otherFact);
+	return 0;
+      }
+      int rowsB = B.numRows;
+      int colsB = B.numCols;
+      double zero = 0.0;
+      double one = 1.0;
+      dgemm_("N", "N", &rowsB, &numCols, &colsB, &otherFact, B.data, &rowsB,
+	     C.data, &colsB, &zero, work, &rowsB);
+      dgemm_("T", "N", &numRows, &numCols, &rowsB, &one, A.data, &rowsB,
+	     work, &rowsB, &thisFact, data, &numRows);
+      delete [] work;
       return 0;
     }
 
     // zero out the work area
-    double *matrixWorkPtr = matrixWork;
+    double *matrixWorkPtr = doubleWork(sizeWork);
+    if (matrixWorkPtr == 0) {
+      this->addMatrix(thisFact, A^B*C, otherFact);
+      return 0;
+    }
     for (int l=0; l<sizeWork; l++)
       *matrixWorkPtr++ = 0.0;
 
@@ -149,17 +149,15 @@ class Matrix
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class MemoryChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class CheckpointDatastore;
 
   protected:
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
 
     int numRows;
     int numCols;
@@ -34,11 +34,26 @@
 #include "Vector.h"
 #include "Matrix.h"
 #include "ID.h"
+#include "routines/gemmND.h"
 #include <iostream>
 using std::nothrow;
 
 #include <math.h>
 
+// matrix-vector products with at least this many entries go to blas dgemv_
+#define VECTOR_BLAS_MIN 4096
+
+#ifdef _WIN32
+extern "C" void DGEMV(const char *TRANS, int *M, int *N, double *ALPHA,
+		      double *A, int *LDA, double *X, int *INCX,
+		      double *BETA, double *Y, int *INCY);
+#define dgemv_ DGEMV
+#else
+extern "C" void dgemv_(const char *TRANS, int *M, int *N, double *ALPHA,
+		       double *A, int *LDA, double *X, int *INCX,
+		       double *BETA, double *Y, int *INCY);
+#endif
+
 double Vector::VECTOR_NOT_VALID_ENTRY =0.0;
 
 // Vector():
@@ -325,6 +340,46 @@ Vector::addVector(double thisFact, const Vector &other, double otherFact )
 }
 	    
 	
+//
+// fixed-size kernels for the shapes that dominate element state
+// determination; each returns true if it handled the product
+//
+
+static inline bool
+fixedMatrixVector(double thisFact, double *y, int nr, int nc,
+		  const double *a, const double *x, double otherFact)
+{
+  using namespace OpenSees::gemmND;
+  switch (nr*100 + nc) {
+  case  303: gemv< 3, 3>(thisFact, y, a, x, otherFact); return true;
+  case  606: gemv< 6, 6>(thisFact, y, a, x, otherFact); return true;
+  case 1212: gemv<12,12>(thisFact, y, a, x, otherFact); return true;
+  case 2424: gemv<24,24>(thisFact, y, a, x, otherFact); return true;
+  // global to basic system of 2d and 3d frame elements
+  case  306: gemv< 3, 6>(thisFact, y, a, x, otherFact); return true;
+  case  612: gemv< 6,12>(thisFact, y, a, x, otherFact); return true;
+  default:   return false;
+  }
+}
+
+static inline bool
+fixedMatrixTransposeVector(double thisFact, double *y, int nr, int nc,
+			   const double *a, const double *x, double otherFact)
+{
+  using namespace OpenSees::gemmND;
+  switch (nr*100 + nc) {
+  case  303: gemtv< 3, 3>(thisFact, y, a, x, otherFact); return true;
+  case  606: gemtv< 6, 6>(thisFact, y, a, x, otherFact); return true;
+  case 1212: gemtv<12,12>(thisFact, y, a, x, otherFact); return true;
+  case 2424: gemtv<24,24>(thisFact, y, a, x, otherFact); return true;
+  // basic to global system of 2d and 3d frame elements
+  case  306: gemtv< 3, 6>(thisFact, y, a, x, otherFact); return true;
+  case  612: gemtv< 6,12>(thisFact, y, a, x, otherFact); return true;
+  default:   return false;
+  }
+}
+
+
 int
 Vector::addMatrixVector(double thisFact, const Matrix &m, const Vector &v, double otherFact )
 {
@@ -342,6 +397,18 @@ Vector::addMatrixVector(double thisFact, const Matrix &m, const Vector &v, doubl
   }
 #endif
 
+  if (fixedMatrixVector(thisFact, theData, m.numRows, m.numCols, m.data, v.theData, otherFact))
+    return 0;
+
+  if (m.numRows*m.numCols >= VECTOR_BLAS_MIN) {
+    int nr = m.numRows;
+    int nc = m.numCols;
+    int one = 1;
+    dgemv_("N", &nr, &nc, &otherFact, m.data, &nr,
+	   v.theData, &one, &thisFact, theData, &one);
+    return 0;
+  }
+
   if (thisFact == 1.0) {
 
     // want: this += m * v * otherFact
@@ -475,6 +542,18 @@ Vector::addMatrixTransposeVector(double thisFact,
   }
 #endif
 
+  if (fixedMatrixTransposeVector(thisFact, theData, m.numRows, m.numCols, m.data, v.theData, otherFact))
+    return 0;
+
+  if (m.numRows*m.numCols >= VECTOR_BLAS_MIN) {
+    int nr = m.numRows;
+    int nc = m.numCols;
+    int one = 1;
+    dgemv_("T", &nr, &nc, &otherFact, m.data, &nr,
+	   v.theData, &one, &thisFact, theData, &one);
+    return 0;
+  }
+
   if (thisFact == 1.0) {
 
     // want: this += m^t * v * otherFact
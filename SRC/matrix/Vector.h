@@ -120,8 +120,10 @@ class Vector
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;    
     friend class MPI_Channel;
+    friend class MemoryChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class CheckpointDatastore;
     
   private:
     static double VECTOR_NOT_VALID_ENTRY;
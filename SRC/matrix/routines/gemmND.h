@@ -0,0 +1,147 @@
+//===----------------------------------------------------------------------===//
+//
+//                                   xara
+//                              https://xara.so
+//
+//===----------------------------------------------------------------------===//
+//
+// Copyright (c) 2025, Claudio M. Perez
+// All rights reserved.  No warranty, explicit or implicit, is provided.
+//
+// This source code is licensed under the BSD 2-Clause License.
+// See LICENSE file or https://opensource.org/licenses/BSD-2-Clause
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Fixed-size dense kernels on raw column-major storage. The
+// loop bounds are template parameters so the compiler can fully unroll
+// and vectorize them; Matrix and Vector dispatch to these for the element
+// sizes that dominate assembly (3, 6, 12, 24, ...).
+//
+// All kernels follow the Matrix/Vector convention
+//
+//     C = thisFact*C + otherFact*op(A)*op(B)
+//
+// where thisFact == 0 overwrites C and thisFact == 1 accumulates into it.
+//
+#ifndef gemmND_h
+#define gemmND_h
+
+namespace OpenSees {
+namespace gemmND {
+
+template <int N>
+inline void
+scale(double thisFact, double *c)
+{
+  if (thisFact == 1.0)
+    return;
+  if (thisFact == 0.0) {
+    for (int i=0; i<N; i++)
+      c[i] = 0.0;
+  } else {
+    for (int i=0; i<N; i++)
+      c[i] *= thisFact;
+  }
+}
+
+// C(nr,nc) = thisFact*C + otherFact*A(nr,nk)*B(nk,nc)
+template <int nr, int nk, int nc>
+inline void
+gemm(double thisFact, double *c, const double *a, const double *b, double otherFact)
+{
+  scale<nr*nc>(thisFact, c);
+  // j,k,i as per blas3 dgemm_
+  for (int j=0; j<nc; j++) {
+    double *cj = &c[j*nr];
+    for (int k=0; k<nk; k++) {
+      const double bkj = b[j*nk + k] * otherFact;
+      const double *ak = &a[k*nr];
+      for (int i=0; i<nr; i++)
+        cj[i] += ak[i] * bkj;
+    }
+  }
+}
+
+// C(nr,nc) = thisFact*C + otherFact*A(nk,nr)'*B(nk,nc)
+template <int nr, int nk, int nc>
+inline void
+gemtm(double thisFact, double *c, const double *a, const double *b, double otherFact)
+{
+  for (int j=0; j<nc; j++) {
+    const double *bj = &b[j*nk];
+    for (int i=0; i<nr; i++) {
+      const double *ai = &a[i*nk];
+      double sum = 0.0;
+      for (int k=0; k<nk; k++)
+        sum += ai[k] * bj[k];
+      double &cij = c[j*nr + i];
+      if (thisFact == 0.0)
+        cij = sum * otherFact;
+      else if (thisFact == 1.0)
+        cij += sum * otherFact;
+      else
+        cij = cij * thisFact + sum * otherFact;
+    }
+  }
+}
+
+// C(nc,nc) = thisFact*C + otherFact*A(nk,nc)'*B(nk,nk)*A
+template <int nk, int nc>
+inline void
+gemtmm(double thisFact, double *c, const double *a, const double *b, double otherFact)
+{
+  // the intermediate product lives on the stack rather than in
+  // Matrix::matrixWork
+  double work[nk*nc];
+  gemm<nk,nk,nc>(0.0, work, b, a, otherFact);
+  gemtm<nc,nk,nc>(thisFact, c, a, work, 1.0);
+}
+
+// C(nr,nc) = thisFact*C + otherFact*A(nk,nr)'*B(nk,nl)*D(nl,nc)
+template <int nr, int nk, int nl, int nc>
+inline void
+gemtmm(double thisFact, double *c, const double *a, const double *b, const double *d, double otherFact)
+{
+  double work[nk*nc];
+  gemm<nk,nl,nc>(0.0, work, b, d, otherFact);
+  gemtm<nr,nk,nc>(thisFact, c, a, work, 1.0);
+}
+
+// y(nr) = thisFact*y + otherFact*A(nr,nc)*x
+template <int nr, int nc>
+inline void
+gemv(double thisFact, double *y, const double *a, const double *x, double otherFact)
+{
+  scale<nr>(thisFact, y);
+  for (int j=0; j<nc; j++) {
+    const double xj = x[j] * otherFact;
+    const double *aj = &a[j*nr];
+    for (int i=0; i<nr; i++)
+      y[i] += aj[i] * xj;
+  }
+}
+
+// y(nc) = thisFact*y + otherFact*A(nr,nc)'*x
+template <int nr, int nc>
+inline void
+gemtv(double thisFact, double *y, const double *a, const double *x, double otherFact)
+{
+  for (int j=0; j<nc; j++) {
+    const double *aj = &a[j*nr];
+    double sum = 0.0;
+    for (int i=0; i<nr; i++)
+      sum += aj[i] * x[i];
+    if (thisFact == 0.0)
+      y[j] = sum * otherFact;
+    else if (thisFact == 1.0)
+      y[j] += sum * otherFact;
+    else
+      y[j] = y[j] * thisFact + sum * otherFact;
+  }
+}
+
+} // namespace gemmND
+} // namespace OpenSees
+
+#endif // gemmND_h
@@ -45,6 +45,7 @@
 #include <MeshRegion.h>
 
 #include <StandardStream.h>
+#include <AsyncStream.h>
 #include <DataFileStream.h>
 #include <DataFileStreamAdd.h>
 #include <XmlFileStream.h>
@@ -334,6 +335,8 @@ ElementRecorder::ElementRecorder(const ID *ele,
  echoTimeFlag(echoTime), deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0), data(0),
  initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
 {
+  // hand the data to the background writer when recording asynchronously
+  theOutputHandler = AsyncStream::wrap(theOutputHandler);
 
   if (ele != 0) {
     numEle = ele->Size();
@@ -42,6 +42,7 @@
 #include <TimeSeries.h>
 
 #include <StandardStream.h>
+#include <AsyncStream.h>
 #include <DataFileStream.h>
 #include <DataFileStreamAdd.h>
 #include <XmlFileStream.h>
@@ -339,6 +340,8 @@ NodeRecorder::NodeRecorder(const ID &dofs,
  initializationDone(false), numValidNodes(0), addColumnInfo(0),
  theTimeSeries(theSeries), timeSeriesValues(0)
 {
+  // hand the data to the background writer when recording asynchronously
+  theOutputHandler = AsyncStream::wrap(theOutputHandler);
 
   //
   // store copy of dof's to be recorder, verifying dof are valid, i.e. >= 0
@@ -36,7 +36,7 @@ OPS_Stream *opserrPtr  = &sserr;
 
 double        ops_Dt = 0;
 Domain       *ops_TheActiveDomain = 0;
-Element      *ops_TheActiveElement = 0;
+thread_local Element      *ops_TheActiveElement = 0;
 
 #include <OpenGLRenderer.h>
 #include <PlainMap.h>
@@ -827,7 +827,11 @@ TclCommand_numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
   if (algo == nullptr)
     return TCL_ERROR;
 
-  Tcl_SetObjResult(interp, Tcl_NewIntObj(algo->getNumFactorizations()));
+  // numFact <-saved>
+  if (argc > 1 && strcmp(argv[1], "-saved") == 0)
+    Tcl_SetObjResult(interp, Tcl_NewIntObj(algo->getNumFactorizationsSaved()));
+  else
+    Tcl_SetObjResult(interp, Tcl_NewIntObj(algo->getNumFactorizations()));
 
   return TCL_OK;
 }
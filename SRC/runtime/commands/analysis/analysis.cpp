@@ -290,6 +290,10 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
              (strcmp(argv[loc], "-fullGenLapackEigen") == 0))
       typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
 
+    else if ((strcmp(argv[loc], "blockLanczos") == 0) ||
+             (strcmp(argv[loc], "-blockLanczos") == 0))
+      typeSolver = EigenSOE_TAGS_BlockLanczosSOE;
+
     else {
       opserr << "eigen - unknown option: " << argv[loc] << endln;
     }
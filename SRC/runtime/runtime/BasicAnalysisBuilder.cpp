@@ -41,6 +41,7 @@
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <ArpackSOE.h>
+#include <BlockLanczosSOE.h>
 #include <ProfileSPDLinSOE.h>
 #include <NewtonRaphson.h>
 #include <RCM.h>
@@ -742,6 +743,9 @@ BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
         FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
         theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+    } else if (typeSolver == EigenSOE_TAGS_BlockLanczosSOE) {
+        theEigenSOE = new BlockLanczosSOE(shift);
+
     } else {
         theEigenSOE = new ArpackSOE(shift);
     }
@@ -0,0 +1,205 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSOE.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the implementation of BlockLanczosSOE.
+
+#include <BlockLanczosSOE.h>
+#include <BlockLanczosSolver.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Graph.h>
+#include <AnalysisModel.h>
+#include <LinearSOE.h>
+
+BlockLanczosSOE::BlockLanczosSOE(double s, int p)
+:EigenSOE(EigenSOE_TAGS_BlockLanczosSOE),
+ M(0), Msize(0), mDiagonal(false), shift(s), blockSize(p),
+ theModel(0), theSOE(0)
+{
+  BlockLanczosSolver *theSolvr = new BlockLanczosSolver();
+  this->setSolver(*theSolvr);
+  theSolvr->setEigenSOE(*this);
+}
+
+BlockLanczosSOE::~BlockLanczosSOE()
+{
+  if (M != 0) delete [] M;
+}
+
+int
+BlockLanczosSOE::getNumEqn(void) const
+{
+  if (theSOE != 0)
+    return theSOE->getNumEqn();
+  else
+    return 0;
+}
+
+int
+BlockLanczosSOE::setSize(Graph &theGraph)
+{
+  if (theSOE == 0)
+    return -1;
+
+  // the LinearSOE has already been sized by the analysis
+  int size = theGraph.getNumVertex();
+
+  if (size != Msize && size > 0) {
+    if (M != 0)
+      delete [] M;
+    M = new double[size];
+    Msize = size;
+  }
+
+  EigenSolver *theSolvr = this->getSolver();
+  if (theSolvr == 0) {
+    opserr << "BlockLanczosSOE::setSize(Graph &theGraph) - no EigenSolver set\n";
+    return -1;
+  }
+
+  int solverOK = theSolvr->setSize();
+  if (solverOK < 0) {
+    opserr << "WARNING:BlockLanczosSOE::setSize() -  solver failed setSize()\n";
+    return solverOK;
+  }
+
+  return 0;
+}
+
+int
+BlockLanczosSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::addA() - no SOE set\n";
+    return -1;
+  }
+
+  // check for a quick return
+  if (fact == 0.0)  return 0;
+
+  return theSOE->addA(m, id, fact);
+}
+
+void
+BlockLanczosSOE::zeroA(void)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::zeroA() - no SOE set\n";
+    return;
+  }
+  theSOE->zeroA();
+}
+
+int
+BlockLanczosSOE::addM(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::addM() - no SOE set\n";
+    return -1;
+  }
+
+  // the LinearSOE holds K - shift*M
+  int res = this->addA(m, id, -shift);
+  if (res < 0)
+    return res;
+
+  if (mDiagonal == false)
+    return res;
+
+  // keep the diagonal of M while it stays diagonal, otherwise the
+  // solver forms M*x from the elements
+  int idSize = id.Size();
+  for (int i=0; i<idSize; i++) {
+    int locI = id(i);
+    if (locI >= 0 && locI < Msize) {
+      for (int j=0; j<idSize; j++) {
+	int locJ = id(j);
+	if (locJ >= 0 && locJ < Msize) {
+	  if (locI == locJ) {
+	    M[locI] += m(i,i);
+	  } else if (m(i,j) != 0.0) {
+	    mDiagonal = false;
+	    return res;
+	  }
+	}
+      }
+    }
+  }
+
+  return 0;
+}
+
+void
+BlockLanczosSOE::zeroM(void)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::zeroM() - no SOE set\n";
+    return;
+  }
+
+  mDiagonal = true;
+  for (int i=0; i<Msize; i++)
+    M[i] = 0.0;
+}
+
+double
+BlockLanczosSOE::getShift(void)
+{
+  return shift;
+}
+
+int
+BlockLanczosSOE::getBlockSize(void)
+{
+  return blockSize;
+}
+
+int
+BlockLanczosSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+BlockLanczosSOE::recvSelf(int commitTag, Channel &theChannel,
+			  FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
+
+int
+BlockLanczosSOE::setLinks(AnalysisModel &theAnalysisModel)
+{
+  theModel = &theAnalysisModel;
+  return 0;
+}
+
+int
+BlockLanczosSOE::setLinearSOE(LinearSOE &theLinearSOE)
+{
+  theSOE = &theLinearSOE;
+  return 0;
+}
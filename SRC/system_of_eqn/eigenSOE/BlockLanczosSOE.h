@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSOE.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the class definition for
+// BlockLanczosSOE. Like the ArpackSOE it uses the LinearSOE of the
+// analysis to hold K - shift*M; the BlockLanczosSolver then applies
+// the shift-invert operator to a whole block of vectors at a time
+// through LinearSOE::solveMultiple().
+
+#ifndef BlockLanczosSOE_h
+#define BlockLanczosSOE_h
+
+#include <EigenSOE.h>
+
+class AnalysisModel;
+class BlockLanczosSolver;
+class LinearSOE;
+
+class BlockLanczosSOE : public EigenSOE
+{
+  public:
+    BlockLanczosSOE(double shift = 0.0, int blockSize = 0);
+    ~BlockLanczosSOE();
+
+    int setLinks(AnalysisModel &theModel);
+    int setLinearSOE(LinearSOE &theSOE);
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addM(const Matrix &, const ID &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroM(void);
+
+    double getShift(void);
+    int getBlockSize(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    friend class BlockLanczosSolver;
+
+  protected:
+
+  private:
+    double *M;        // diagonal of the mass matrix, if it is diagonal
+    int Msize;
+    bool mDiagonal;
+    double shift;
+    int blockSize;    // 0 - let the solver choose
+    AnalysisModel *theModel;
+    LinearSOE *theSOE;
+};
+
+#endif
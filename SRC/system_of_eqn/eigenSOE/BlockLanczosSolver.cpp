@@ -0,0 +1,625 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSolver.cpp,v $
+
+// Written: 10/26
+//
+// Description: This file contains the implementation of BlockLanczosSolver.
+//
+// With Op = (K - shift*M)^-1 M and an M orthonormal basis V the solver
+// keeps the relation
+//
+//     Op V_k = V_k T_k + Q R E^T
+//
+// where T_k = V_k^T M Op V_k is formed explicitly while the new block
+// is reorthogonalized against all of V, Q is the next block and E
+// selects the last p columns. The eigenvalues theta of T_k give
+// lambda = shift + 1/theta and ||R s_last|| bounds the residual of each
+// Ritz pair. When the basis is full it is compressed onto the wanted
+// Ritz vectors (thick restart) and the iteration continues from Q.
+
+#include <BlockLanczosSolver.h>
+#include <BlockLanczosSOE.h>
+#include <LinearSOE.h>
+#include <AnalysisModel.h>
+#include <FE_EleIter.h>
+#include <FE_Element.h>
+#include <DOF_GrpIter.h>
+#include <DOF_Group.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <math.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+extern "C" int DGEMM(char *transA, char *transB, int *M, int *N, int *K,
+		     double *alpha, double *A, int *lda, double *B, int *ldb,
+		     double *beta, double *C, int *ldc);
+
+extern "C" int DSYEV(char *jobz, char *uplo, int *n, double *A, int *lda,
+		     double *w, double *work, int *lwork, int *info);
+
+#else
+
+extern "C" int dgemm_(char *transA, char *transB, int *M, int *N, int *K,
+		      double *alpha, double *A, int *lda, double *B, int *ldb,
+		      double *beta, double *C, int *ldc);
+
+extern "C" int dsyev_(char *jobz, char *uplo, int *n, double *A, int *lda,
+		      double *w, double *work, int *lwork, int *info);
+
+#endif
+
+// number of rows of V recombined at a time during a restart
+#define BLOCK_LANCZOS_CHUNK 256
+
+// C = alpha op(A) op(B) + beta C on column major arrays
+static void
+blockGemm(char transA, char transB, int m, int n, int k,
+	  double alpha, double *A, int lda, double *B, int ldb,
+	  double beta, double *C, int ldc)
+{
+  if (m == 0 || n == 0)
+    return;
+
+#ifdef _WIN32
+  DGEMM(&transA, &transB, &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+#else
+  dgemm_(&transA, &transB, &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc);
+#endif
+}
+
+static double
+blockDot(int n, const double *a, const double *b)
+{
+  double sum = 0.0;
+  for (int i=0; i<n; i++)
+    sum += a[i]*b[i];
+  return sum;
+}
+
+
+BlockLanczosSolver::BlockLanczosSolver(double t, int maxSteps)
+:EigenSolver(EigenSOLVER_TAGS_BlockLanczosSolver),
+ theBlockSOE(0), theSOE(0), tol(t), maxBlockSteps(maxSteps),
+ size(0), numMode(0), eigenvalues(0), eigenvectors(0),
+ V(0), MV(0), T(0), work(0), sizeV(0), sizeT(0), sizeWork(0),
+ seed(1)
+{
+
+}
+
+
+BlockLanczosSolver::~BlockLanczosSolver()
+{
+  if (eigenvalues != 0)
+    delete [] eigenvalues;
+  if (eigenvectors != 0)
+    delete [] eigenvectors;
+  if (V != 0)
+    delete [] V;
+  if (MV != 0)
+    delete [] MV;
+  if (T != 0)
+    delete [] T;
+  if (work != 0)
+    delete [] work;
+}
+
+
+int
+BlockLanczosSolver::solve(int numModes, bool generalized, bool findSmallest)
+{
+  if (generalized == false) {
+    opserr << "BlockLanczosSolver::solve() - at moment only solves generalized problem\n";
+    return -1;
+  }
+
+  theSOE = theBlockSOE->theSOE;
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSolver::solve() - no LinearSOE set\n";
+    return -1;
+  }
+
+  int n = size;
+  int nev = numModes;
+  double shift = theBlockSOE->getShift();
+
+  if (nev < 1 || n < nev + 2) {
+    opserr << "BlockLanczosSolver::solve() - numModes " << nev
+	   << " must be less than the number of equations - 1 (" << n << ")\n";
+    return -1;
+  }
+
+  //
+  // block size p and largest basis m, with m >= nev + p so that a
+  // restart always leaves room for another block
+  //
+
+  int p = theBlockSOE->getBlockSize();
+  if (p <= 0)
+    p = (nev < 16) ? nev : 16;
+  if (p > (n - nev)/2)
+    p = (n - nev)/2;
+
+  int m = (2*nev > nev + 4*p) ? 2*nev : nev + 4*p;
+  if (m > n - p)
+    m = n - p;
+
+  int ldT = m + p;
+
+  //
+  // set up the space; V and MV hold the basis plus the next block
+  //
+
+  size_t neededV = (size_t)n*ldT;
+  if (sizeV < neededV) {
+    if (V != 0) delete [] V;
+    if (MV != 0) delete [] MV;
+    sizeV = neededV;
+    V = new double[sizeV];
+    MV = new double[sizeV];
+  }
+
+  if (sizeT < (size_t)ldT*ldT) {
+    if (T != 0) delete [] T;
+    sizeT = (size_t)ldT*ldT;
+    T = new double[sizeT];
+  }
+
+  int lwork = 34*ldT;
+  int sizeTmp = (BLOCK_LANCZOS_CHUNK > p) ? BLOCK_LANCZOS_CHUNK*ldT : p*ldT;
+  int needed = 2*ldT*ldT + 2*ldT + lwork + sizeTmp + p*p + p + 2*n;
+  if (sizeWork < needed) {
+    if (work != 0) delete [] work;
+    sizeWork = needed;
+    work = new double[sizeWork];
+  }
+
+  double *Z = work;                 // eigenvectors of T
+  double *S = Z + ldT*ldT;          // selected Ritz coefficients
+  double *theta = S + ldT*ldT;      // eigenvalues of T
+  double *wsyev = theta + ldT;      // LAPACK work space
+  double *tmp = wsyev + lwork;      // gemm scratch
+  double *R = tmp + sizeTmp;        // coupling to the next block
+  double *norm0 = R + p*p;          // block column norms before orthogonalization
+  double *r1 = norm0 + p;           // vectors for deflated columns
+  double *r2 = r1 + n;
+  double *cs = S;                   // coefficient scratch, S is free at that point
+  ID order(ldT);
+
+  if (eigenvalues != 0) delete [] eigenvalues;
+  if (eigenvectors != 0) delete [] eigenvectors;
+  eigenvalues = new double[nev];
+  eigenvectors = new double[(size_t)n*nev];
+  numMode = 0;
+
+  //
+  // starting block: Op applied to a pseudo random block, which keeps
+  // the basis clear of the massless directions
+  //
+
+  seed = 1;
+  for (size_t i=0; i<(size_t)n*p; i++) {
+    seed = seed*1103515245u + 12345u;
+    MV[i] = ((seed >> 16) & 0x7fff)/32768.0 - 0.5;
+  }
+  myMv(n, p, MV, MV + (size_t)p*n);
+  if (applyOp(n, p, MV + (size_t)p*n, V) < 0) {
+    opserr << "BlockLanczosSolver::solve() - LinearSOE failed in solveMultiple()\n";
+    return -1;
+  }
+  myMv(n, p, V, MV);
+  for (int c=0; c<p; c++)
+    norm0[c] = sqrt(fabs(blockDot(n, V + (size_t)c*n, MV + (size_t)c*n)));
+  if (normalizeBlock(n, 0, p, V, MV, R, norm0, r1, r2, cs, tmp) < 0) {
+    opserr << "BlockLanczosSolver::solve() - failed to form the starting block\n";
+    return -1;
+  }
+
+  //
+  // block Lanczos steps
+  //
+
+  int k = 0;            // number of columns of V in T_k
+  int numSteps = 0;
+  int numConverged = 0;
+  bool exhausted = false;
+
+  while (true) {
+
+    double *MQ = MV + (size_t)k*n;
+    double *W = V + (size_t)(k+p)*n;
+    double *MW = MV + (size_t)(k+p)*n;
+
+    // W = Op Q for the whole block
+    if (applyOp(n, p, MQ, W) < 0) {
+      opserr << "BlockLanczosSolver::solve() - LinearSOE failed in solveMultiple()\n";
+      return -1;
+    }
+    myMv(n, p, W, MW);
+    for (int c=0; c<p; c++)
+      norm0[c] = sqrt(fabs(blockDot(n, W + (size_t)c*n, MW + (size_t)c*n)));
+
+    // column block k of T from the full reorthogonalization
+    double *Tk = T + k*ldT;
+    for (int c=0; c<p; c++)
+      for (int i=0; i<k+p; i++)
+	Tk[c*ldT+i] = 0.0;
+
+    orthogonalize(n, k+p, p, W, Tk, ldT, tmp);
+
+    for (int c=0; c<p; c++) {
+      for (int i=0; i<k; i++)
+	T[i*ldT + k+c] = Tk[c*ldT + i];
+      for (int d=0; d<c; d++) {
+	double avg = 0.5*(Tk[c*ldT + k+d] + Tk[d*ldT + k+c]);
+	Tk[c*ldT + k+d] = avg;
+	Tk[d*ldT + k+c] = avg;
+      }
+    }
+
+    // the orthogonalized block is the next block Q R
+    if (normalizeBlock(n, k+p, p, W, MW, R, norm0, r1, r2, cs, tmp) < 0) {
+      for (int i=0; i<p*p; i++)
+	R[i] = 0.0;
+      exhausted = true;
+    }
+
+    k += p;
+
+    // Ritz pairs of T_k
+    for (int j=0; j<k; j++)
+      for (int i=0; i<k; i++)
+	Z[j*k+i] = T[j*ldT+i];
+
+    int info = 0;
+    char jobz[] = "V";
+    char uplo[] = "U";
+#ifdef _WIN32
+    DSYEV(jobz, uplo, &k, Z, &k, theta, wsyev, &lwork, &info);
+#else
+    dsyev_(jobz, uplo, &k, Z, &k, theta, wsyev, &lwork, &info);
+#endif
+    if (info != 0) {
+      opserr << "BlockLanczosSolver::solve() - LAPACK dsyev returned " << info << endln;
+      return -1;
+    }
+
+    // wanted Ritz values first: largest |theta| for the modes
+    // closest to the shift, smallest |theta| otherwise
+    for (int i=0; i<k; i++)
+      order(i) = i;
+    for (int i=1; i<k; i++) {
+      int idx = order(i);
+      double key = fabs(theta[idx]);
+      int j = i-1;
+      while (j >= 0 &&
+	     ((findSmallest == true && fabs(theta[order(j)]) < key) ||
+	      (findSmallest == false && fabs(theta[order(j)]) > key))) {
+	order(j+1) = order(j);
+	j--;
+      }
+      order(j+1) = idx;
+    }
+
+    // residual ||Op y - theta y||_M = ||R s_last|| for each wanted pair
+    numConverged = 0;
+    for (int i=0; i<nev && i<k; i++) {
+      double *s = Z + order(i)*k + (k-p);
+      double res = 0.0;
+      for (int a=0; a<p; a++) {
+	double sum = 0.0;
+	for (int b=a; b<p; b++)
+	  sum += R[b*p+a]*s[b];
+	res += sum*sum;
+      }
+      if (sqrt(res) <= tol*fabs(theta[order(i)]))
+	numConverged++;
+      else
+	break;
+    }
+
+    if (numConverged >= nev || exhausted == true)
+      break;
+
+    if (++numSteps >= maxBlockSteps) {
+      opserr << "BlockLanczosSolver::solve() - maximum number of block steps reached, "
+	     << numConverged << " of " << nev << " modes converged\n";
+      break;
+    }
+
+    if (k + p > m) {
+
+      //
+      // thick restart: V_kk = V_k S with S the kk wanted Ritz vectors of
+      // T_k, T_kk = diag(theta) coupled to the next block by R S_last
+      //
+
+      int kk = nev + (m - nev - p)/2;
+      if (kk > k)
+	kk = k;
+
+      for (int j=0; j<kk; j++)
+	for (int i=0; i<k; i++)
+	  S[j*k+i] = Z[order(j)*k+i];
+
+      for (int row=0; row<n; row += BLOCK_LANCZOS_CHUNK) {
+	int numRows = (n - row < BLOCK_LANCZOS_CHUNK) ? n - row : BLOCK_LANCZOS_CHUNK;
+	double *basis[2] = {V, MV};
+	for (int b=0; b<2; b++) {
+	  blockGemm('N', 'N', numRows, kk, k, 1.0, basis[b] + row, n, S, k,
+		    0.0, tmp, numRows);
+	  for (int j=0; j<kk; j++)
+	    memcpy(basis[b] + (size_t)j*n + row, tmp + j*numRows, numRows*sizeof(double));
+	}
+      }
+
+      memmove(V + (size_t)kk*n, V + (size_t)k*n, (size_t)p*n*sizeof(double));
+      memmove(MV + (size_t)kk*n, MV + (size_t)k*n, (size_t)p*n*sizeof(double));
+
+      for (int j=0; j<kk+p; j++)
+	for (int i=0; i<kk+p; i++)
+	  T[j*ldT+i] = 0.0;
+      for (int j=0; j<kk; j++) {
+	T[j*ldT+j] = theta[order(j)];
+	double *sLast = S + j*k + (k-p);
+	for (int a=0; a<p; a++) {
+	  double sum = 0.0;
+	  for (int b=a; b<p; b++)
+	    sum += R[b*p+a]*sLast[b];
+	  T[j*ldT + kk+a] = sum;
+	  T[(kk+a)*ldT + j] = sum;
+	}
+      }
+
+      k = kk;
+    }
+  }
+
+  if (k < nev) {
+    opserr << "BlockLanczosSolver::solve() - no Ritz pairs computed\n";
+    return -1;
+  }
+
+  //
+  // eigenvalues lambda = shift + 1/theta in ascending order and the
+  // M orthonormal eigenvectors V_k S
+  //
+
+  for (int i=1; i<nev; i++) {
+    int idx = order(i);
+    double key = shift + 1.0/theta[idx];
+    int j = i-1;
+    while (j >= 0 && shift + 1.0/theta[order(j)] > key) {
+      order(j+1) = order(j);
+      j--;
+    }
+    order(j+1) = idx;
+  }
+
+  for (int j=0; j<nev; j++) {
+    eigenvalues[j] = shift + 1.0/theta[order(j)];
+    for (int i=0; i<k; i++)
+      S[j*k+i] = Z[order(j)*k+i];
+  }
+  blockGemm('N', 'N', n, nev, k, 1.0, V, n, S, k, 0.0, eigenvectors, n);
+
+  numMode = nev;
+  return 0;
+}
+
+
+void
+BlockLanczosSolver::myMv(int n, int numVec, double *v, double *result)
+{
+  bool mDiagonal = theBlockSOE->mDiagonal;
+  double *M = theBlockSOE->M;
+
+  if (mDiagonal == true && n <= theBlockSOE->Msize) {
+    for (int c=0; c<numVec; c++)
+      for (int i=0; i<n; i++)
+	result[(size_t)c*n+i] = M[i]*v[(size_t)c*n+i];
+    return;
+  }
+
+  AnalysisModel *theAnalysisModel = theBlockSOE->theModel;
+
+  for (int c=0; c<numVec; c++) {
+    Vector x(v + (size_t)c*n, n);
+    Vector y(result + (size_t)c*n, n);
+    y.Zero();
+
+    // loop over the FE_Elements
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while((elePtr = theEles()) != 0) {
+      const Vector &b = elePtr->getM_Force(x, 1.0);
+      y.Assemble(b, elePtr->getID(), 1.0);
+    }
+
+    // loop over the DOF_Groups
+    DOF_Group *dofPtr;
+    DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+    while ((dofPtr = theDofs()) != 0) {
+      const Vector &a = dofPtr->getM_Force(x,1.0);
+      y.Assemble(a, dofPtr->getID(), 1.0);
+    }
+  }
+}
+
+
+int
+BlockLanczosSolver::applyOp(int n, int numVec, double *MX, double *X)
+{
+  Matrix B(MX, n, numVec);
+  Matrix Xm(X, n, numVec);
+  return theSOE->solveMultiple(B, Xm);
+}
+
+
+int
+BlockLanczosSolver::orthogonalize(int n, int numBasis, int numVec,
+				  double *W, double *C, int ldC, double *tmp)
+{
+  if (numBasis == 0)
+    return 0;
+
+  // two passes of block classical Gram-Schmidt in the M inner product,
+  // V^T M W is formed as (MV)^T W; C accumulates the coefficients
+  for (int pass=0; pass<2; pass++) {
+    blockGemm('T', 'N', numBasis, numVec, n, 1.0, MV, n, W, n, 0.0, tmp, numBasis);
+    blockGemm('N', 'N', n, numVec, numBasis, -1.0, V, n, tmp, numBasis, 1.0, W, n);
+    for (int c=0; c<numVec; c++)
+      for (int i=0; i<numBasis; i++)
+	C[c*ldC+i] += tmp[c*numBasis+i];
+  }
+
+  return 0;
+}
+
+
+int
+BlockLanczosSolver::normalizeBlock(int n, int numBasis, int numVec,
+				   double *W, double *MW, double *R,
+				   const double *norm0, double *r1, double *r2,
+				   double *cs, double *tmp)
+{
+  for (int i=0; i<numVec*numVec; i++)
+    R[i] = 0.0;
+
+  // modified Gram-Schmidt within the block; M W is formed again for
+  // each column so that MV stays consistent with V
+  for (int c=0; c<numVec; c++) {
+    double *w = W + (size_t)c*n;
+    double *mw = MW + (size_t)c*n;
+    double refNorm = norm0[c];
+
+    for (int attempt=0; attempt<2; attempt++) {
+
+      for (int pass=0; pass<2; pass++) {
+	for (int d=0; d<c; d++) {
+	  double r = blockDot(n, MW + (size_t)d*n, w);
+	  for (int i=0; i<n; i++)
+	    w[i] -= r*W[(size_t)d*n+i];
+	  if (attempt == 0)
+	    R[c*numVec+d] += r;
+	}
+      }
+
+      myMv(n, 1, w, mw);
+      double norm = sqrt(fabs(blockDot(n, w, mw)));
+      if (norm > 1.0e-10*refNorm) {
+	for (int i=0; i<n; i++) {
+	  w[i] /= norm;
+	  mw[i] /= norm;
+	}
+	if (attempt == 0)
+	  R[c*numVec+c] = norm;
+	break;
+      }
+
+      if (attempt == 1)
+	return -1;
+
+      // the column is deflated, R(c,c) stays zero; carry on with Op
+      // applied to a pseudo random vector orthogonal to the basis
+      for (int i=0; i<n; i++) {
+	seed = seed*1103515245u + 12345u;
+	r1[i] = ((seed >> 16) & 0x7fff)/32768.0 - 0.5;
+      }
+      myMv(n, 1, r1, r2);
+      if (applyOp(n, 1, r2, w) < 0)
+	return -1;
+      myMv(n, 1, w, mw);
+      refNorm = sqrt(fabs(blockDot(n, w, mw)));
+
+      for (int i=0; i<numBasis; i++)
+	cs[i] = 0.0;
+      orthogonalize(n, numBasis, 1, w, cs, numBasis, tmp);
+    }
+  }
+
+  return 0;
+}
+
+
+int
+BlockLanczosSolver::setSize(void)
+{
+  size = theBlockSOE->Msize;
+  return 0;
+}
+
+
+int
+BlockLanczosSolver::setEigenSOE(BlockLanczosSOE &theSOE)
+{
+  theBlockSOE = &theSOE;
+  return 0;
+}
+
+
+const Vector &
+BlockLanczosSolver::getEigenvector(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "BlockLanczosSolver::getEigenvector() - mode " << mode << " is out of range (1 - "
+	   << numMode << ")\n";
+    static Vector errVector;
+    errVector.resize(size);
+    errVector.Zero();
+    return errVector;
+  }
+
+  theVector.setData(&eigenvectors[(size_t)(mode-1)*size], size);
+  return theVector;
+}
+
+
+double
+BlockLanczosSolver::getEigenvalue(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "BlockLanczosSolver::getEigenvalue() - mode " << mode << " is out of range (1 - "
+	   << numMode << ")\n";
+    return -1;
+  }
+
+  return eigenvalues[mode-1];
+}
+
+
+int
+BlockLanczosSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+BlockLanczosSolver::recvSelf(int commitTag, Channel &theChannel,
+			     FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,92 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSolver.h,v $
+
+// Written: 10/26
+//
+// Description: This file contains the class definition for
+// BlockLanczosSolver. It finds the eigenpairs of K x = lambda M x with
+// a thick restarted block Lanczos iteration on the shift-invert
+// operator (K - shift*M)^-1 M, using full reorthogonalization in the
+// M inner product. Each step applies the operator to a block of
+// vectors with one multi right hand side solve of the LinearSOE, and
+// the reorthogonalization and restarts are done with level 3 BLAS.
+
+#ifndef BlockLanczosSolver_h
+#define BlockLanczosSolver_h
+
+#include <EigenSolver.h>
+#include <Vector.h>
+#include <stddef.h>
+
+class BlockLanczosSOE;
+class LinearSOE;
+
+class BlockLanczosSolver : public EigenSolver
+{
+  public:
+    BlockLanczosSolver(double tol = 1.0e-12, int maxBlockSteps = 1000);
+    ~BlockLanczosSolver();
+
+    int solve(int numMode, bool generalized, bool findSmallest = true);
+    int setSize(void);
+    int setEigenSOE(BlockLanczosSOE &theSOE);
+
+    const Vector &getEigenvector(int mode);
+    double getEigenvalue(int mode);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    void myMv(int n, int numVec, double *v, double *result);
+    int applyOp(int n, int numVec, double *MX, double *X);
+    int orthogonalize(int n, int numBasis, int numVec,
+		      double *W, double *C, int ldC, double *tmp);
+    int normalizeBlock(int n, int numBasis, int numVec,
+		       double *W, double *MW, double *R, const double *norm0,
+		       double *r1, double *r2, double *cs, double *tmp);
+
+    BlockLanczosSOE *theBlockSOE;
+    LinearSOE *theSOE;
+    double tol;
+    int maxBlockSteps;
+
+    int size;
+    int numMode;
+    double *eigenvalues;
+    double *eigenvectors;
+
+    // Lanczos basis V, M*V, projected matrix T and work space
+    double *V, *MV, *T, *work;
+    size_t sizeV, sizeT;
+    int sizeWork;
+
+    unsigned int seed;
+    Vector theVector;
+};
+
+#endif
@@ -32,6 +32,8 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<Matrix.h>
+#include<Vector.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -67,6 +69,37 @@ LinearSOE::formAp(const Vector &p, Vector &Ap)
   return 0;
 }
 
+int
+LinearSOE::solveMultiple(const Matrix &B, Matrix &X)
+{
+  int n = this->getNumEqn();
+  int nrhs = B.noCols();
+  if (B.noRows() != n || X.noRows() != n || X.noCols() != nrhs) {
+    opserr << "LinearSOE::solveMultiple() - B and X must be " << n << " x nrhs\n";
+    return -1;
+  }
+
+  if (theSolver != 0 && theSolver->canSolveMultiple() == true)
+    return theSolver->solveMultiple(B, X);
+
+  // fall back on one solve per right hand side
+  Vector b(n);
+  for (int j=0; j<nrhs; j++) {
+    for (int i=0; i<n; i++)
+      b(i) = B(i,j);
+    if (this->setB(b) < 0)
+      return -1;
+    int res = this->solve();
+    if (res < 0)
+      return res;
+    const Vector &x = this->getX();
+    for (int i=0; i<n; i++)
+      X(i,j) = x(i);
+  }
+
+  return 0;
+}
+
 double
 LinearSOE::getDeterminant(void)
 {
@@ -91,6 +124,41 @@ LinearSOE::getSolver(void)
     return theSolver;
 }
 
+unsigned long long
+LinearSOE::hashSparsity(int size, int nnz, const int *start, const int *index)
+{
+    // 64 bit FNV-1a over the sizes, the column starts and the row indices
+    const unsigned long long prime = 1099511628211ULL;
+    unsigned long long hash = 14695981039346656037ULL;
+
+    hash = (hash ^ (unsigned int)size) * prime;
+    hash = (hash ^ (unsigned int)nnz) * prime;
+    for (int i=0; i<=size; i++)
+	hash = (hash ^ (unsigned int)start[i]) * prime;
+    for (int i=0; i<nnz; i++)
+	hash = (hash ^ (unsigned int)index[i]) * prime;
+
+    return hash;
+}
+
+bool
+LinearSOE::sameSparsity(int size, int nnz, const int *start, const int *index,
+			const std::vector<int> &lastStart,
+			const std::vector<int> &lastIndex)
+{
+    if ((int)lastStart.size() != size+1 || (int)lastIndex.size() != nnz)
+	return false;
+
+    for (int i=0; i<=size; i++)
+	if (start[i] != lastStart[i])
+	    return false;
+    for (int i=0; i<nnz; i++)
+	if (index[i] != lastIndex[i])
+	    return false;
+
+    return true;
+}
+
 int 
 LinearSOE::setLinks(AnalysisModel &theModel)
 {
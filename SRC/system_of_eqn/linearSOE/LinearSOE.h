@@ -40,6 +40,7 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <MovableObject.h>
+#include <vector>
 
 class LinearSOESolver;
 class Graph;
@@ -74,6 +75,11 @@ class LinearSOE : public MovableObject
 
     virtual int formAp(const Vector &p, Vector &Ap);
 
+    // solve A X = B for all the columns of B; the solver does it with
+    // one factorization if it can, otherwise B is solved column by
+    // column through setB() and solve(). getX() is left undefined.
+    virtual int solveMultiple(const Matrix &B, Matrix &X);
+
     virtual const Vector &getX(void) = 0;
     virtual const Vector &getB(void) = 0;    
     virtual const Matrix *getA(void) {return 0;};    
@@ -82,11 +88,28 @@ class LinearSOE : public MovableObject
 
     virtual void setX(int loc, double value) =0;
     virtual void setX(const Vector &X) =0;
+
+    // true if addA() and addB() may be invoked concurrently
+    // for ID's that have no equation in common
+    virtual bool isThreadSafe(void) {return false;};
     
     LinearSOESolver *getSolver(void);
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
+
+    // fingerprint of a compressed column (or row) sparsity pattern; the
+    // sparse SOEs compare it in setSize() so their solvers can keep the
+    // ordering and symbolic factorization when the pattern is unchanged
+    static unsigned long long hashSparsity(int size, int nnz,
+					   const int *start, const int *index);
+    // compares the pattern with a stored copy, as equal fingerprints do
+    // not guarantee equal patterns
+    static bool sameSparsity(int size, int nnz,
+			     const int *start, const int *index,
+			     const std::vector<int> &lastStart,
+			     const std::vector<int> &lastIndex);
+
     AnalysisModel* theModel;
     
   private:
@@ -39,6 +39,7 @@
 
 #include <MovableObject.h>
 class LinearSOE;
+class Matrix;
 
 class LinearSOESolver : public MovableObject
 {
@@ -49,6 +50,11 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // solvers that can solve A X = B for a block of right hand sides
+    // with a single factorization say so and override solveMultiple()
+    virtual bool canSolveMultiple(void) {return false;};
+    virtual int solveMultiple(const Matrix &B, Matrix &X) {return -1;};
     
   protected:
     
@@ -0,0 +1,163 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/ScatterMap.cpp,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the implementation of ScatterMap.
+//
+// What: "@(#) ScatterMap.C, revA"
+
+#include <ScatterMap.h>
+#include <ID.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+
+ScatterMap::ScatterMap()
+{
+
+}
+
+ScatterMap::~ScatterMap()
+{
+
+}
+
+void
+ScatterMap::clearAll(void)
+{
+  theIndex.clear();
+  idStart.clear();
+  locStart.clear();
+  theEqns.clear();
+  theLocations.clear();
+}
+
+int
+ScatterMap::setSize(AnalysisModel &theModel)
+{
+  this->clearAll();
+
+  // count the space needed
+  int numIDs = 0;
+  long long numEqns = 0;
+  long long numLocs = 0;
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel.getFEs();
+  while ((elePtr = theEles()) != 0) {
+    int idSize = elePtr->getID().Size();
+    numIDs++;
+    numEqns += idSize;
+    numLocs += (long long)idSize*idSize;
+  }
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = theModel.getDOFs();
+  while ((dofPtr = theDOFs()) != 0) {
+    int idSize = dofPtr->getID().Size();
+    numIDs++;
+    numEqns += idSize;
+    numLocs += (long long)idSize*idSize;
+  }
+
+  idStart.reserve(numIDs+1);
+  locStart.reserve(numIDs+1);
+  theEqns.reserve(numEqns);
+  theLocations.assign(numLocs, (double *)0);
+  theIndex.reserve(numIDs);
+
+  // copy the equation numbers
+  idStart.push_back(0);
+  locStart.push_back(0);
+
+  FE_EleIter &theEles2 = theModel.getFEs();
+  while ((elePtr = theEles2()) != 0) {
+    const ID &id = elePtr->getID();
+    int idSize = id.Size();
+    theIndex[&id] = (int)idStart.size()-1;
+    for (int i=0; i<idSize; i++)
+      theEqns.push_back(id(i));
+    idStart.push_back(theEqns.size());
+    locStart.push_back(locStart.back() + (std::size_t)idSize*idSize);
+  }
+
+  DOF_GrpIter &theDOFs2 = theModel.getDOFs();
+  while ((dofPtr = theDOFs2()) != 0) {
+    const ID &id = dofPtr->getID();
+    int idSize = id.Size();
+    theIndex[&id] = (int)idStart.size()-1;
+    for (int i=0; i<idSize; i++)
+      theEqns.push_back(id(i));
+    idStart.push_back(theEqns.size());
+    locStart.push_back(locStart.back() + (std::size_t)idSize*idSize);
+  }
+
+  return 0;
+}
+
+int
+ScatterMap::getNumIDs(void) const
+{
+  return idStart.size() > 0 ? (int)idStart.size()-1 : 0;
+}
+
+const int *
+ScatterMap::getEqns(int index, int &idSize) const
+{
+  idSize = (int)(idStart[index+1] - idStart[index]);
+  return &theEqns[idStart[index]];
+}
+
+double **
+ScatterMap::getLocations(int index)
+{
+  return &theLocations[locStart[index]];
+}
+
+double **
+ScatterMap::getLocations(const ID &id)
+{
+  std::unordered_map<const ID *, int>::const_iterator it = theIndex.find(&id);
+  if (it == theIndex.end())
+    return 0;
+
+  // make sure the ID has not been renumbered since it was mapped
+  int index = it->second;
+  std::size_t start = idStart[index];
+  int idSize = id.Size();
+  if (idStart[index+1] - start != (std::size_t)idSize)
+    return 0;
+  for (int i=0; i<idSize; i++)
+    if (theEqns[start+i] != id(i))
+      return 0;
+
+  if (idSize == 0)
+    return 0;
+
+  return &theLocations[locStart[index]];
+}
@@ -0,0 +1,74 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/ScatterMap.h,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the class definition for ScatterMap.
+// A ScatterMap is used by the sparse LinearSOE classes to cache, for the
+// ID of every FE_Element and DOF_Group in the AnalysisModel, the location
+// in the SOE storage of each entry of the contribution matrix. The SOE
+// fills in the locations in setSize(); addA() can then add directly
+// instead of searching the row or column for every entry.
+//
+// What: "@(#) ScatterMap.h, revA"
+
+#ifndef ScatterMap_h
+#define ScatterMap_h
+
+#include <vector>
+#include <unordered_map>
+
+class ID;
+class AnalysisModel;
+
+class ScatterMap
+{
+  public:
+    ScatterMap();
+    ~ScatterMap();
+
+    // allocates space for the ID of each FE_Element and DOF_Group
+    int setSize(AnalysisModel &theModel);
+    void clearAll(void);
+
+    // methods used by the SOE to fill in the locations, entry (i,j) of
+    // the contribution matrix is at location i*idSize+j, 0 if not stored
+    int getNumIDs(void) const;
+    const int *getEqns(int index, int &idSize) const;
+    double **getLocations(int index);
+
+    // returns the locations for an ID passed to addA(), or 0 if the ID
+    // was not mapped or its equation numbers have changed since
+    double **getLocations(const ID &id);
+
+  private:
+    std::unordered_map<const ID *, int> theIndex;
+    std::vector<std::size_t> idStart;   // start of each ID in theEqns
+    std::vector<std::size_t> locStart;  // start of each ID in theLocations
+    std::vector<int> theEqns;      // copy of the equation numbers
+    std::vector<double *> theLocations;
+};
+
+#endif
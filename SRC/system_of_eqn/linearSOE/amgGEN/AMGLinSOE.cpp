@@ -0,0 +1,375 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/amgGEN/AMGLinSOE.cpp,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the implementation for AMGLinSOE.
+//
+// What: "@(#) AMGLinSOE.C, revA"
+
+#include <AMGLinSOE.h>
+#include <AMGLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ID.h>
+
+AMGLinSOE::AMGLinSOE(AMGLinSolver &the_Solver)
+    :LinearSOE(the_Solver, LinSOE_TAGS_AMGLinSOE), X(), B(),
+     rowStartA(), colA(), A()
+{
+    the_Solver.setLinearSOE(*this);
+}
+
+
+AMGLinSOE::AMGLinSOE()
+    :LinearSOE(LinSOE_TAGS_AMGLinSOE), X(), B(),
+     rowStartA(), colA(), A()
+{
+
+}
+
+
+AMGLinSOE::~AMGLinSOE()
+{
+
+}
+
+
+int
+AMGLinSOE::getNumEqn(void) const
+{
+    return X.Size();
+}
+
+
+int
+AMGLinSOE::setSize(Graph &theGraph)
+{
+    int size = theGraph.getNumVertex();
+    if (size < 0) {
+	opserr << "WARNING AMGLinSOE::setSize - size of soe < 0\n";
+	return -1;
+    }
+
+    // fist itearte through the vertices of the graph to get nnz
+    Vertex *theVertex;
+    int nnz = 0;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((theVertex = theVertices()) != 0) {
+	const ID &theAdjacency = theVertex->getAdjacency();
+	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
+    }
+
+    // resize A, B, X
+    rowStartA.clear();
+    colA.clear();
+    rowStartA.reserve(size+1);
+    colA.reserve(nnz);
+    A.assign(nnz, 0.0);
+    B.resize(size);
+    B.Zero();
+    X.resize(size);
+    X.Zero();
+
+    // fill in colA and rowStartA, the columns in each row are sorted
+    rowStartA.push_back(0);
+    for (int a=0; a<size; a++) {
+
+	theVertex = theGraph.getVertexPtr(a);
+	if (theVertex == 0) {
+	    opserr << "WARNING:AMGLinSOE::setSize :";
+	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	    rowStartA.assign(1, 0);
+	    colA.clear();
+	    A.clear();
+	    X.resize(0);
+	    B.resize(0);
+	    return -1;
+	}
+
+	const ID &theAdjacency = theVertex->getAdjacency();
+	int idSize = theAdjacency.Size();
+	ID row(0, idSize+1);
+
+	row.insert(theVertex->getTag());
+	for (int i=0; i<idSize; i++)
+	    row.insert(theAdjacency(i));
+
+	for (int i=0; i<row.Size(); i++)
+	    colA.push_back(row(i));
+
+	rowStartA.push_back(rowStartA[a]+row.Size());
+    }
+
+    // determine the location in A of each entry of the FE_Element and
+    // DOF_Group matrices so addA() does not have to search colA
+    theScatterMap.clearAll();
+    if (theModel != 0 && size != 0) {
+	theScatterMap.setSize(*theModel);
+	int numIDs = theScatterMap.getNumIDs();
+	for (int index=0; index<numIDs; index++) {
+	    int idSize;
+	    const int *eqns = theScatterMap.getEqns(index, idSize);
+	    double **locs = theScatterMap.getLocations(index);
+	    for (int i=0; i<idSize; i++) {
+		int row = eqns[i];
+		if (row<0 || row>=size)
+		    continue;
+		for (int j=0; j<idSize; j++) {
+		    int col = eqns[j];
+		    if (col<0 || col>=size)
+			continue;
+		    for (std::ptrdiff_t k=rowStartA[row]; k<rowStartA[row+1]; k++) {
+			if (colA[k] == col) {
+			    locs[i*idSize+j] = &A[k];
+			    break;
+			}
+		    }
+		}
+	    }
+	}
+    }
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:AMGLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
+    return 0;
+}
+
+
+int
+AMGLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0) return 0;
+
+    int idSize = id.Size();
+
+    // check that m and id are of similar size
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "AMGLinSOE::addA() ";
+	opserr << " - Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    // if the locations for id were determined in setSize() add directly
+    double **locs = theScatterMap.getLocations(id);
+    if (locs != 0) {
+	for (int i=0; i<idSize; i++) {
+	    for (int j=0; j<idSize; j++) {
+		double *loc = *locs++;
+		if (loc != 0)
+		    *loc += fact*m(i,j);
+	    }
+	}
+	return 0;
+    }
+
+    int size = X.Size();
+    for (int i=0; i<idSize; i++) {
+	int row = id(i);
+	if (row<0 || row>=size)
+	    continue;
+	for (int j=0; j<idSize; j++) {
+	    int col = id(j);
+	    if (col<0 || col>=size)
+		continue;
+
+	    // find place in A
+	    for (std::ptrdiff_t k=rowStartA[row]; k<rowStartA[row+1]; k++) {
+		if (colA[k] == col) {
+		    A[k] += fact*m(i,j);
+		    break;
+		}
+	    }
+	}
+    }
+
+    return 0;
+}
+
+
+int
+AMGLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    int idSize = id.Size();
+    // check that m and id are of similar size
+    if (idSize != v.Size() ) {
+	opserr << "AMGLinSOE::addB() ";
+	opserr << " - Vector and ID not of similar sizes\n";
+	return -1;
+    }
+
+    int size = B.Size();
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0) B[pos] += v(i);
+	}
+    } else if (fact == -1.0) { // do not need to multiply if fact == -1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0) B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0) B[pos] += v(i) * fact;
+	}
+    }
+
+    return 0;
+}
+
+
+int
+AMGLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  {
+	B.Zero();
+	return 0;
+    }
+
+    int size = B.Size();
+    if (v.Size() != size) {
+	opserr << "WARNING AMGLinSOE::setB() -";
+	opserr << " incompatible sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }
+
+    return 0;
+}
+
+
+void
+AMGLinSOE::zeroA(void)
+{
+    A.assign(A.size(), 0.0);
+}
+
+
+void
+AMGLinSOE::zeroB(void)
+{
+    B.Zero();
+}
+
+
+void
+AMGLinSOE::setX(int loc, double value)
+{
+    if (loc<X.Size() && loc>=0) {
+	X(loc) = value;
+    }
+}
+
+
+void
+AMGLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == X.Size()) {
+	X = x;
+    }
+}
+
+
+const Vector &
+AMGLinSOE::getX(void)
+{
+    return X;
+}
+
+
+const Vector &
+AMGLinSOE::getB(void)
+{
+    return B;
+}
+
+
+double
+AMGLinSOE::normRHS(void)
+{
+    return B.Norm();
+}
+
+
+int
+AMGLinSOE::setAMGLinSolver(AMGLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+    if (X.Size() != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:AMGLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return -1;
+	}
+    }
+    return this->LinearSOE::setSolver(newSolver);
+}
+
+
+int
+AMGLinSOE::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+AMGLinSOE::recvSelf(int cTag, Channel &theChannel,
+		    FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
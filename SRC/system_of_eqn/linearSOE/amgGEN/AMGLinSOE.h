@@ -0,0 +1,87 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/amgGEN/AMGLinSOE.h,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the class definition for AMGLinSOE.
+// AMGLinSOE is a subclass of LinearSOE. It stores the matrix A in the
+// compressed sparse row format required by the AMGLinSolver object,
+// which solves the system with an AMG preconditioned Krylov method.
+//
+// What: "@(#) AMGLinSOE.h, revA"
+
+#ifndef AMGLinSOE_h
+#define AMGLinSOE_h
+
+#include <LinearSOE.h>
+#include <Vector.h>
+#include <ScatterMap.h>
+#include <vector>
+#include <cstddef>
+
+class AMGLinSolver;
+
+class AMGLinSOE : public LinearSOE
+{
+  public:
+    AMGLinSOE(AMGLinSolver &theSolver);
+    AMGLinSOE();
+
+    ~AMGLinSOE();
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroB(void);
+
+    const Vector &getX(void);
+    const Vector &getB(void);
+    double normRHS(void);
+
+    void setX(int loc, double value);
+    void setX(const Vector &x);
+    bool isThreadSafe(void) {return true;};
+    int setAMGLinSolver(AMGLinSolver &newSolver);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    friend class AMGLinSolver;
+
+  protected:
+
+  private:
+    Vector X, B;
+    std::vector<std::ptrdiff_t> rowStartA, colA;
+    std::vector<double> A;
+    ScatterMap theScatterMap; // location in A of each FE_Element & DOF_Group matrix entry
+};
+
+#endif
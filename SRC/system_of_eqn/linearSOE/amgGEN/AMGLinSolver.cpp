@@ -0,0 +1,380 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/amgGEN/AMGLinSolver.cpp,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the implementation for AMGLinSolver.
+//
+// What: "@(#) AMGLinSolver.C, revA"
+
+#include <AMGLinSolver.h>
+#include <AMGLinSOE.h>
+#include <elementAPI.h>
+#include <string.h>
+
+#include <vector>
+#include <tuple>
+#include <stdexcept>
+
+#define AMGCL_NO_BOOST
+#include <amgcl/backend/builtin.hpp>
+#include <amgcl/adapter/zero_copy.hpp>
+#include <amgcl/amg.hpp>
+#include <amgcl/coarsening/smoothed_aggregation.hpp>
+#include <amgcl/relaxation/spai0.hpp>
+#include <amgcl/relaxation/ilu0.hpp>
+#include <amgcl/solver/cg.hpp>
+#include <amgcl/solver/bicgstab.hpp>
+#include <amgcl/solver/gmres.hpp>
+
+typedef amgcl::backend::builtin<double> AMGBackend;
+typedef amgcl::backend::crs<double> AMGMatrix;
+
+// AMGPreconditioner hides the AMGCL template types from AMGLinSolver.h;
+// it holds the AMG hierarchy and the Krylov solver work vectors.
+class AMGPreconditioner
+{
+  public:
+    virtual ~AMGPreconditioner() {};
+    virtual std::tuple<size_t, double> solve(const AMGMatrix &A,
+					     const std::vector<double> &rhs,
+					     std::vector<double> &x) = 0;
+};
+
+template <template <class> class Relaxation, class Krylov>
+class AMGPreconditionerT : public AMGPreconditioner
+{
+  public:
+    typedef amgcl::amg<AMGBackend, amgcl::coarsening::smoothed_aggregation,
+		       Relaxation> Precond;
+
+    AMGPreconditionerT(const AMGMatrix &A, const typename Krylov::params &prm)
+	:P(A), S(A.nrows, prm) {};
+
+    std::tuple<size_t, double> solve(const AMGMatrix &A,
+				     const std::vector<double> &rhs,
+				     std::vector<double> &x) {
+	return S(A, P, rhs, x);
+    };
+
+  private:
+    Precond P;
+    Krylov S;
+};
+
+template <template <class> class Relaxation>
+static AMGPreconditioner *
+newAMGPreconditioner(const AMGMatrix &A, int solverType,
+		     double tol, int maxIter, int restart)
+{
+    if (solverType == AMG_SOLVER_CG) {
+	typedef amgcl::solver::cg<AMGBackend> Krylov;
+	Krylov::params prm;
+	prm.tol = tol;
+	prm.maxiter = maxIter;
+	return new AMGPreconditionerT<Relaxation, Krylov>(A, prm);
+
+    } else if (solverType == AMG_SOLVER_BICGSTAB) {
+	typedef amgcl::solver::bicgstab<AMGBackend> Krylov;
+	Krylov::params prm;
+	prm.tol = tol;
+	prm.maxiter = maxIter;
+	return new AMGPreconditionerT<Relaxation, Krylov>(A, prm);
+    }
+
+    typedef amgcl::solver::gmres<AMGBackend> Krylov;
+    Krylov::params prm;
+    prm.tol = tol;
+    prm.maxiter = maxIter;
+    prm.M = restart;
+    return new AMGPreconditionerT<Relaxation, Krylov>(A, prm);
+}
+
+
+void* OPS_AMGLinSolver()
+{
+    // system AMG <-solver CG|BiCGStab|GMRES> <-smoother spai0|ilu0>
+    //   <-tol tol> <-maxIter n> <-restart m> <-reuse n> <-rebuildRatio r> <-print>
+    int solverType = AMG_SOLVER_GMRES;
+    int smootherType = AMG_SMOOTHER_SPAI0;
+    double tol = 1.0e-8;
+    int maxIter = 1000;
+    int restart = 30;
+    int maxReuse = 20;
+    double rebuildRatio = 2.0;
+    bool printFlag = false;
+
+    int numData = 1;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+
+	if (strcmp(opt, "-solver") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* type = OPS_GetString();
+	    if (strcmp(type, "CG") == 0 || strcmp(type, "cg") == 0)
+		solverType = AMG_SOLVER_CG;
+	    else if (strcmp(type, "BiCGStab") == 0 || strcmp(type, "bicgstab") == 0)
+		solverType = AMG_SOLVER_BICGSTAB;
+	    else if (strcmp(type, "GMRES") == 0 || strcmp(type, "gmres") == 0)
+		solverType = AMG_SOLVER_GMRES;
+	    else {
+		opserr << "WARNING system AMG - unknown -solver " << type
+		       << ", use CG, BiCGStab or GMRES\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-smoother") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* type = OPS_GetString();
+	    if (strcmp(type, "spai0") == 0 || strcmp(type, "SPAI0") == 0)
+		smootherType = AMG_SMOOTHER_SPAI0;
+	    else if (strcmp(type, "ilu0") == 0 || strcmp(type, "ILU0") == 0)
+		smootherType = AMG_SMOOTHER_ILU0;
+	    else {
+		opserr << "WARNING system AMG - unknown -smoother " << type
+		       << ", use spai0 or ilu0\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-tol") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetDoubleInput(&numData, &tol) < 0) {
+		opserr << "WARNING system AMG - invalid -tol\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-maxIter") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numData, &maxIter) < 0) {
+		opserr << "WARNING system AMG - invalid -maxIter\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-restart") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numData, &restart) < 0) {
+		opserr << "WARNING system AMG - invalid -restart\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-reuse") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numData, &maxReuse) < 0) {
+		opserr << "WARNING system AMG - invalid -reuse\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-rebuildRatio") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetDoubleInput(&numData, &rebuildRatio) < 0) {
+		opserr << "WARNING system AMG - invalid -rebuildRatio\n";
+		return 0;
+	    }
+
+	} else if (strcmp(opt, "-print") == 0) {
+	    printFlag = true;
+	}
+    }
+
+    AMGLinSolver *theSolver = new AMGLinSolver(solverType, smootherType, tol, maxIter,
+					       restart, maxReuse, rebuildRatio, printFlag);
+    return new AMGLinSOE(*theSolver);
+}
+
+
+AMGLinSolver::AMGLinSolver(int solver, int smoother, double tolerance,
+			   int maxI, int restrt, int maxR, double ratio, bool print)
+    :LinearSOESolver(SOLVER_TAGS_AMGLinSolver), theSOE(0), thePrecond(0),
+     solverType(solver), smootherType(smoother), tol(tolerance),
+     maxIter(maxI), restart(restrt), maxReuse(maxR), rebuildRatio(ratio),
+     printFlag(print), numReuse(0), numIterFirst(0), numIterLast(0)
+{
+    if (maxIter < 1)
+	maxIter = 1;
+    if (restart < 1)
+	restart = 1;
+    if (maxReuse < 1)
+	maxReuse = 1;
+}
+
+
+AMGLinSolver::~AMGLinSolver()
+{
+    if (thePrecond != 0)
+	delete thePrecond;
+}
+
+
+int
+AMGLinSolver::formPreconditioner(void)
+{
+    if (thePrecond != 0)
+	delete thePrecond;
+    thePrecond = 0;
+
+    int n = theSOE->X.Size();
+    std::shared_ptr<AMGMatrix> A =
+	amgcl::adapter::zero_copy(n, &(theSOE->rowStartA[0]),
+				  &(theSOE->colA[0]), &(theSOE->A[0]));
+
+    try {
+	if (smootherType == AMG_SMOOTHER_ILU0)
+	    thePrecond = newAMGPreconditioner<amgcl::relaxation::ilu0>
+		(*A, solverType, tol, maxIter, restart);
+	else
+	    thePrecond = newAMGPreconditioner<amgcl::relaxation::spai0>
+		(*A, solverType, tol, maxIter, restart);
+    } catch (std::exception &e) {
+	opserr << "WARNING AMGLinSolver::solve - failed to set up the preconditioner: "
+	       << e.what() << endln;
+	thePrecond = 0;
+	return -1;
+    }
+
+    numReuse = 0;
+    numIterFirst = 0;
+
+    return 0;
+}
+
+
+int
+AMGLinSolver::iterate(int &numIter, double &error)
+{
+    int n = theSOE->X.Size();
+    std::shared_ptr<AMGMatrix> A =
+	amgcl::adapter::zero_copy(n, &(theSOE->rowStartA[0]),
+				  &(theSOE->colA[0]), &(theSOE->A[0]));
+
+    std::vector<double> rhs(n), x(n, 0.0);
+    for (int i=0; i<n; i++)
+	rhs[i] = theSOE->B(i);
+
+    size_t iters = 0;
+    try {
+	std::tie(iters, error) = thePrecond->solve(*A, rhs, x);
+    } catch (std::exception &e) {
+	opserr << "WARNING AMGLinSolver::solve - " << e.what() << endln;
+	return -1;
+    }
+    numIter = (int)iters;
+
+    if (numIter >= maxIter && error > tol)
+	return -2;
+
+    for (int i=0; i<n; i++)
+	theSOE->X(i) = x[i];
+
+    return 0;
+}
+
+
+int
+AMGLinSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING AMGLinSolver::solve - no LinearSOE has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->X.Size();
+    if (n == 0 || theSOE->A.size() == 0)
+	return 0;
+
+    // decide if the preconditioner from a previous solve can be reused
+    bool newPrecond = false;
+    if (thePrecond == 0 || numReuse >= maxReuse ||
+	(numReuse > 0 && numIterLast > rebuildRatio*(numIterFirst > 0 ? numIterFirst : 1))) {
+	if (this->formPreconditioner() < 0)
+	    return -1;
+	newPrecond = true;
+    }
+
+    int numIter = 0;
+    double error = 0.0;
+    int res = this->iterate(numIter, error);
+
+    // if it did not converge with an old preconditioner try a new one
+    if (res == -2 && newPrecond == false) {
+	if (printFlag)
+	    opserr << "AMGLinSolver::solve - no convergence in " << numIter
+		   << " iterations, forming new preconditioner\n";
+	if (this->formPreconditioner() < 0)
+	    return -1;
+	newPrecond = true;
+	res = this->iterate(numIter, error);
+    }
+
+    numReuse++;
+    numIterLast = numIter;
+    if (newPrecond)
+	numIterFirst = numIter;
+
+    if (printFlag)
+	opserr << "AMGLinSolver::solve - iterations: " << numIter << " error: " << error
+	       << (newPrecond ? " (new preconditioner)\n" : "\n");
+
+    if (res == -2) {
+	opserr << "WARNING AMGLinSolver::solve - failed to converge in " << numIter
+	       << " iterations, relative residual " << error << endln;
+	return -1;
+    }
+
+    return res;
+}
+
+
+int
+AMGLinSolver::setSize()
+{
+    // the structure of A has changed, a new preconditioner is needed
+    if (thePrecond != 0)
+	delete thePrecond;
+    thePrecond = 0;
+    numReuse = 0;
+    numIterFirst = 0;
+    numIterLast = 0;
+
+    return 0;
+}
+
+
+int
+AMGLinSolver::setLinearSOE(AMGLinSOE &theLinearSOE)
+{
+    theSOE = &theLinearSOE;
+    return 0;
+}
+
+
+int
+AMGLinSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    // nothing to do
+    return 0;
+}
+
+
+int
+AMGLinSolver::recvSelf(int ctag,
+		       Channel &theChannel,
+		       FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
@@ -0,0 +1,97 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/amgGEN/AMGLinSolver.h,v $
+                                                                        
+// Created: 10/26
+// Revision: A
+//
+// Description: This file contains the class definition for AMGLinSolver.
+// It solves the AMGLinSOE object with the CG, BiCGStab or GMRES method
+// preconditioned by smoothed aggregation AMG, using the AMGCL library.
+// The preconditioner is set up from the current A and reused for the
+// following solves (e.g. the iterations of a Newton step) until one of:
+//   - setSize() is invoked (the structure of A has changed),
+//   - it has been used for maxReuse solves,
+//   - the number of iterations grows above rebuildRatio times the number
+//     needed in the first solve after it was set up,
+//   - a solve with it fails to converge, the solve is then repeated with
+//     a new preconditioner.
+//
+// What: "@(#) AMGLinSolver.h, revA"
+
+#ifndef AMGLinSolver_h
+#define AMGLinSolver_h
+
+#include <LinearSOESolver.h>
+
+class AMGLinSOE;
+class AMGPreconditioner;
+
+#define AMG_SOLVER_CG       0
+#define AMG_SOLVER_BICGSTAB 1
+#define AMG_SOLVER_GMRES    2
+
+#define AMG_SMOOTHER_SPAI0  0
+#define AMG_SMOOTHER_ILU0   1
+
+class AMGLinSolver : public LinearSOESolver
+{
+  public:
+    AMGLinSolver(int solverType = AMG_SOLVER_GMRES,
+		 int smootherType = AMG_SMOOTHER_SPAI0,
+		 double tol = 1.0e-8, int maxIter = 1000, int restart = 30,
+		 int maxReuse = 20, double rebuildRatio = 2.0,
+		 bool printFlag = false);
+    ~AMGLinSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setLinearSOE(AMGLinSOE &theSOE);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int formPreconditioner(void);
+    int iterate(int &numIter, double &error);
+
+    AMGLinSOE *theSOE;
+    AMGPreconditioner *thePrecond;
+
+    int solverType, smootherType;
+    double tol;
+    int maxIter, restart;
+    int maxReuse;        // number of solves a preconditioner is used for
+    double rebuildRatio; // allowed growth in number of iterations
+    bool printFlag;
+
+    int numReuse;        // solves since preconditioner was set up
+    int numIterFirst;    // iterations in first solve with preconditioner
+    int numIterLast;     // iterations in last solve
+};
+
+#endif
@@ -37,6 +37,7 @@
 
 #include <BandGenLinLapackSolver.h>
 #include <BandGenLinSOE.h>
+#include <Matrix.h>
 #include <math.h>
 
 void* OPS_BandGenLinLapack()
@@ -89,61 +90,73 @@ BandGenLinLapackSolver::solve(void)
 	return -1;
     }
 
-    int n = theSOE->size;    
+    // a single right hand side; B and X wrap the SOE vectors
+    int n = theSOE->size;
+    Matrix B(theSOE->B, n, 1);
+    Matrix X(theSOE->X, n, 1);
+    return this->solveMultiple(B, X);
+}
+
+int
+BandGenLinLapackSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    int nrhs = B.noCols();
+    if (n == 0 || nrhs == 0)
+	return 0;
+
     // check iPiv is large enough
     if (iPivSize < n) {
-	opserr << "WARNING BandGenLinLapackSolver::solve(void)- ";
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple()- ";
 	opserr << " iPiv not large enough - has setSize() been called?\n";
 	return -1;
-    }	    
+    }
 
     int kl = theSOE->numSubD;
     int ku = theSOE->numSuperD;
     int ldA = 2*kl + ku +1;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
-    int    *iPIV = iPiv;
-    
-    // first copy B into X
-    for (int i=0; i<n; i++) {
-	*(Xptr++) = *(Bptr++);
-    }
-    Xptr = theSOE->X;
+    char type[] = "N";
 
-    // now solve AX = B
+    // X is stored column major, as LAPACK wants it, so copy B into X
+    // and solve AX = B for all the columns at once in place
+    X = B;
+    double *Xptr = &X(0,0);
 
 #ifdef _WIN32
-    {if (theSOE->factored == false)  
-	// factor and solve 
-	DGBSV(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);	
-    else  {
+    {if (theSOE->factored == false)
+	// factor and solve
+	DGBSV(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
+    else
 	// solve only using factored matrix
-	unsigned int sizeC = 1;
-	//DGBTRS("N",&sizeC,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
-    char type[] = "N";
-	DGBTRS(type,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
-    }}
+	DGBTRS(type,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
+    }
 #else
-    {if (theSOE->factored == false)      
-	// factor and solve 	
-	dgbsv_(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+    {if (theSOE->factored == false)
+	// factor and solve
+	dgbsv_(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
     else
-	// solve only using factored matrix	
-	dgbtrs_("N",&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+	// solve only using factored matrix
+	dgbtrs_(type,&n,&kl,&ku,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
     }
 #endif
+
     // check if successful
     if (info != 0) {
       if (info > 0) {
-	opserr << "WARNING BandGenLinLapackSolver::solve() -";
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple() -";
 	opserr << "factorization failed, matrix singular U(i,i) = 0, i= " << info-1 << endln;
 	return -info+1;
       } else {
-	opserr << "WARNING BandGenLinLapackSolver::solve() - OpenSees code error\n";
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple() - OpenSees code error\n";
 	return info;
       }
     }
@@ -151,7 +164,6 @@ BandGenLinLapackSolver::solve(void)
     theSOE->factored = true;
     return 0;
 }
-    
 
 
 int
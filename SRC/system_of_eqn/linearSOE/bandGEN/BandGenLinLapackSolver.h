@@ -49,6 +49,9 @@ class BandGenLinLapackSolver : public BandGenLinSolver
     int solve(void);
     int setSize(void);
 
+    bool canSolveMultiple(void) {return true;};
+    int solveMultiple(const Matrix &B, Matrix &X);
+
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
@@ -70,6 +70,7 @@ class BandGenLinSOE : public LinearSOE
 
     virtual void setX(int loc, double value);    
     virtual void setX(const Vector &x);    
+    virtual bool isThreadSafe(void) {return true;};
 
     virtual int setBandGenSolver(BandGenLinSolver &newSolver);    
 
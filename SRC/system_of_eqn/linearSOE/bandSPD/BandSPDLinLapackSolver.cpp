@@ -32,6 +32,7 @@
 
 #include <BandSPDLinLapackSolver.h>
 #include <BandSPDLinSOE.h>
+#include <Matrix.h>
 //#include <f2c.h>
 #include <math.h>
 
@@ -86,61 +87,72 @@ BandSPDLinLapackSolver::solve(void)
 	return -1;
     }
 
+    // a single right hand side; B and X wrap the SOE vectors
     int n = theSOE->size;
+    Matrix B(theSOE->B, n, 1);
+    Matrix X(theSOE->X, n, 1);
+    return this->solveMultiple(B, X);
+}
+
+int
+BandSPDLinLapackSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BandSPDLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    int nrhs = B.noCols();
+    if (n == 0 || nrhs == 0)
+	return 0;
+
     int kd = theSOE->half_band -1;
     int ldA = kd +1;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
-
-    // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
-
-    // now solve AX = Y
+    char uplo[] = "U";
 
-	
+    // X is stored column major, as LAPACK wants it, so copy B into X
+    // and solve AX = B for all the columns at once in place
+    X = B;
+    double *Xptr = &X(0,0);
 
 #ifdef _WIN32
-    if (theSOE->factored == false) {
-	// factor and solve 	
-	unsigned int sizeC = 1;
-	DPBSV("U", &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);	
+    {if (theSOE->factored == false)
+	// factor and solve
+	DPBSV(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+     else
+	// solve only using factored matrix
+	DPBTRS(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
     }
-      else {
-	// solve only using factored matrix	  
-	unsigned int sizeC = 1;	
-	//DPBTRS("U", sizeC, &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);	
-	DPBTRS("U", &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-    }
-#else	
-    { if (theSOE->factored == false)          
-	dpbsv_("U",&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-      else
-	dpbtrs_("U",&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#else
+    {if (theSOE->factored == false)
+	// factor and solve
+	dpbsv_(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+     else
+	// solve only using factored matrix
+	dpbtrs_(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
     }
-#endif    
+#endif
 
     // check if successful
     if (info != 0) {
       if (info > 0) {
-	opserr << "WARNING BandSPDLinLapackSolver::solve() -";
+	opserr << "WARNING BandSPDLinLapackSolver::solveMultiple() -";
 	opserr << "factorization failed, matrix singular U(i,i) = 0, i= " << info-1 << endln;
 	return -info+1;
       } else {
-	opserr << "WARNING BandSPDLinLapackSolver::solve() - OpenSees code error\n";
+	opserr << "WARNING BandSPDLinLapackSolver::solveMultiple() - OpenSees code error\n";
 	return info;
-      }      
+      }
     }
 
     theSOE->factored = true;
     return 0;
 }
-    
 
 
 int
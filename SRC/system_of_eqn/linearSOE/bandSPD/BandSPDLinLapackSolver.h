@@ -46,6 +46,9 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
 
     int solve(void);
     int setSize(void);
+
+    bool canSolveMultiple(void) {return true;};
+    int solveMultiple(const Matrix &B, Matrix &X);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
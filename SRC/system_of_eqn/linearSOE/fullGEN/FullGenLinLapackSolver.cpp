@@ -34,6 +34,7 @@
 
 #include <FullGenLinLapackSolver.h>
 #include <FullGenLinSOE.h>
+#include <Matrix.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -79,66 +80,76 @@ FullGenLinLapackSolver::solve(void)
 	opserr << " No LinearSOE object has been set\n";
 	return -1;
     }
-    
+
+    // a single right hand side; B and X wrap the SOE vectors
     int n = theSOE->size;
-    
-    // check for quick return
-    if (n == 0)
+    Matrix B(theSOE->B, n, 1);
+    Matrix X(theSOE->X, n, 1);
+    return this->solveMultiple(B, X);
+}
+
+int
+FullGenLinLapackSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    int nrhs = B.noCols();
+    if (n == 0 || nrhs == 0)
 	return 0;
-    
+
     // check iPiv is large enough
     if (sizeIpiv < n) {
-	opserr << "WARNING FullGenLinLapackSolver::solve(void)- ";
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple()- ";
 	opserr << " iPiv not large enough - has setSize() been called?\n";
 	return -1;
-    }	
-	
+    }
+
     int ldA = n;
-    int nrhs = 1;
     int ldB = n;
     int info;
     double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
-    int *iPIV = iPiv;
-    
-    // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
+    char type[] = "N";
 
-    // now solve AX = Y
+    // X is stored column major, as LAPACK wants it, so copy B into X
+    // and solve AX = B for all the columns at once in place
+    X = B;
+    double *Xptr = &X(0,0);
 
 #ifdef _WIN32
-    {if (theSOE->factored == false)  
-	// factor and solve 
-	DGESV(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
-     else {
-	// solve only using factored matrix	 
-	 unsigned int sizeC = 1;
-	 DGETRS("N", &n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);	 
-     }}
+    {if (theSOE->factored == false)
+	// factor and solve
+	DGESV(&n,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
+     else
+	// solve only using factored matrix
+	DGETRS(type,&n,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
+    }
 #else
-    {if (theSOE->factored == false)      
-	dgesv_(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+    {if (theSOE->factored == false)
+	// factor and solve
+	dgesv_(&n,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
      else
-	dgetrs_("N", &n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+	// solve only using factored matrix
+	dgetrs_(type,&n,&nrhs,Aptr,&ldA,iPiv,Xptr,&ldB,&info);
     }
 #endif
-    
+
     // check if successful
     if (info != 0) {
       if (info > 0) {
-	opserr << "WARNING FullGenLinLapackSolver::solve() -";
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple() -";
 	opserr << "factorization failed, matrix singular U(i,i) = 0, i= " << info-1 << endln;
 	return -info+1;
       } else {
-	opserr << "WARNING FullGenLinLapackSolver::solve() - OpenSees code error\n";
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple() - OpenSees code error\n";
 	return info;
-      }      
+      }
     }
 
-    
     theSOE->factored = true;
     return 0;
 }
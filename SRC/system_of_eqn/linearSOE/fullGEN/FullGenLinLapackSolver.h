@@ -48,6 +48,9 @@ class FullGenLinLapackSolver : public FullGenLinSolver
 
     int solve(void);
     int setSize(void);
+
+    bool canSolveMultiple(void) {return true;};
+    int solveMultiple(const Matrix &B, Matrix &X);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -62,6 +62,7 @@ class ProfileSPDLinSOE : public LinearSOE
 
     virtual void setX(int loc, double value);
     virtual void setX(const Vector &x);
+    virtual bool isThreadSafe(void) {return true;};
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);
@@ -50,7 +50,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternHash(0), patternChanged(true)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -61,7 +61,7 @@ SparseGenColLinSOE::SparseGenColLinSOE()
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternHash(0), patternChanged(true)
 {
 
 }
@@ -71,7 +71,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int classTag)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternHash(0), patternChanged(true)
 {
 
 }
@@ -82,7 +82,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver, int cl
    size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
    vectX(0), vectB(0),
    Asize(0), Bsize(0),
-   factored(false)
+   factored(false), patternHash(0), patternChanged(true)
 {
   //    the_Solver.setLinearSOE(*this);
 }
@@ -95,7 +95,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int N, int NNZ, int *ColStartA, int *RowA
  rowA(RowA), colStartA(ColStartA), 
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternHash(0), patternChanged(true)
 {
 
     A = new (nothrow) double[NNZ];
@@ -167,6 +167,7 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
+    patternChanged = true;
 
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
@@ -289,6 +290,49 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	colStartA[a+1] = lastLoc;;	    
 	startLoc = lastLoc;
       }
+
+      // if the pattern is the one of the last setSize() the solver
+      // can keep its column ordering and elimination tree
+      // (a matching fingerprint is confirmed against the stored pattern)
+      unsigned long long newHash = hashSparsity(size, nnz, colStartA, rowA);
+      patternChanged = (result != 0 || newHash != patternHash ||
+			sameSparsity(size, nnz, colStartA, rowA,
+				     patternStart, patternIndex) == false);
+      patternHash = newHash;
+      if (patternChanged == true) {
+	patternStart.assign(colStartA, colStartA+size+1);
+	patternIndex.assign(rowA, rowA+nnz);
+      }
+    }
+
+    // determine the location in A of each entry of the FE_Element and
+    // DOF_Group matrices so addA() does not have to search rowA
+    theScatterMap.clearAll();
+    if (theModel != 0 && size != 0) {
+      theScatterMap.setSize(*theModel);
+      int numIDs = theScatterMap.getNumIDs();
+      for (int index=0; index<numIDs; index++) {
+	int idSize;
+	const int *eqns = theScatterMap.getEqns(index, idSize);
+	double **locs = theScatterMap.getLocations(index);
+	for (int i=0; i<idSize; i++) {
+	  int col = eqns[i];
+	  if (col < size && col >= 0) {
+	    int startColLoc = colStartA[col];
+	    int endColLoc = colStartA[col+1];
+	    for (int j=0; j<idSize; j++) {
+	      int row = eqns[j];
+	      if (row < size && row >= 0) {
+		for (int k=startColLoc; k<endColLoc; k++)
+		  if (rowA[k] == row) {
+		    locs[i*idSize+j] = &A[k];
+		    k = endColLoc;
+		  }
+	      }
+	    }
+	  }
+	}
+      }
     }
 
     
@@ -319,6 +363,27 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	opserr << " - Matrix and ID not of similar sizes\n";
 	return -1;
     }
+
+    // if the locations for id were determined in setSize() add directly
+    double **locs = theScatterMap.getLocations(id);
+    if (locs != 0) {
+      if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    double *loc = *locs++;
+	    if (loc != 0)
+	      *loc += m(j,i);
+	  }
+      } else {
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    double *loc = *locs++;
+	    if (loc != 0)
+	      *loc += fact * m(j,i);
+	  }
+      }
+      return 0;
+    }
     
     if (fact == 1.0) { // do not need to multiply 
       for (int i=0; i<idSize; i++) {
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 class SparseGenColLinSolver;
 
@@ -68,6 +69,7 @@ class SparseGenColLinSOE : public LinearSOE
 
     virtual void setX(int loc, double value);        
     virtual void setX(const Vector &x);        
+    virtual bool isThreadSafe(void) {return true;};
     virtual int setSparseGenColSolver(SparseGenColLinSolver &newSolver);    
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
@@ -96,8 +98,12 @@ class SparseGenColLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    unsigned long long patternHash; // fingerprint of colStartA and rowA
+    std::vector<int> patternStart, patternIndex; // copy of that pattern
+    bool patternChanged;            // pattern differs from last setSize()
     
   private:
+    ScatterMap theScatterMap; // location in A of each FE_Element & DOF_Group matrix entry
 
 };
 
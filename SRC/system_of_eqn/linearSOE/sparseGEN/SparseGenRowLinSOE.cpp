@@ -255,6 +255,36 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
       }
     }
 
+    // determine the location in A of each entry of the FE_Element and
+    // DOF_Group matrices so addA() does not have to search colA
+    theScatterMap.clearAll();
+    if (theModel != 0 && size != 0) {
+      theScatterMap.setSize(*theModel);
+      int numIDs = theScatterMap.getNumIDs();
+      for (int index=0; index<numIDs; index++) {
+	int idSize;
+	const int *eqns = theScatterMap.getEqns(index, idSize);
+	double **locs = theScatterMap.getLocations(index);
+	for (int i=0; i<idSize; i++) {
+	  int row = eqns[i];
+	  if (row < size && row >= 0) {
+	    int startRowLoc = rowStartA[row];
+	    int endRowLoc = rowStartA[row+1];
+	    for (int j=0; j<idSize; j++) {
+	      int col = eqns[j];
+	      if (col < size && col >= 0) {
+		for (int k=startRowLoc; k<endRowLoc; k++)
+		  if (colA[k] == col) {
+		    locs[i*idSize+j] = &A[k];
+		    k = endRowLoc;
+		  }
+	      }
+	    }
+	  }
+	}
+      }
+    }
+
     // invoke setSize() on the Solver   
      LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -281,6 +311,27 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	opserr << " - Matrix and ID not of similar sizes\n";
 	return -1;
     }
+
+    // if the locations for id were determined in setSize() add directly
+    double **locs = theScatterMap.getLocations(id);
+    if (locs != 0) {
+	if (fact == 1.0) { // do not need to multiply 
+	    for (int i=0; i<idSize; i++)
+		for (int j=0; j<idSize; j++) {
+		    double *loc = *locs++;
+		    if (loc != 0)
+			*loc += m(i,j);
+		}
+	} else {
+	    for (int i=0; i<idSize; i++)
+		for (int j=0; j<idSize; j++) {
+		    double *loc = *locs++;
+		    if (loc != 0)
+			*loc += fact * m(i,j);
+		}
+	}
+	return 0;
+    }
     
     if (fact == 1.0) { // do not need to multiply 
 	for (int i=0; i<idSize; i++) {
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 class SparseGenRowLinSolver;
 
@@ -83,6 +84,7 @@ class SparseGenRowLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    ScatterMap theScatterMap; // location in A of each FE_Element & DOF_Group matrix entry
 };
 
 
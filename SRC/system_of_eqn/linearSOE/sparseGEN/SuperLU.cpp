@@ -34,6 +34,7 @@
 
 #include <SuperLU.h>
 #include <SparseGenColLinSOE.h>
+#include <Matrix.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -231,42 +232,105 @@ SuperLU::solve(void)
     for (int i=0; i<n; i++)
 	*(Xptr++) = *(Bptr++);
 
-    GlobalLU_t Glu; /* Not needed on return. */
-
     if (theSOE->factored == false) {
-	// factor the matrix
-	int info;
+	int res = this->factor();
+	if (res < 0)
+	  return res;
+    }	
 
-	if (L.ncol != 0 && symmetric == 'N') {
-	  Destroy_SuperNode_Matrix(&L);
-	  Destroy_CompCol_Matrix(&U);	  
-	}
+    // do forward and backward substitution
+    trans_t trans = NOTRANS;
+    int info;
+    dgstrs (trans, &L, &U, perm_c, perm_r, &B, &stat, &info);    
+
+    if (info != 0) {	
+       opserr << "WARNING SuperLU::solve(void)- ";
+       opserr << " Error " << info << " returned in substitution dgstrs()\n";
+       return -info;
+    }
+
+    return 0;
+}
 
-	dgstrf(&options, &AC, relax, panelSize,
-	       etree, NULL, 0, perm_c, perm_r, &L, &U, &Glu, &stat, &info);
+int
+SuperLU::factor(void)
+{
+    GlobalLU_t Glu; /* Not needed on return. */
 
+    // factor the matrix
+    int info;
 
-	if (info != 0) {	
-	  opserr << "WARNING SuperLU::solve(void)- ";
-	  opserr << " Error " << info << " returned in factorization dgstrf()\n";
-	  return -info;
-	}
+    if (L.ncol != 0 && symmetric == 'N') {
+      Destroy_SuperNode_Matrix(&L);
+      Destroy_CompCol_Matrix(&U);	  
+    }
 
-	if (symmetric == 'Y')
-	  options.Fact= SamePattern_SameRowPerm;
-	else
-	  options.Fact = SamePattern;
+    dgstrf(&options, &AC, relax, panelSize,
+	   etree, NULL, 0, perm_c, perm_r, &L, &U, &Glu, &stat, &info);
+
+    if (info != 0) {	
+      opserr << "WARNING SuperLU::factor()- ";
+      opserr << " Error " << info << " returned in factorization dgstrf()\n";
+      return -info;
+    }
+
+    if (symmetric == 'Y')
+      options.Fact= SamePattern_SameRowPerm;
+    else
+      options.Fact = SamePattern;
 	
-	theSOE->factored = true;
+    theSOE->factored = true;
+    return 0;
+}
+
+int
+SuperLU::solveMultiple(const Matrix &Bm, Matrix &Xm)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING SuperLU::solveMultiple()- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+    
+    int n = theSOE->size;
+    int nrhs = Bm.noCols();
+    if (n == 0 || nrhs == 0)
+	return 0;
+
+    if (sizePerm == 0) {
+	opserr << "WARNING SuperLU::solveMultiple()- ";
+	opserr << " size for row and col permutations 0 - has setSize() been called?\n";
+	return -1;
+    }
+
+    if (theSOE->factored == false) {
+	int res = this->factor();
+	if (res < 0)
+	  return res;
     }	
 
-    // do forward and backward substitution
+    // dense column major block of right hand sides, solved in place
+    double *Xptr = new double[n*nrhs];
+    for (int j=0; j<nrhs; j++)
+	for (int i=0; i<n; i++)
+	    Xptr[j*n+i] = Bm(i,j);
+
+    SuperMatrix Bblock;
+    dCreate_Dense_Matrix(&Bblock, n, nrhs, Xptr, n, SLU_DN, SLU_D, SLU_GE);
+
     trans_t trans = NOTRANS;
     int info;
-    dgstrs (trans, &L, &U, perm_c, perm_r, &B, &stat, &info);    
+    dgstrs (trans, &L, &U, perm_c, perm_r, &Bblock, &stat, &info);    
+
+    Destroy_SuperMatrix_Store(&Bblock);
+
+    for (int j=0; j<nrhs; j++)
+	for (int i=0; i<n; i++)
+	    Xm(i,j) = Xptr[j*n+i];
+    delete [] Xptr;
 
     if (info != 0) {	
-       opserr << "WARNING SuperLU::solve(void)- ";
+       opserr << "WARNING SuperLU::solveMultiple()- ";
        opserr << " Error " << info << " returned in substitution dgstrs()\n";
        return -info;
     }
@@ -283,6 +347,29 @@ SuperLU::setSize()
     int n = theSOE->size;
     if (n > 0) {
 
+      // if the pattern is unchanged A, AC and B still refer to the
+      // SOE arrays, so the column ordering and elimination tree are
+      // kept and the next factorization can reuse the pattern
+      if (theSOE->patternChanged == false && A.ncol == n && sizePerm >= n)
+	return 0;
+
+      // release the SuperMatrix stores of the previous pattern
+      if (AC.ncol != 0) {
+	NCPformat *ACstore = (NCPformat *)AC.Store;
+	SUPERLU_FREE(ACstore->colbeg);
+	SUPERLU_FREE(ACstore->colend);
+	SUPERLU_FREE(ACstore);
+	AC.ncol = 0;
+      }
+      if (A.ncol != 0) {
+	SUPERLU_FREE(A.Store);
+	A.ncol = 0;
+      }
+      if (B.ncol != 0) {
+	SUPERLU_FREE(B.Store);
+	B.ncol = 0;
+      }
+
       // create space for the permutation vectors 
       // and the elimination tree
       if (sizePerm < n) {
@@ -61,12 +61,17 @@ class SuperLU : public SparseGenColLinSolver
     int solve(void);
     int setSize(void);
 
+    bool canSolveMultiple(void) {return true;};
+    int solveMultiple(const Matrix &B, Matrix &X);
+
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
     
   protected:
 
   private:
+    int factor(void);
+
     SuperMatrix A,L,U,B,AC;
     int *perm_r;
     int *perm_c;
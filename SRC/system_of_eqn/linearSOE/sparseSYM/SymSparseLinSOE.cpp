@@ -236,10 +236,123 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
     nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
 
+    // determine the location in diag, penv and the row segments of the
+    // upper entries of the FE_Element and DOF_Group matrices so addA()
+    // does not have to sort the id and search the row segments each time
+    theScatterMap.clearAll();
+    if (theModel != 0 && size != 0 && result == 0) {
+	theScatterMap.setSize(*theModel);
+	int numIDs = theScatterMap.getNumIDs();
+	for (int index=0; index<numIDs; index++) {
+	    int idSize;
+	    const int *eqns = theScatterMap.getEqns(index, idSize);
+	    this->formLocations(eqns, idSize, theScatterMap.getLocations(index));
+	}
+    }
+
     return result;
 }
 
 
+/* Determine the location of entry (p,q), p <= q, of a matrix with the given
+ * id; the location is stored in locs[p*idSize+q], entries outside the
+ * system are left as 0. The storage is traversed as in addA().
+ */
+void SymSparseLinSOE::formLocations(const int *id, int idSize, double **locs)
+{
+   // ipos is the position in id, newID the permuted equation number
+   int *newID = new (nothrow) int[idSize];
+   int *isort = new (nothrow) int[idSize];
+   if (newID == 0 || isort == 0) {
+       if (newID != 0) delete [] newID;
+       if (isort != 0) delete [] isort;
+       return;
+   }
+
+   int i, j, k, lnee;
+   for (i = 0, k = 0; i < idSize; i++) {
+       if (id[i] >= 0 && id[i] < size) {
+	   newID[i] = invp[id[i]];
+	   isort[k] = i;
+	   k++;
+       } else
+	   newID[i] = -1;
+   }
+   lnee = k;
+
+   if (lnee == 0) {
+       delete [] newID;
+       delete [] isort;
+       return;
+   }
+
+   /* sort isort on the permuted equation numbers */
+   i = k - 1;
+   do
+   {
+       k = 0 ;
+       for (j = 0 ; j < i ; j++)
+       {  
+	   if ( newID[isort[j]] > newID[isort[j+1]]) {  
+	       isort[j] ^= isort[j+1] ;
+	       isort[j+1] ^= isort[j] ;
+	       isort[j] ^= isort[j+1] ;
+	       k = j ;
+	   }
+      }
+      i = k ;
+   }  while ( k > 0) ;
+
+   long int  i_eq, j_eq;
+   int  ipos, jpos, it, jt, iblk;
+   OFFDBLK  *ptr;
+   OFFDBLK  *saveblk;
+   double  *iloc;
+
+   ipos = isort[0] ;
+   k = rowblks[newID[ipos]] ;
+   saveblk  = begblk[k] ;
+
+   for (i=0; i<lnee; i++)
+   { 
+       ipos = isort[i] ;
+       i_eq = newID[ipos] ;
+       iblk = rowblks[i_eq] ;
+       iloc = penv[i_eq +1] - i_eq ;
+       if (k < iblk)
+	   while (saveblk->row != i_eq) saveblk = saveblk->bnext ;
+
+       ptr = saveblk ;
+       for (j=0; j< i ; j++)
+       {   
+	   jpos = isort[j] ;
+	   j_eq = newID[jpos] ;
+
+	   if (ipos > jpos) {
+	       jt = ipos;
+	       it = jpos;
+	   } else {
+	       it = ipos;
+	       jt = jpos;
+	   }
+
+	   if (j_eq >= xblk[iblk]) /* diagonal block (profile) */
+	       locs[it*idSize + jt] = iloc + j_eq ;
+	   else /* row segment */
+	   { 
+	       while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
+		   ptr = ptr->next ;
+	       locs[it*idSize + jt] = ptr->nz + (j_eq - ptr->beg);
+	   }
+       }
+       locs[ipos*idSize + ipos] = &diag[i_eq]; /* diagonal element */
+   }
+
+   delete [] newID;
+   delete [] isort;
+}
+
+
 /* Perform the element stiffness assembly here.
  */
 int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
@@ -258,6 +371,18 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
        return -1;
    }
 
+   // if the locations for in_id were determined in setSize() add directly
+   double **locs = theScatterMap.getLocations(in_id);
+   if (locs != 0) {
+       for (int ii = 0; ii < idSize; ii++)
+	   for (int jj = ii; jj < idSize; jj++) {
+	       double *loc = locs[ii*idSize + jj];
+	       if (loc != 0)
+		   *loc += in_m(ii, jj) * fact;
+	   }
+       return 0;
+   }
+
    // construct m and id based on non-negative id values.
    int newPt = 0;
    int *id = new (nothrow) int[idSize];
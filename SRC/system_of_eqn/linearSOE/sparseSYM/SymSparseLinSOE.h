@@ -21,6 +21,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 extern "C" {
    #include <FeStructs.h>
@@ -63,6 +64,8 @@ class SymSparseLinSOE : public LinearSOE
   protected:
     
   private:
+    void formLocations(const int *id, int idSize, double **locs);
+
     int size;            // order of A
     int nnz;             // number of non-zeros in A
     double *B, *X;       // 1d arrays containing coefficients of B and X
@@ -81,6 +84,8 @@ class SymSparseLinSOE : public LinearSOE
     OFFDBLK  **begblk;
     OFFDBLK  *first;
 
+    ScatterMap theScatterMap; // location of each upper FE_Element & DOF_Group matrix entry
+
 };
 
 #endif
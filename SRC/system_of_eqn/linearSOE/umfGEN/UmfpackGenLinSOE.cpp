@@ -48,14 +48,16 @@
 #include <ID.h>
 
 UmfpackGenLinSOE::UmfpackGenLinSOE(UmfpackGenLinSolver &the_Solver)
-    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(),
+     patternHash(0), patternChanged(true)
 {
     the_Solver.setLinearSOE(*this);
 }
 
 
 UmfpackGenLinSOE::UmfpackGenLinSOE()
-    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(),
+     patternHash(0), patternChanged(true)
 {
 }
 
@@ -79,6 +81,7 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	opserr<<"size of soe < 0\n";
 	return -1;
     }
+    patternChanged = true;
 
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
@@ -90,9 +93,11 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
     }
 
     // resize A, B, X
+    Ap.clear();
+    Ai.clear();
     Ap.reserve(size+1);
     Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    Ax.assign(nnz,0.0);
     B.resize(size);
     B.Zero();
     X.resize(size);
@@ -132,6 +137,51 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	Ap.push_back(Ap[a]+col.Size());
     }
 
+    // if the pattern is the one of the last setSize() the solver
+    // can keep its symbolic factorization
+    // (a matching fingerprint is confirmed against the stored pattern)
+    int numAi = (int)Ai.size();
+    unsigned long long newHash = hashSparsity(size, numAi, Ap.data(), Ai.data());
+    patternChanged = (newHash != patternHash ||
+		      sameSparsity(size, numAi, Ap.data(), Ai.data(),
+				   patternStart, patternIndex) == false);
+    patternHash = newHash;
+    if (patternChanged == true) {
+	patternStart = Ap;
+	patternIndex = Ai;
+    }
+
+    // determine the location in Ax of each entry of the FE_Element and
+    // DOF_Group matrices so addA() does not have to search Ai
+    theScatterMap.clearAll();
+    if (theModel != 0 && size != 0) {
+	theScatterMap.setSize(*theModel);
+	int numIDs = theScatterMap.getNumIDs();
+	for (int index=0; index<numIDs; index++) {
+	    int idSize;
+	    const int *eqns = theScatterMap.getEqns(index, idSize);
+	    double **locs = theScatterMap.getLocations(index);
+	    for (int j=0; j<idSize; j++) {
+		int col = eqns[j];
+		if (col<0 || col>=size) {
+		    continue;
+		}
+		for (int i=0; i<idSize; i++) {
+		    int row = eqns[i];
+		    if (row<0 || row>=size) {
+			continue;
+		    }
+		    for (int k=Ap[col]; k<Ap[col+1]; k++) {
+			if (Ai[k] == row) {
+			    locs[j*idSize+i] = &Ax[k];
+			    break;
+			}
+		    }
+		}
+	    }
+	}
+    }
+
     // invoke setSize() on the Solver
     LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -158,6 +208,31 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
 
+    // if the locations for id were determined in setSize() add directly
+    double **locs = theScatterMap.getLocations(id);
+    if (locs != 0) {
+	if (fact == 1.0) { // do not need to multiply
+	    for (int j=0; j<idSize; j++) {
+		for (int i=0; i<idSize; i++) {
+		    double *loc = *locs++;
+		    if (loc != 0) {
+			*loc += m(i,j);
+		    }
+		}
+	    }
+	} else {
+	    for (int j=0; j<idSize; j++) {
+		for (int i=0; i<idSize; i++) {
+		    double *loc = *locs++;
+		    if (loc != 0) {
+			*loc += fact*m(i,j);
+		    }
+		}
+	    }
+	}
+	return 0;
+    }
+
     int size = X.Size();
     if (fact == 1.0) { // do not need to multiply
 	for (int j=0; j<idSize; j++) {
@@ -37,6 +37,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 #include <vector>
 
 class UmfpackGenLinSolver;
@@ -64,6 +65,7 @@ public:
 
     void setX(int loc, double value);        
     void setX(const Vector &x);        
+    bool isThreadSafe(void) {return true;};
     int setUmfpackGenLinSolver(UmfpackGenLinSolver &newSolver);    
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -78,6 +80,10 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    unsigned long long patternHash; // fingerprint of Ap and Ai
+    std::vector<int> patternStart, patternIndex; // copy of Ap and Ai
+    bool patternChanged;            // Ap and Ai differ from last setSize()
+    ScatterMap theScatterMap; // location in Ax of each FE_Element & DOF_Group matrix entry
 };
 
 
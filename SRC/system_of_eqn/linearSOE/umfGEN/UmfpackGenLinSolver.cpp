@@ -34,6 +34,7 @@
 
 #include <UmfpackGenLinSOE.h>
 #include <UmfpackGenLinSolver.h>
+#include <Matrix.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -104,6 +105,54 @@ UmfpackGenLinSolver::solve(void)
     return 0;
 }
 
+int
+UmfpackGenLinSolver::solveMultiple(const Matrix &B, Matrix &X)
+{
+    int n = theSOE->X.Size();
+    int nnz = (int)theSOE->Ai.size();
+    int nrhs = B.noCols();
+    if (n == 0 || nnz==0 || nrhs == 0) return 0;
+
+    int* Ap = &(theSOE->Ap[0]);
+    int* Ai = &(theSOE->Ai[0]);
+    double* Ax = &(theSOE->Ax[0]);
+
+    // check if symbolic is done
+    if (Symbolic == 0) {
+	opserr<<"WARNING: setSize has not been called -- Umfpackgenlinsolver::solveMultiple\n";
+	return -1;
+    }
+
+    // one numerical factorization for all the right hand sides
+    void* Numeric = 0;
+    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+    if (status!=UMFPACK_OK) {
+	opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solveMultiple\n";
+	return -1;
+    }
+
+    // UMFPACK takes one right hand side per call, so the columns are
+    // solved in turn straight into X, whose columns are contiguous, with
+    // one workspace for all of them (umfpack_di_solve() would allocate
+    // and free one per column); 5n doubles cover iterative refinement
+    std::vector<int> Wi(n);
+    std::vector<double> W(5*n), b(n);
+    for (int j=0; j<nrhs && status==UMFPACK_OK; j++) {
+	for (int i=0; i<n; i++)
+	    b[i] = B(i,j);
+	status = umfpack_di_wsolve(UMFPACK_A,Ap,Ai,Ax,&X(0,j),&b[0],Numeric,Control,Info,&Wi[0],&W[0]);
+    }
+
+    umfpack_di_free_numeric(&Numeric);
+
+    if (status!=UMFPACK_OK) {
+	opserr<<"WARNING: solving returns "<<status<<" -- Umfpackgenlinsolver::solveMultiple\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 
 int
 UmfpackGenLinSolver::setSize()
@@ -117,6 +166,12 @@ UmfpackGenLinSolver::setSize()
     int nnz = (int)theSOE->Ai.size();
     if (n == 0 || nnz==0) return 0;
     
+    // the symbolic analysis depends on the pattern only, so keep
+    // it if the domain change left the pattern as it was
+    if (Symbolic != 0 && theSOE->patternChanged == false) {
+	return 0;
+    }
+
     int* Ap = &(theSOE->Ap[0]);
     int* Ai = &(theSOE->Ai[0]);
     double* Ax = &(theSOE->Ax[0]);
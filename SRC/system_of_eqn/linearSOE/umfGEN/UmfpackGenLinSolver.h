@@ -49,6 +49,9 @@ class UmfpackGenLinSolver : public LinearSOESolver
     int solve(void);
     int setSize(void);
 
+    bool canSolveMultiple(void) {return true;};
+    int solveMultiple(const Matrix &B, Matrix &X);
+
     int setLinearSOE(UmfpackGenLinSOE &theSOE);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -0,0 +1,290 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/VectorOfTaggedObjects.cpp,v $
+                                                                        
+                                                                        
+// Written: 10/26
+// Revision: A
+//
+// Purpose: This file contains the implementation of the VectorOfTaggedObjects
+// class.
+//
+// What: "@(#) VectorOfTaggedObjects.C, revA"
+
+#include <TaggedObject.h>
+#include <VectorOfTaggedObjects.h>
+
+#include <OPS_Globals.h>
+#include <algorithm>
+
+// tags below 2*numComponents + DIRECT_SLACK go in the direct index
+// table, anything larger in the hash table
+#define DIRECT_SLACK 1024
+
+VectorOfTaggedObjects::VectorOfTaggedObjects()
+:numComponents(0), sorted(true), maxTag(0), myIter(*this)
+{
+    // creates the iter with this as the argument
+}
+
+VectorOfTaggedObjects::~VectorOfTaggedObjects()
+{
+    this->clearAll();
+}
+
+
+int
+VectorOfTaggedObjects::setSize(int newSize)
+{
+    // reserve the space, the index table grows as the tags are added
+    if (newSize > 0 && newSize > int(theObjects.size()))
+      theObjects.reserve(newSize);
+
+    return 0;
+}
+
+
+bool 
+VectorOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+    int tag = newComponent->getTag();
+
+    // check if the object is already there, if not we add
+    if (this->findLocation(tag) != -1) {
+      opserr << "VectorOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
+	tag << "\n";
+      return false;
+    }
+
+    // appended; the vector is sorted before the next iteration if the
+    // tag is out of order
+    if (theObjects.empty() == false && tag < maxTag)
+      sorted = false;
+    if (theObjects.empty() == true || tag > maxTag)
+      maxTag = tag;
+
+    theObjects.push_back(newComponent);
+    this->setLocation(tag, int(theObjects.size())-1);
+    numComponents++;
+
+    return true;  // o.k.
+}
+
+
+TaggedObject *
+VectorOfTaggedObjects::removeComponent(int tag)
+{
+    // return 0 if component does not exist, otherwise remove it
+    int loc = this->findLocation(tag);
+    if (loc == -1)
+      return 0;
+
+    // leave a hole so that any iter in progress stays valid
+    TaggedObject *removed = theObjects[loc];
+    theObjects[loc] = 0;
+    this->setLocation(tag, -1);
+    numComponents--;
+
+    return removed;
+}
+
+
+int
+VectorOfTaggedObjects::getNumComponents(void) const
+{
+    return numComponents;
+}
+
+
+TaggedObject *
+VectorOfTaggedObjects::getComponentPtr(int tag)
+{
+    int loc = this->findLocation(tag);
+    if (loc == -1)
+      return 0;
+
+    return theObjects[loc];
+}
+
+
+TaggedObjectIter &
+VectorOfTaggedObjects::getComponents()
+{
+    // a new pass over the objects, so a good time to remove the holes
+    // and restore the tag order
+    this->order();
+
+    myIter.reset();
+    return myIter;
+}
+
+
+VectorOfTaggedObjectsIter 
+VectorOfTaggedObjects::getIter()
+{
+    this->order();
+    return VectorOfTaggedObjectsIter(*this);
+}
+
+
+TaggedObjectStorage *
+VectorOfTaggedObjects::getEmptyCopy(void)
+{
+    VectorOfTaggedObjects *theCopy = new VectorOfTaggedObjects();
+    
+    if (theCopy == 0) {
+      opserr << "VectorOfTaggedObjects::getEmptyCopy-out of memory\n";
+    }	
+
+    return theCopy;
+}
+
+
+void
+VectorOfTaggedObjects::clearAll(bool invokeDestructor)
+{
+    // invoke the destructor on all the tagged objects stored
+    if (invokeDestructor == true) {
+      for (size_t i=0; i<theObjects.size(); i++)
+	if (theObjects[i] != 0)
+	  delete theObjects[i];
+    }
+
+    // now clear the containers of all entries
+    theObjects.clear();
+    theDirectIndex.clear();
+    theHashIndex.clear();
+    numComponents = 0;
+    sorted = true;
+    maxTag = 0;
+}
+
+
+void
+VectorOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+    s << "\nnumComponents: " << this->getNumComponents() << endln;
+    // go through the vector, in tag order, invoking Print on the objects
+    this->order();
+    for (size_t i=0; i<theObjects.size(); i++)
+      if (theObjects[i] != 0)
+	theObjects[i]->Print(s, flag);
+}
+
+
+int
+VectorOfTaggedObjects::findLocation(int tag) const
+{
+    if (tag >= 0 && tag < int(theDirectIndex.size()))
+      return theDirectIndex[tag];
+
+    std::unordered_map<int, int>::const_iterator p = theHashIndex.find(tag);
+    if (p == theHashIndex.end())
+      return -1;
+
+    return p->second;
+}
+
+
+void
+VectorOfTaggedObjects::setLocation(int tag, int loc)
+{
+    int directSize = int(theDirectIndex.size());
+
+    // grow the direct table to take the tag if the tags are dense
+    // enough, moving over any hashed tags that now fall inside it; the
+    // table is at least doubled (up to the density bound) so that the
+    // pass over the hash table is only made a logarithmic number of times
+    int maxSize = 2*numComponents + DIRECT_SLACK;
+    if (loc != -1 && tag >= directSize && tag < maxSize) {
+      int newSize = 2*directSize;
+      if (newSize > maxSize)
+	newSize = maxSize;
+      if (newSize < tag+1)
+	newSize = tag+1;
+      theDirectIndex.resize(newSize, -1);
+      std::unordered_map<int, int>::iterator p = theHashIndex.begin();
+      while (p != theHashIndex.end()) {
+	if (p->first >= directSize && p->first < newSize) {
+	  theDirectIndex[p->first] = p->second;
+	  p = theHashIndex.erase(p);
+	} else
+	  p++;
+      }
+      directSize = newSize;
+    }
+
+    if (tag >= 0 && tag < directSize)
+      theDirectIndex[tag] = loc;
+    else if (loc != -1)
+      theHashIndex[tag] = loc;
+    else
+      theHashIndex.erase(tag);
+}
+
+
+void
+VectorOfTaggedObjects::squeeze(void)
+{
+    if (numComponents == int(theObjects.size()))
+      return;
+
+    // move the objects down over the holes and record their new position
+    int numKept = 0;
+    for (size_t i=0; i<theObjects.size(); i++) {
+      TaggedObject *theObject = theObjects[i];
+      if (theObject != 0) {
+	if (int(i) != numKept) {
+	  theObjects[numKept] = theObject;
+	  this->setLocation(theObject->getTag(), numKept);
+	}
+	numKept++;
+      }
+    }
+
+    theObjects.resize(numKept);
+}
+
+
+static bool
+lessTag(const TaggedObject *a, const TaggedObject *b)
+{
+    return a->getTag() < b->getTag();
+}
+
+void
+VectorOfTaggedObjects::order(void)
+{
+    this->squeeze();
+    if (sorted == true)
+      return;
+
+    // sort by tag and record the new positions
+    std::sort(theObjects.begin(), theObjects.end(), lessTag);
+    for (size_t i=0; i<theObjects.size(); i++)
+      this->setLocation(theObjects[i]->getTag(), int(i));
+
+    sorted = true;
+    if (theObjects.empty() == false)
+      maxTag = theObjects.back()->getTag();
+}
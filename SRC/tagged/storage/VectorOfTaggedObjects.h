@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/VectorOfTaggedObjects.h,v $
+                                                                        
+                                                                        
+#ifndef VectorOfTaggedObjects_h
+#define VectorOfTaggedObjects_h
+
+// Written: 10/26
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// VectorOfTaggedObjects. VectorOfTaggedObjects is a storage class. The
+// pointers to the objects are held in a dense vector, so that iteration
+// is a walk over contiguous memory. The position of an object in the
+// vector is found from its tag through a direct index table while the
+// tags are reasonably dense, with a hash table for any tags that fall
+// far outside it.
+//
+// As with MapOfTaggedObjects, the objects are iterated in tag order:
+// objects are appended as they are added and, if one was added out of
+// tag order, the vector is sorted when the next iteration is started.
+// Removing an object leaves a hole in the vector that the iters skip,
+// so objects may be removed during an iteration without any being
+// missed or returned twice; the holes are also squeezed out when the
+// next iteration is started.
+//
+// What: "@(#) VectorOfTaggedObjects.h, revA"
+
+#include <TaggedObjectStorage.h>
+#include <VectorOfTaggedObjectsIter.h>
+
+#include <vector>
+#include <unordered_map>
+
+class VectorOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    VectorOfTaggedObjects();
+    ~VectorOfTaggedObjects();    
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);    
+    int getNumComponents(void) const;
+    
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    VectorOfTaggedObjectsIter getIter();
+    
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+    
+    void Print(OPS_Stream &s, int flag =0);
+    friend class VectorOfTaggedObjectsIter;
+    
+  protected:    
+    
+  private:
+    int  findLocation(int tag) const;     // position of tag in theObjects, -1 if not there
+    void setLocation(int tag, int loc);   // record or, with loc = -1, erase the position of tag
+    void squeeze(void);                   // remove the holes left by removeComponent()
+    void order(void);                     // squeeze and, if needed, sort by tag
+
+    std::vector<TaggedObject *> theObjects;    // the pointers, 0 where one was removed
+    int numComponents;                         // number of non-zero entries in theObjects
+    bool sorted;                               // false if theObjects may be out of tag order
+    int maxTag;                                // largest tag added since theObjects was last sorted
+
+    std::vector<int> theDirectIndex;           // position of tag i, for 0 <= i < size(), or -1
+    std::unordered_map<int, int> theHashIndex; // position of the tags outside theDirectIndex
+
+    VectorOfTaggedObjectsIter myIter;          // the iter for this object
+};
+
+#endif
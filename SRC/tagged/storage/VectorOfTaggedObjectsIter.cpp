@@ -0,0 +1,66 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/VectorOfTaggedObjectsIter.cpp,v $
+                                                                        
+                                                                        
+// Written: 10/26
+// Revision: A
+//
+// Description: This file contains the implementation of VectorOfTaggedObjectsIter.
+
+#include <VectorOfTaggedObjectsIter.h>
+#include <VectorOfTaggedObjects.h>
+
+// VectorOfTaggedObjectsIter(VectorOfTaggedObjects &theComponents):
+//	constructor that takes the storage object, just the basic iter
+VectorOfTaggedObjectsIter::VectorOfTaggedObjectsIter(VectorOfTaggedObjects &theComponents)
+  :myComponents(&theComponents), currIndex(0)
+{
+
+}
+
+
+VectorOfTaggedObjectsIter::~VectorOfTaggedObjectsIter()
+{
+
+}    
+
+void
+VectorOfTaggedObjectsIter::reset(void)
+{
+    currIndex = 0;
+}
+
+TaggedObject *
+VectorOfTaggedObjectsIter::operator()(void)
+{
+    // skip over the holes left by removed objects; the size is checked
+    // each time as objects may be added or removed during the iteration
+    while (currIndex < int(myComponents->theObjects.size())) {
+	TaggedObject *result = myComponents->theObjects[currIndex++];
+	if (result != 0)
+	    return result;
+    }
+
+    return 0;
+}
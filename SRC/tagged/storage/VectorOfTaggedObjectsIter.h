@@ -0,0 +1,55 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.0 $
+// $Date: 2026-10-17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/VectorOfTaggedObjectsIter.h,v $
+                                                                        
+                                                                        
+#ifndef VectorOfTaggedObjectsIter_h
+#define VectorOfTaggedObjectsIter_h
+
+// Written: 10/26
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// VectorOfTaggedObjectsIter. A VectorOfTaggedObjectsIter is an iter for 
+// returning the TaggedObjects of a storage object of type 
+// VectorOfTaggedObjects, in the order in which they were added.
+
+#include <TaggedObjectIter.h>
+
+class VectorOfTaggedObjects;
+
+class VectorOfTaggedObjectsIter: public TaggedObjectIter
+{
+  public:
+    VectorOfTaggedObjectsIter(VectorOfTaggedObjects &theComponents);
+    virtual ~VectorOfTaggedObjectsIter();
+    
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);
+    
+  private:
+    VectorOfTaggedObjects *myComponents;
+    int currIndex;
+};
+
+#endif
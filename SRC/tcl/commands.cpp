@@ -132,6 +132,7 @@ extern "C" int         OPS_ResetInputNoBuilder(ClientData clientData, Tcl_Interp
 #include <InitialStateParameter.h>
 #include <ElementStateParameter.h>
 #include <Pressure_Constraint.h>
+#include <AsyncStream.h>
 
 // analysis model
 #include <AnalysisModel.h>
@@ -185,6 +186,7 @@ extern "C" int         OPS_ResetInputNoBuilder(ClientData clientData, Tcl_Interp
 #include <TransformationConstraintHandler.h>
 
 extern void* OPS_AutoConstraintHandler(void);
+extern void* OPS_AMGLinSolver(void);
 
 // numberers
 #include <PlainNumberer.h>
@@ -258,6 +260,10 @@ extern void *OPS_WilsonTheta(void);
 // for response spectrum analysis
 extern int OPS_DomainModalProperties(void);
 extern int OPS_ResponseSpectrumAnalysis(void);
+extern int OPS_ModalTransientAnalysis(void);
+extern int OPS_MultiRecordAnalysis(void);
+extern int OPS_ExplicitDynamicsAnalysis(void);
+extern void OPS_wipeExplicitDynamicsAnalysis(void);
 extern int OPS_sdfResponse(void);
 
 extern void OPS_SetReliabilityDomain(ReliabilityDomain *);
@@ -366,6 +372,7 @@ extern void OPS_SetReliabilityDomain(ReliabilityDomain *);
 #include <EigenSOE.h>
 #include <EigenSolver.h>
 #include <ArpackSOE.h>
+#include <BlockLanczosSOE.h>
 #include <ArpackSolver.h>
 #include <SymArpackSOE.h>
 #include <SymArpackSolver.h>
@@ -589,6 +596,7 @@ static Timer *theTimer = 0;
 
 #include <FileStream.h>
 #include <SimulationInformation.h>
+#include <MaterialArena.h>
 SimulationInformation simulationInfo;
 SimulationInformation *theSimulationInfoPtr = 0;
 
@@ -866,6 +874,10 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 
     Tcl_CreateCommand(interp, "setCreep", &setCreep,
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "setDomainThreads", &setDomainThreads,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "setRecorderAsync", &setRecorderAsync,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "setTime", &setTime,
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);     
     Tcl_CreateCommand(interp, "getTime", &getTime,
@@ -922,6 +934,12 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
         (ClientData)NULL, (Tcl_CmdDeleteProc*)NULL);
     Tcl_CreateCommand(interp, "responseSpectrumAnalysis", &responseSpectrumAnalysis,
         (ClientData)NULL, (Tcl_CmdDeleteProc*)NULL);
+    Tcl_CreateCommand(interp, "modalTransientAnalysis", &modalTransientAnalysis,
+        (ClientData)NULL, (Tcl_CmdDeleteProc*)NULL);
+    Tcl_CreateCommand(interp, "multiRecordAnalysis", &multiRecordAnalysis,
+        (ClientData)NULL, (Tcl_CmdDeleteProc*)NULL);
+    Tcl_CreateCommand(interp, "explicitDynamicsAnalysis", &explicitDynamicsAnalysis,
+        (ClientData)NULL, (Tcl_CmdDeleteProc*)NULL);
     Tcl_CreateCommand(interp, "video", &videoPlayer, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "remove", &removeObject, 
@@ -1460,6 +1478,9 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   OPS_clearAllStrengthDegradation();
   OPS_clearAllUnloadingRule();
 
+  // free the material memory now the materials are gone
+  MaterialArena::release();
+
   ops_Dt = 0.0;
 
 
@@ -1545,6 +1566,8 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   thePFEMAnalysis = 0;
   theTest = 0;
 
+  OPS_wipeExplicitDynamicsAnalysis();
+
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
 #ifdef _RELIABILITY
   theSensitivityAlgorithm =0;
@@ -1672,6 +1695,39 @@ setCreep(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+int 
+setDomainThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+      opserr << "WARNING illegal command - setDomainThreads numThreads? \n";
+      return TCL_ERROR;
+  }
+  int numThreads;
+  if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK) {
+      opserr << "WARNING reading number of threads - setDomainThreads numThreads? \n";
+      return TCL_ERROR;
+  }
+  theDomain.setNumThreads(numThreads);
+  return TCL_OK;
+}
+
+int 
+setRecorderAsync(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+      opserr << "WARNING illegal command - setRecorderAsync bufferSize? \n";
+      return TCL_ERROR;
+  }
+  int bufferSize;
+  if (Tcl_GetInt(interp, argv[1], &bufferSize) != TCL_OK) {
+      opserr << "WARNING reading buffer size - setRecorderAsync bufferSize? \n";
+      return TCL_ERROR;
+  }
+  // applies to recorders created after this command
+  AsyncStream::setBufferSize(bufferSize);
+  return TCL_OK;
+}
+
 int 
 setTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -2774,6 +2830,38 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	// set the pointer for variable time step analysis
 	theTransientAnalysis = theVariableTimeStepTransientAnalysis;
 
+	// optional error control: -errorControl absTol relTol <-shrink f> <-grow f>
+	int count = 2;
+	bool errorControl = false;
+	double absTol = 0.0, relTol = 0.0, minFactor = 0.2, maxFactor = 2.0;
+	while (count < argc) {
+	  if (strcmp(argv[count],"-errorControl") == 0) {
+	    if (count+2 >= argc ||
+		Tcl_GetDouble(interp, argv[count+1], &absTol) != TCL_OK ||
+		Tcl_GetDouble(interp, argv[count+2], &relTol) != TCL_OK) {
+	      opserr << "WARNING analysis VariableTransient -errorControl absTol? relTol?\n";
+	      return TCL_ERROR;
+	    }
+	    errorControl = true;
+	    count += 2;
+	  }
+	  else if (strcmp(argv[count],"-shrink") == 0) {
+	    count++;
+	    if (count < argc)
+	      if (Tcl_GetDouble(interp, argv[count], &minFactor) != TCL_OK)
+		return TCL_ERROR;		     
+	  }
+	  else if (strcmp(argv[count],"-grow") == 0) {
+	    count++;
+	    if (count < argc)
+	      if (Tcl_GetDouble(interp, argv[count], &maxFactor) != TCL_OK)
+		return TCL_ERROR;		     
+	  }
+	  count++;
+	}
+	if (errorControl == true)
+	  theVariableTimeStepTransientAnalysis->setErrorControl(absTol, relTol, minFactor, maxFactor);
+
 	#ifdef _RELIABILITY
 
 	//////////////////////////////////
@@ -3434,6 +3522,13 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     // theSOE = new UmfpackGenLinSOE(*theSolver, factLVALUE, factorOnce, printTime);      
     theSOE = new UmfpackGenLinSOE(*theSolver);      
   }
+
+  else if (strcmp(argv[1],"AMG") == 0) {
+    OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
+    theSOE = (LinearSOE*)OPS_AMGLinSolver();
+    if (theSOE == 0)
+      return TCL_ERROR;
+  }
   
 #ifdef _ITPACK
 //  else if (strcmp(argv[1],"Itpack") == 0) {
@@ -3881,6 +3976,8 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
     int incrementTangent = CURRENT_TANGENT;
     int iterateTangent = CURRENT_TANGENT;
     int maxDim = 3;
+    double reuseRate = 0.0;
+    int reuseSteps = 0;
     for (int i = 2; i < argc; i++) {
       if (strcmp(argv[i],"-iterate") == 0 && i+1 < argc) {
 	i++;
@@ -3904,6 +4001,14 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
 	i++;
 	maxDim = atoi(argv[i]);
       }
+      else if (strcmp(argv[i],"-reuse") == 0 && i+1 < argc) {
+	reuseRate = atof(argv[++i]);
+	char *end;
+	if (i+1 < argc && (reuseSteps = strtol(argv[i+1], &end, 10), *end == 0))
+	  i++;
+	else
+	  reuseSteps = 0;
+      }
     }
 
     if (theTest == 0) {
@@ -3915,6 +4020,8 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
     theAccel = new KrylovAccelerator(maxDim, iterateTangent);
 
     theNewAlgo = new AcceleratedNewton(*theTest, theAccel, incrementTangent);
+    if (reuseRate > 0.0)
+      theNewAlgo->setTangentReuse(reuseRate, reuseSteps);
   }
 
   else if (strcmp(argv[1],"RaphsonNewton") == 0) {
@@ -4104,6 +4211,8 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
   else if (strcmp(argv[1],"Broyden") == 0) {
     int formTangent = CURRENT_TANGENT;
     int count = -1;
+    double reuseRate = 0.0;
+    int reuseSteps = 0;
 
     if (theTest == 0) {
       opserr << "ERROR: No ConvergenceTest yet specified\n";
@@ -4114,6 +4223,13 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
 	formTangent = CURRENT_SECANT;
       } else if (strcmp(argv[i],"-initial") == 0) {
 	formTangent = INITIAL_TANGENT;
+      } else if (strcmp(argv[i],"-reuse") == 0 && i+1 < argc) {
+	reuseRate = atof(argv[++i]);
+	char *end;
+	if (i+1 < argc && (reuseSteps = strtol(argv[i+1], &end, 10), *end == 0))
+	  i++;
+	else
+	  reuseSteps = 0;
       } else if (strcmp(argv[i++],"-count") == 0 && i < argc) {
 	count = atoi(argv[i]);
       }
@@ -4123,16 +4239,27 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
       theNewAlgo = new Broyden(*theTest, formTangent); 
     else
       theNewAlgo = new Broyden(*theTest, formTangent, count); 
+    if (reuseRate > 0.0)
+      theNewAlgo->setTangentReuse(reuseRate, reuseSteps);
   }
 
   else if (strcmp(argv[1],"BFGS") == 0) {
     int formTangent = CURRENT_TANGENT;
     int count = -1;
+    double reuseRate = 0.0;
+    int reuseSteps = 0;
     for (int i = 2; i < argc; i++) {
       if (strcmp(argv[i],"-secant") == 0) {
 	formTangent = CURRENT_SECANT;
       } else if (strcmp(argv[i],"-initial") == 0) {
 	formTangent = INITIAL_TANGENT;
+      } else if (strcmp(argv[i],"-reuse") == 0 && i+1 < argc) {
+	reuseRate = atof(argv[++i]);
+	char *end;
+	if (i+1 < argc && (reuseSteps = strtol(argv[i+1], &end, 10), *end == 0))
+	  i++;
+	else
+	  reuseSteps = 0;
       } else if (strcmp(argv[i++],"-count") == 0 && i < argc) {
 	count = atoi(argv[i]);
       }
@@ -4147,6 +4274,8 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
       theNewAlgo = new BFGS(*theTest, formTangent); 
     else
       theNewAlgo = new BFGS(*theTest, formTangent, count); 
+    if (reuseRate > 0.0)
+      theNewAlgo->setTangentReuse(reuseRate, reuseSteps);
   }
   
   else if (strcmp(argv[1],"NewtonLineSearch") == 0) {
@@ -5691,6 +5820,10 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
          (strcmp(argv[loc],"fullGenLapackEigen") == 0) || 
          (strcmp(argv[loc],"-fullGenLapackEigen") == 0))
       typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
+
+    else if ((strcmp(argv[loc],"blockLanczos") == 0) || 
+         (strcmp(argv[loc],"-blockLanczos") == 0))
+      typeSolver = EigenSOE_TAGS_BlockLanczosSOE;
     
     else {
       opserr << "eigen - unknown option specified " << argv[loc] << endln;
@@ -5774,6 +5907,10 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+      } else if (typeSolver == EigenSOE_TAGS_BlockLanczosSOE) {
+
+	theEigenSOE = new BlockLanczosSOE(shift);
+
       } else {
 
 	theEigenSOE = new ArpackSOE(shift);    
@@ -5866,6 +6003,33 @@ responseSpectrumAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TC
     return TCL_OK;
 }
 
+int
+modalTransientAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv)
+{
+    OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+    if (OPS_ModalTransientAnalysis() < 0)
+	    return TCL_ERROR;
+    return TCL_OK;
+}
+
+int
+multiRecordAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv)
+{
+    OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+    if (OPS_MultiRecordAnalysis() < 0)
+	    return TCL_ERROR;
+    return TCL_OK;
+}
+
+int
+explicitDynamicsAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv)
+{
+    OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+    if (OPS_ExplicitDynamicsAnalysis() < 0)
+	    return TCL_ERROR;
+    return TCL_OK;
+}
+
 int 
 videoPlayer(ClientData clientData, Tcl_Interp *interp, int argc, 
 	    TCL_Char **argv)
@@ -10097,7 +10261,11 @@ numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   if (theAlgorithm == 0)
     return TCL_ERROR;
 
-  sprintf(buffer, "%d", theAlgorithm->getNumFactorizations());
+  // numFact <-saved>
+  if (argc > 1 && strcmp(argv[1], "-saved") == 0)
+    sprintf(buffer, "%d", theAlgorithm->getNumFactorizationsSaved());
+  else
+    sprintf(buffer, "%d", theAlgorithm->getNumFactorizations());
   Tcl_SetResult(interp, buffer, TCL_VOLATILE);
 
   return TCL_OK;
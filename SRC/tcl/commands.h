@@ -71,6 +71,12 @@ setLoadConst(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
 int 
 setCreep(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+setDomainThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+setRecorderAsync(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 setTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -135,6 +141,15 @@ modalProperties(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char**
 int
 responseSpectrumAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv);
 
+int
+modalTransientAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv);
+
+int
+multiRecordAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv);
+
+int
+explicitDynamicsAnalysis(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** argv);
+
 int 
 videoPlayer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 